@@ -0,0 +1,103 @@
+/*
+ * Benchmark: Bytecode::evaluate, Bytecode::evaluateBatch and jitCompile
+ *
+ * Evaluates the recorded `ExpCoords::ddR` for many points, one point at a
+ * time with the interpreter and the jit compiled function, and in batches
+ * with every supported instruction set.
+ *
+ * Usage: bench-batch [number of points, default 100000]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <ExpCoords.h>
+
+#include <Bytecode.h>
+#include <CodeGenerator.h>
+#include <Jit.h>
+#include <RecType.h>
+#include <Tensors.h>
+
+using namespace AutoGen;
+
+int main(int argc, char *argv[])
+{
+	size_t n = (argc > 1) ? std::atol(argv[1]) : 100000;
+
+	typedef RecType<double> Rt;
+
+	Vector3<Rt> v;
+	for (int i = 0; i < 3; ++i) {
+		v[i] = Rt("v[" + std::to_string(i) + "]");
+	}
+
+	CodeGenerator<double> generator;
+	Tensor4<Rt, 3,3,3,3> ddR = ExpCoords::ddR(v);
+	for (int i = 0; i < 3; ++i)
+		for (int j = 0; j < 3; ++j)
+			for (int k = 0; k < 3; ++k)
+				for (int l = 0; l < 3; ++l)
+					ddR[i][j](k,l).addToGeneratorAsResult(generator, "ddR[" + std::to_string(((i*3 + j)*3 + k)*3 + l) + "]");
+	generator.sortNodes();
+
+	Bytecode<double> bytecode = Bytecode<double>::compile(generator);
+	std::cout << bytecode.getInstructions().size() << " instructions, "
+			  << bytecode.getNumRegisters() << " registers, " << n << " points" << std::endl;
+
+	// inputs and outputs in structure-of-arrays layout
+	std::vector<double> in(3*n), out(bytecode.getNumOutputs()*n);
+	for (size_t k = 0; k < in.size(); ++k) {
+		in[k] = 0.5 - double(std::rand()) / RAND_MAX;
+	}
+
+	std::cout << "mode\tns/point" << std::endl;
+	{
+		std::vector<double> point(3), result(bytecode.getNumOutputs());
+		auto t0 = std::chrono::steady_clock::now();
+		for (size_t k = 0; k < n; ++k) {
+			for (int i = 0; i < 3; ++i)
+				point[i] = in[i*n + k];
+			bytecode.evaluate(point.data(), result.data());
+			for (size_t i = 0; i < result.size(); ++i)
+				out[i*n + k] = result[i];
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		std::cout << "single\t" << std::chrono::duration<double, std::nano>(t1 - t0).count() / n << std::endl;
+	}
+
+	{
+		std::string error;
+		JitFunction function;
+		auto t0 = std::chrono::steady_clock::now();
+		if(!jitCompile(bytecode, function, error)) {
+			std::cout << error << std::endl;
+			return 1;
+		}
+		auto t1 = std::chrono::steady_clock::now();
+		std::vector<double> point(3), result(bytecode.getNumOutputs());
+		for (size_t k = 0; k < n; ++k) {
+			for (int i = 0; i < 3; ++i)
+				point[i] = in[i*n + k];
+			function(point.data(), result.data());
+			for (size_t i = 0; i < result.size(); ++i)
+				out[i*n + k] = result[i];
+		}
+		auto t2 = std::chrono::steady_clock::now();
+		std::cout << "jit	" << std::chrono::duration<double, std::nano>(t2 - t1).count() / n
+				  << " (compiled in " << std::chrono::duration<double, std::milli>(t1 - t0).count() << " ms)" << std::endl;
+	}
+
+	const char *names[] = {"auto", "scalar", "avx2", "avx512"};
+	for (SimdLevel simd : {SIMD_AUTO, SIMD_SCALAR, SIMD_AVX2, SIMD_AVX512}) {
+		if(!Bytecode<double>::isSupported(simd))
+			continue;
+		auto t0 = std::chrono::steady_clock::now();
+		bytecode.evaluateBatch(n, in.data(), out.data(), simd);
+		auto t1 = std::chrono::steady_clock::now();
+		std::cout << names[simd] << "\t" << std::chrono::duration<double, std::nano>(t1 - t0).count() / n << std::endl;
+	}
+}
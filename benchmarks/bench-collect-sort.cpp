@@ -0,0 +1,71 @@
+/*
+ * Benchmark: CodeGenerator::collectNodes and CodeGenerator::sortNodes
+ *
+ * Builds deep expression graphs with 10^3 ... 10^N nodes and measures the
+ * time to collect and sort them. The time per node should stay roughly
+ * constant.
+ *
+ * Usage: bench-collect-sort [max exponent, default 7]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <CodeGenerator.h>
+#include <RecType.h>
+
+using namespace AutoGen;
+
+// A long chain where every node also uses one of the last 64 nodes, so the
+// graph is both deep and shared. The nodes are created directly on the tape:
+// the constant folding of the RecType operators is not what we measure here.
+const Node<double>* buildGraph(Tape<double> &tape, size_t numNodes) {
+	std::vector<const Node<double>*> nodes;
+	nodes.reserve(numNodes);
+	for (int i = 0; i < 8; ++i) {
+		nodes.push_back(tape.create<NodeVar<double>>("x[" + std::to_string(i) + "]"));
+	}
+	for (size_t k = nodes.size(); k+1 < numNodes; ++k) {
+		const Node<double>* a = nodes[k-1];
+		const Node<double>* b = nodes[k-1-(k*7919) % std::min<size_t>(k, 64)];
+		switch (k % 4) {
+		case 0: nodes.push_back(tape.create<NodeAdd<double>>(a, b)); break;
+		case 1: nodes.push_back(tape.create<NodeMul<double>>(a, b)); break;
+		case 2: nodes.push_back(tape.create<NodeSub<double>>(a, b)); break;
+		default: nodes.push_back(tape.create<NodeSin<double>>(a)); break;
+		}
+	}
+	return tape.create<NodeResult<double>>("y[0]", nodes.back());
+}
+
+int main(int argc, char *argv[])
+{
+	int maxExponent = (argc > 1) ? std::atoi(argv[1]) : 7;
+
+	std::cout << "nodes\tcollect [ms]\tsort [ms]\tns/node" << std::endl;
+
+	for (int e = 3; e <= maxExponent; ++e) {
+		size_t numNodes = 1;
+		for (int i = 0; i < e; ++i)
+			numNodes *= 10;
+
+		Tape<double> tape;
+		const Node<double>* result = buildGraph(tape, numNodes);
+
+		CodeGenerator<double> generator;
+
+		auto t0 = std::chrono::steady_clock::now();
+		generator.collectNodes(result);
+		auto t1 = std::chrono::steady_clock::now();
+		generator.sortNodes();
+		auto t2 = std::chrono::steady_clock::now();
+
+		double collectMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+		double sortMs = std::chrono::duration<double, std::milli>(t2 - t1).count();
+		std::cout << generator.getNumNodes() << "\t" << collectMs << "\t" << sortMs
+				  << "\t" << 1e6*(collectMs + sortMs) / generator.getNumNodes() << std::endl;
+	}
+}
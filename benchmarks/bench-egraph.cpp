@@ -0,0 +1,119 @@
+/*
+ * Benchmark: simplify (EGraph.h)
+ *
+ * Simplifies the recorded `ExpCoords::R`, `dR` and `ddR` with an e-graph and
+ * compares the number of operations and their cost in flops before and after,
+ * and the time per point of the jit compiled kernels.
+ *
+ * Usage: bench-egraph [number of points, default 100000]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <ExpCoords.h>
+
+#include <Bytecode.h>
+#include <CodeGenerator.h>
+#include <EGraph.h>
+#include <Jit.h>
+#include <RecType.h>
+#include <Tensors.h>
+
+using namespace AutoGen;
+
+typedef RecType<double> Rt;
+
+// ns per point of the jit compiled `values`
+static double timeKernel(const std::vector<Rt> &values, const std::vector<double> &in, std::vector<double> &out) {
+	CodeGenerator<double> generator;
+	std::vector<std::string> outputs;
+	for (size_t i = 0; i < values.size(); ++i) {
+		outputs.push_back("y[" + std::to_string(i) + "]");
+		Rt(values[i]).addToGeneratorAsResult(generator, outputs.back());
+	}
+	generator.sortNodes();
+
+	std::string error;
+	JitFunction function;
+	if(!jitCompile(Bytecode<double>::compile(generator, {"v[0]", "v[1]", "v[2]"}, outputs), function, error)) {
+		std::cout << error << std::endl;
+		return 0;
+	}
+
+	size_t n = in.size() / 3;
+	out.resize(values.size()*n);
+	auto t0 = std::chrono::steady_clock::now();
+	for (size_t k = 0; k < n; ++k) {
+		function(const_cast<double*>(&in[3*k]), &out[values.size()*k]);
+	}
+	auto t1 = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+}
+
+static size_t countOperations(const std::vector<Rt> &values) {
+	CodeGenerator<double> generator;
+	for (const Rt &value : values) {
+		generator.collectNodes(value.getNode());
+	}
+	size_t count = 0;
+	for (size_t i = 0; i < generator.getNumNodes(); ++i) {
+		NodeOp op = generator.getNode(i)->getOp();
+		if(op != CONST_OP && op != VAR_OP)
+			count++;
+	}
+	return count;
+}
+
+int main(int argc, char *argv[])
+{
+	size_t n = (argc > 1) ? std::atol(argv[1]) : 100000;
+
+	Vector3<Rt> v;
+	for (int i = 0; i < 3; ++i) {
+		v[i] = Rt("v[" + std::to_string(i) + "]");
+	}
+
+	std::vector<std::vector<Rt>> kernels(3);
+	Matrix3<Rt> R = ExpCoords::R(v);
+	Tensor3<Rt,3,3,3> dR = ExpCoords::dR(v);
+	Tensor4<Rt,3,3,3,3> ddR = ExpCoords::ddR(v);
+	for (int k = 0; k < 3; ++k)
+		for (int l = 0; l < 3; ++l) {
+			kernels[0].push_back(R(k,l));
+			for (int j = 0; j < 3; ++j) {
+				kernels[1].push_back(dR[j](k,l));
+				for (int i = 0; i < 3; ++i)
+					kernels[2].push_back(ddR[i][j](k,l));
+			}
+		}
+	const char *names[] = {"R", "dR", "ddR"};
+
+	std::vector<double> in(3*n);
+	for (size_t k = 0; k < in.size(); ++k) {
+		in[k] = 2.0*(0.5 - double(std::rand()) / RAND_MAX);
+	}
+
+	std::cout << "kernel\tops\tflops\tns/point\tsimplified ops\tflops\tns/point\tsimplify ms\tmax error" << std::endl;
+	for (int k = 0; k < 3; ++k) {
+		auto t0 = std::chrono::steady_clock::now();
+		std::vector<Rt> simplified = simplify(kernels[k]);
+		auto t1 = std::chrono::steady_clock::now();
+
+		std::vector<double> out, outSimplified;
+		double time = timeKernel(kernels[k], in, out);
+		double timeSimplified = timeKernel(simplified, in, outSimplified);
+		double maxError = 0;
+		for (size_t i = 0; i < out.size(); ++i) {
+			maxError = std::max(maxError, std::abs(out[i] - outSimplified[i]));
+		}
+
+		std::cout << names[k]
+				  << "\t" << countOperations(kernels[k]) << "\t" << EGraph<double>::getCost(kernels[k]) << "\t" << time
+				  << "\t" << countOperations(simplified) << "\t" << EGraph<double>::getCost(simplified) << "\t" << timeSimplified
+				  << "\t" << std::chrono::duration<double, std::milli>(t1 - t0).count() << "\t" << maxError << std::endl;
+	}
+}
@@ -0,0 +1,43 @@
+#include <iostream>
+#include <fstream>
+
+#include <sys/stat.h>
+
+#include <ExpCoords.h>
+
+#include <CodeGenerator.h>
+#include <AutoDiff.h>
+#include <RecType.h>
+#include <Tensors.h>
+
+using namespace AutoGen;
+
+// ddR of exponential coordinates, split into translation units of at most 500
+// nodes that are compiled in parallel (`add_generated_library(ddR-split)`).
+int main()
+{
+    typedef RecType<double> Rt;
+
+    // record computation
+    Vector3<Rt> v;
+    for (int i = 0; i < 3; ++i) {
+        v[i] = Rt("v[" + std::to_string(i) + "]");
+    }
+
+    CodeGenerator<double> generator;
+
+    Tensor4<Rt, 3,3,3,3> ddR = ExpCoords::ddR(v);
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            for (int k = 0; k < 3; ++k)
+                for (int l = 0; l < 3; ++l)
+                    ddR[i][j](k,l).addToGeneratorAsResult(generator, "ddR[" + std::to_string(27*i + 9*j + 3*k + l) + "]");
+
+    generator.sortNodes();
+
+    std::string directory = AUTOGEN_GENERATED_CODE_FOLDER"/ddR-split";
+    mkdir(directory.c_str(), 0755);
+    SplitCode code = generator.generateSplitCode("void compute_ddR(const double *v, double *ddR)", 500);
+    code.writeFiles(directory, "ddR");
+    std::cout << "generated code saved to `" << directory << "` (" << code.parts.size() << " parts)" << std::endl;
+}
@@ -5,14 +5,14 @@
 
 #include <ExpCoords.h>
 
-#include <CodeGenerator.h>
+#include <CodeModule.h>
 #include <AutoDiff.h>
 #include <RecType.h>
 #include <Tensors.h>
 
 using namespace AutoGen;
 
-int main(int argc, char *argv[])
+int main()
 {
     typedef RecType<double> Rt;
 
@@ -22,7 +22,8 @@ int main(int argc, char *argv[])
         v[i] = Rt("v[" + std::to_string(i) + "]");
     }
 
-    CodeGenerator<double> generator;
+    CodeModule<double> module;
+    module.addFunction("ddR", "const Vector3d &v, Tensor4d3 &ddR");
 
     // compute gradient and add to code gen
     {
@@ -31,19 +32,18 @@ int main(int argc, char *argv[])
             for (int j = 0; j < 3; ++j)
                 for (int k = 0; k < 3; ++k)
                     for (int l = 0; l < 3; ++l){
-                        ddR[i][j](k,l).addToGeneratorAsResult(generator, "ddR[" + std::to_string(i) + "]["
-                                                                              + std::to_string(j) + "]("
-                                                                              + std::to_string(k) + ","
-                                                                              + std::to_string(l) + ")");
+                        module.addOutput("ddR", "ddR[" + std::to_string(i) + "]["
+                                                        + std::to_string(j) + "]("
+                                                        + std::to_string(k) + ","
+                                                        + std::to_string(l) + ")", ddR[i][j](k,l));
                     }
         }
     }
 
-    generator.sortNodes();
-
     std::string filename = AUTOGEN_GENERATED_CODE_FOLDER"/ddR.cpp";
     std::ofstream file(filename);
-    file << generator.generateCode() << std::endl;
+    file << module.generateCode("ddR");
+    file << std::endl;
     file.close();
     std::cout << "generated code saved to `" << filename << "`" << std::endl;;
 }
@@ -0,0 +1,51 @@
+#include <iostream>
+#include <fstream>
+
+#include <ExpCoords.h>
+
+#include <CodeModule.h>
+#include <AutoDiff.h>
+#include <RecType.h>
+#include <Tensors.h>
+
+using namespace AutoGen;
+
+// R, dR and ddR of exponential coordinates as one module, so the norm, sin,
+// cos and R are shared by all entry points.
+int main()
+{
+    typedef RecType<double> Rt;
+
+    Tape<double>::HashConsing hashConsing(Tape<double>::active());
+
+    // record computation
+    Vector3<Rt> v;
+    for (int i = 0; i < 3; ++i) {
+        v[i] = Rt("v[" + std::to_string(i) + "]");
+    }
+
+    CodeModule<double> module;
+    module.addFunction("R", "const double *v, double *R");
+    module.addFunction("dR", "const double *v, double *dR");
+    module.addFunction("ddR", "const double *v, double *ddR");
+
+    Matrix3<Rt> R = ExpCoords::R(v);
+    Tensor3<Rt,3,3,3> dR = ExpCoords::dR(v);
+    Tensor4<Rt,3,3,3,3> ddR = ExpCoords::ddR(v);
+    for (int k = 0; k < 3; ++k)
+        for (int l = 0; l < 3; ++l) {
+            module.addOutput("R", "R[" + std::to_string(3*k + l) + "]", R(k,l));
+            for (int j = 0; j < 3; ++j) {
+                module.addOutput("dR", "dR[" + std::to_string(9*j + 3*k + l) + "]", dR[j](k,l));
+                for (int i = 0; i < 3; ++i)
+                    module.addOutput("ddR", "ddR[" + std::to_string(27*i + 9*j + 3*k + l) + "]", ddR[i][j](k,l));
+            }
+        }
+
+    std::string filename = AUTOGEN_GENERATED_CODE_FOLDER"/ExpCoords.cpp";
+    std::ofstream file(filename);
+    file << "#include <cmath>\n\n";
+    module.writeModule(file, "R_dR_ddR");
+    file.close();
+    std::cout << "generated code saved to `" << filename << "`" << std::endl;
+}
@@ -43,7 +43,8 @@ int main(int argc, char *argv[])
 
     std::string filename = AUTOGEN_GENERATED_CODE_FOLDER"/ddR.cpp";
     std::ofstream file(filename);
-    file << generator.generateCode() << std::endl;
+    generator.generateCode(file);
+    file << std::endl;
     file.close();
     std::cout << "generated code saved to `" << filename << "`" << std::endl;;
 }
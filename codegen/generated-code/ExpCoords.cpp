@@ -0,0 +1,3354 @@
+#include <cmath>
+
+void R(const double *v, double *R) {
+double v0 = v[0];
+double v1 = v[1];
+double v2 = v[2];
+double v3 = 1.0;
+double v4 = 2.0;
+double v5 = 0.5;
+double v6 = v0 * v0;
+double v7 = v1 * v1;
+double v8 = v2 * v2;
+double v9 = v7 + v8;
+double v10 = v6 + v9;
+double v11 = sqrt(v10);
+double v12 = v5 * v11;
+double v13 = sin(v12);
+double v14 = v4 * v13;
+double v15 = v14 * v13;
+double v16 = v2 / v11;
+double v17 = -v16;
+double v18 = v17 * v16;
+double v19 = v1 / v11;
+double v20 = -v19;
+double v21 = v19 * v20;
+double v22 = v18 + v21;
+double v23 = v15 * v22;
+double v24 = v3 + v23;
+double v29 = sin(v11);
+double v30 = v29 * v16;
+double v31 = v0 / v11;
+double v32 = -v31;
+double v33 = v32 * v20;
+double v34 = v15 * v33;
+double v35 = v30 + v34;
+double v47 = v29 * v20;
+double v48 = v31 * v16;
+double v49 = v15 * v48;
+double v50 = v47 + v49;
+double v299 = v29 * v17;
+double v300 = v19 * v31;
+double v301 = v15 * v300;
+double v302 = v299 + v301;
+double v305 = v32 * v31;
+double v306 = v18 + v305;
+double v307 = v15 * v306;
+double v308 = v3 + v307;
+double v317 = v29 * v31;
+double v318 = v20 * v17;
+double v319 = v15 * v318;
+double v320 = v317 + v319;
+double v489 = v29 * v19;
+double v490 = v17 * v32;
+double v491 = v15 * v490;
+double v492 = v489 + v491;
+double v495 = v29 * v32;
+double v496 = v16 * v19;
+double v497 = v15 * v496;
+double v498 = v495 + v497;
+double v507 = v21 + v305;
+double v508 = v15 * v507;
+double v509 = v3 + v508;
+R[0] = v24;
+R[1] = v302;
+R[2] = v492;
+R[3] = v35;
+R[4] = v308;
+R[5] = v498;
+R[6] = v50;
+R[7] = v320;
+R[8] = v509;
+}
+
+void dR(const double *v, double *dR) {
+double v0 = v[0];
+double v1 = v[1];
+double v2 = v[2];
+double v3 = 1.0;
+double v4 = 2.0;
+double v5 = 0.5;
+double v6 = v0 * v0;
+double v7 = v1 * v1;
+double v8 = v2 * v2;
+double v9 = v7 + v8;
+double v10 = v6 + v9;
+double v11 = sqrt(v10);
+double v12 = v5 * v11;
+double v13 = sin(v12);
+double v14 = v4 * v13;
+double v15 = v14 * v13;
+double v16 = v2 / v11;
+double v17 = -v16;
+double v18 = v17 * v16;
+double v19 = v1 / v11;
+double v20 = -v19;
+double v21 = v19 * v20;
+double v22 = v18 + v21;
+double v23 = v15 * v22;
+double v24 = v3 + v23;
+double v25 = v0 * v2;
+double v26 = -v1;
+double v27 = v3 - v24;
+double v28 = v26 * v27;
+double v29 = sin(v11);
+double v30 = v29 * v16;
+double v31 = v0 / v11;
+double v32 = -v31;
+double v33 = v32 * v20;
+double v34 = v15 * v33;
+double v35 = v30 + v34;
+double v36 = -v35;
+double v37 = v0 * v36;
+double v38 = v28 + v37;
+double v39 = v25 + v38;
+double v40 = -v39;
+double v41 = v11 * v11;
+double v42 = v40 / v41;
+double v43 = v42 * v35;
+double v44 = v0 * v1;
+double v45 = v2 * v27;
+double v46 = -v0;
+double v47 = v29 * v20;
+double v48 = v31 * v16;
+double v49 = v15 * v48;
+double v50 = v47 + v49;
+double v51 = -v50;
+double v52 = v46 * v51;
+double v53 = v45 + v52;
+double v54 = v44 + v53;
+double v55 = v54 / v41;
+double v56 = v55 * v50;
+double v57 = v43 + v56;
+double v298 = v1 * v2;
+double v299 = v29 * v17;
+double v300 = v19 * v31;
+double v301 = v15 * v300;
+double v302 = v299 + v301;
+double v303 = -v302;
+double v304 = v26 * v303;
+double v305 = v32 * v31;
+double v306 = v18 + v305;
+double v307 = v15 * v306;
+double v308 = v3 + v307;
+double v309 = v3 - v308;
+double v310 = v0 * v309;
+double v311 = v304 + v310;
+double v312 = v298 + v311;
+double v313 = -v312;
+double v314 = v313 / v41;
+double v315 = v314 * v35;
+double v316 = v2 * v303;
+double v317 = v29 * v31;
+double v318 = v20 * v17;
+double v319 = v15 * v318;
+double v320 = v317 + v319;
+double v321 = -v320;
+double v322 = v46 * v321;
+double v323 = v316 + v322;
+double v324 = v7 + v323;
+double v325 = v324 / v41;
+double v326 = v325 * v50;
+double v327 = v315 + v326;
+double v489 = v29 * v19;
+double v490 = v17 * v32;
+double v491 = v15 * v490;
+double v492 = v489 + v491;
+double v493 = -v492;
+double v494 = v26 * v493;
+double v495 = v29 * v32;
+double v496 = v16 * v19;
+double v497 = v15 * v496;
+double v498 = v495 + v497;
+double v499 = -v498;
+double v500 = v0 * v499;
+double v501 = v494 + v500;
+double v502 = v8 + v501;
+double v503 = -v502;
+double v504 = v503 / v41;
+double v505 = v504 * v35;
+double v506 = v2 * v493;
+double v507 = v21 + v305;
+double v508 = v15 * v507;
+double v509 = v3 + v508;
+double v510 = v3 - v509;
+double v511 = v46 * v510;
+double v512 = v506 + v511;
+double v513 = v298 + v512;
+double v514 = v513 / v41;
+double v515 = v514 * v50;
+double v516 = v505 + v515;
+double v669 = v42 * v308;
+double v670 = v55 * v320;
+double v671 = v669 + v670;
+double v693 = v314 * v308;
+double v694 = v325 * v320;
+double v695 = v693 + v694;
+double v717 = v504 * v308;
+double v718 = v514 * v320;
+double v719 = v717 + v718;
+double v741 = v42 * v498;
+double v742 = v55 * v509;
+double v743 = v741 + v742;
+double v765 = v314 * v498;
+double v766 = v325 * v509;
+double v767 = v765 + v766;
+double v789 = v504 * v498;
+double v790 = v514 * v509;
+double v791 = v789 + v790;
+double v813 = v39 / v41;
+double v814 = v813 * v24;
+double v815 = -v2;
+double v816 = v815 * v36;
+double v817 = v1 * v51;
+double v818 = v816 + v817;
+double v819 = v6 + v818;
+double v820 = -v819;
+double v821 = v820 / v41;
+double v822 = v821 * v50;
+double v823 = v814 + v822;
+double v881 = v312 / v41;
+double v882 = v881 * v24;
+double v883 = v815 * v309;
+double v884 = v1 * v321;
+double v885 = v883 + v884;
+double v886 = v44 + v885;
+double v887 = -v886;
+double v888 = v887 / v41;
+double v889 = v888 * v50;
+double v890 = v882 + v889;
+double v949 = v502 / v41;
+double v950 = v949 * v24;
+double v951 = v815 * v499;
+double v952 = v1 * v510;
+double v953 = v951 + v952;
+double v954 = v25 + v953;
+double v955 = -v954;
+double v956 = v955 / v41;
+double v957 = v956 * v50;
+double v958 = v950 + v957;
+double v1017 = v813 * v302;
+double v1018 = v821 * v320;
+double v1019 = v1017 + v1018;
+double v1041 = v881 * v302;
+double v1042 = v888 * v320;
+double v1043 = v1041 + v1042;
+double v1065 = v949 * v302;
+double v1066 = v956 * v320;
+double v1067 = v1065 + v1066;
+double v1089 = v813 * v492;
+double v1090 = v821 * v509;
+double v1091 = v1089 + v1090;
+double v1113 = v881 * v492;
+double v1114 = v888 * v509;
+double v1115 = v1113 + v1114;
+double v1137 = v949 * v492;
+double v1138 = v956 * v509;
+double v1139 = v1137 + v1138;
+double v1161 = -v54;
+double v1162 = v1161 / v41;
+double v1163 = v1162 * v24;
+double v1164 = v819 / v41;
+double v1165 = v1164 * v35;
+double v1166 = v1163 + v1165;
+double v1211 = -v324;
+double v1212 = v1211 / v41;
+double v1213 = v1212 * v24;
+double v1214 = v886 / v41;
+double v1215 = v1214 * v35;
+double v1216 = v1213 + v1215;
+double v1261 = -v513;
+double v1262 = v1261 / v41;
+double v1263 = v1262 * v24;
+double v1264 = v954 / v41;
+double v1265 = v1264 * v35;
+double v1266 = v1263 + v1265;
+double v1311 = v1162 * v302;
+double v1312 = v1164 * v308;
+double v1313 = v1311 + v1312;
+double v1335 = v1212 * v302;
+double v1336 = v1214 * v308;
+double v1337 = v1335 + v1336;
+double v1359 = v1262 * v302;
+double v1360 = v1264 * v308;
+double v1361 = v1359 + v1360;
+double v1383 = v1162 * v492;
+double v1384 = v1164 * v498;
+double v1385 = v1383 + v1384;
+double v1407 = v1212 * v492;
+double v1408 = v1214 * v498;
+double v1409 = v1407 + v1408;
+double v1431 = v1262 * v492;
+double v1432 = v1264 * v498;
+double v1433 = v1431 + v1432;
+dR[0] = v57;
+dR[9] = v327;
+dR[18] = v516;
+dR[1] = v671;
+dR[10] = v695;
+dR[19] = v719;
+dR[2] = v743;
+dR[11] = v767;
+dR[20] = v791;
+dR[3] = v823;
+dR[12] = v890;
+dR[21] = v958;
+dR[4] = v1019;
+dR[13] = v1043;
+dR[22] = v1067;
+dR[5] = v1091;
+dR[14] = v1115;
+dR[23] = v1139;
+dR[6] = v1166;
+dR[15] = v1216;
+dR[24] = v1266;
+dR[7] = v1313;
+dR[16] = v1337;
+dR[25] = v1361;
+dR[8] = v1385;
+dR[17] = v1409;
+dR[26] = v1433;
+}
+
+void ddR(const double *v, double *ddR) {
+double v0 = v[0];
+double v1 = v[1];
+double v2 = v[2];
+double v3 = 1.0;
+double v4 = 2.0;
+double v5 = 0.5;
+double v6 = v0 * v0;
+double v7 = v1 * v1;
+double v8 = v2 * v2;
+double v9 = v7 + v8;
+double v10 = v6 + v9;
+double v11 = sqrt(v10);
+double v12 = v5 * v11;
+double v13 = sin(v12);
+double v14 = v4 * v13;
+double v15 = v14 * v13;
+double v16 = v2 / v11;
+double v17 = -v16;
+double v18 = v17 * v16;
+double v19 = v1 / v11;
+double v20 = -v19;
+double v21 = v19 * v20;
+double v22 = v18 + v21;
+double v23 = v15 * v22;
+double v24 = v3 + v23;
+double v25 = v0 * v2;
+double v26 = -v1;
+double v27 = v3 - v24;
+double v28 = v26 * v27;
+double v29 = sin(v11);
+double v30 = v29 * v16;
+double v31 = v0 / v11;
+double v32 = -v31;
+double v33 = v32 * v20;
+double v34 = v15 * v33;
+double v35 = v30 + v34;
+double v36 = -v35;
+double v37 = v0 * v36;
+double v38 = v28 + v37;
+double v39 = v25 + v38;
+double v40 = -v39;
+double v41 = v11 * v11;
+double v42 = v40 / v41;
+double v44 = v0 * v1;
+double v45 = v2 * v27;
+double v46 = -v0;
+double v47 = v29 * v20;
+double v48 = v31 * v16;
+double v49 = v15 * v48;
+double v50 = v47 + v49;
+double v51 = -v50;
+double v52 = v46 * v51;
+double v53 = v45 + v52;
+double v54 = v44 + v53;
+double v55 = v54 / v41;
+double v58 = v5 / v11;
+double v59 = v0 + v0;
+double v60 = v58 * v59;
+double v61 = v2 / v41;
+double v62 = v60 * v61;
+double v63 = -v62;
+double v64 = v63 * v29;
+double v65 = cos(v11);
+double v66 = v65 * v60;
+double v67 = v66 * v16;
+double v68 = v64 + v67;
+double v69 = v1 / v41;
+double v70 = v60 * v69;
+double v71 = -v70;
+double v72 = -v71;
+double v73 = v72 * v32;
+double v74 = v11 / v41;
+double v75 = v0 / v41;
+double v76 = v60 * v75;
+double v77 = v74 - v76;
+double v78 = -v77;
+double v79 = v78 * v20;
+double v80 = v73 + v79;
+double v81 = v80 * v15;
+double v82 = cos(v12);
+double v83 = v5 * v60;
+double v84 = v82 * v83;
+double v85 = v84 * v14;
+double v86 = v84 * v4;
+double v87 = v86 * v13;
+double v88 = v85 + v87;
+double v89 = v88 * v33;
+double v90 = v81 + v89;
+double v91 = v68 + v90;
+double v92 = v91 * v42;
+double v93 = v63 * v17;
+double v94 = -v63;
+double v95 = v94 * v16;
+double v96 = v93 + v95;
+double v97 = v72 * v19;
+double v98 = v71 * v20;
+double v99 = v97 + v98;
+double v100 = v96 + v99;
+double v101 = v100 * v15;
+double v102 = v88 * v22;
+double v103 = v101 + v102;
+double v104 = -v103;
+double v105 = v104 * v26;
+double v106 = -v91;
+double v107 = v106 * v0;
+double v108 = v107 + v36;
+double v109 = v105 + v108;
+double v110 = v2 + v109;
+double v111 = -v110;
+double v112 = v41 * v41;
+double v113 = v41 / v112;
+double v114 = v111 * v113;
+double v115 = v60 * v11;
+double v116 = v115 + v115;
+double v117 = v40 / v112;
+double v118 = v116 * v117;
+double v119 = v114 - v118;
+double v120 = v119 * v35;
+double v121 = v92 + v120;
+double v122 = v72 * v29;
+double v123 = v66 * v20;
+double v124 = v122 + v123;
+double v125 = v63 * v31;
+double v126 = v77 * v16;
+double v127 = v125 + v126;
+double v128 = v127 * v15;
+double v129 = v88 * v48;
+double v130 = v128 + v129;
+double v131 = v124 + v130;
+double v132 = v131 * v55;
+double v133 = v104 * v2;
+double v134 = -v131;
+double v135 = v134 * v46;
+double v136 = -v51;
+double v137 = v135 + v136;
+double v138 = v133 + v137;
+double v139 = v1 + v138;
+double v140 = v139 * v113;
+double v141 = v54 / v112;
+double v142 = v116 * v141;
+double v143 = v140 - v142;
+double v144 = v143 * v50;
+double v145 = v132 + v144;
+double v146 = v121 + v145;
+double v147 = v1 + v1;
+double v148 = v58 * v147;
+double v149 = v148 * v61;
+double v150 = -v149;
+double v151 = v150 * v29;
+double v152 = v65 * v148;
+double v153 = v152 * v16;
+double v154 = v151 + v153;
+double v155 = v148 * v69;
+double v156 = v74 - v155;
+double v157 = -v156;
+double v158 = v157 * v32;
+double v159 = v148 * v75;
+double v160 = -v159;
+double v161 = -v160;
+double v162 = v161 * v20;
+double v163 = v158 + v162;
+double v164 = v163 * v15;
+double v165 = v5 * v148;
+double v166 = v82 * v165;
+double v167 = v166 * v14;
+double v168 = v166 * v4;
+double v169 = v168 * v13;
+double v170 = v167 + v169;
+double v171 = v170 * v33;
+double v172 = v164 + v171;
+double v173 = v154 + v172;
+double v174 = v173 * v42;
+double v175 = v150 * v17;
+double v176 = -v150;
+double v177 = v176 * v16;
+double v178 = v175 + v177;
+double v179 = v157 * v19;
+double v180 = v156 * v20;
+double v181 = v179 + v180;
+double v182 = v178 + v181;
+double v183 = v182 * v15;
+double v184 = v170 * v22;
+double v185 = v183 + v184;
+double v186 = -v185;
+double v187 = v186 * v26;
+double v188 = -v27;
+double v189 = v187 + v188;
+double v190 = -v173;
+double v191 = v190 * v0;
+double v192 = v189 + v191;
+double v193 = -v192;
+double v194 = v193 * v113;
+double v195 = v148 * v11;
+double v196 = v195 + v195;
+double v197 = v196 * v117;
+double v198 = v194 - v197;
+double v199 = v198 * v35;
+double v200 = v174 + v199;
+double v201 = v157 * v29;
+double v202 = v152 * v20;
+double v203 = v201 + v202;
+double v204 = v150 * v31;
+double v205 = v160 * v16;
+double v206 = v204 + v205;
+double v207 = v206 * v15;
+double v208 = v170 * v48;
+double v209 = v207 + v208;
+double v210 = v203 + v209;
+double v211 = v210 * v55;
+double v212 = v186 * v2;
+double v213 = -v210;
+double v214 = v213 * v46;
+double v215 = v212 + v214;
+double v216 = v0 + v215;
+double v217 = v216 * v113;
+double v218 = v196 * v141;
+double v219 = v217 - v218;
+double v220 = v219 * v50;
+double v221 = v211 + v220;
+double v222 = v200 + v221;
+double v223 = v2 + v2;
+double v224 = v58 * v223;
+double v225 = v224 * v61;
+double v226 = v74 - v225;
+double v227 = v226 * v29;
+double v228 = v65 * v224;
+double v229 = v228 * v16;
+double v230 = v227 + v229;
+double v231 = v224 * v69;
+double v232 = -v231;
+double v233 = -v232;
+double v234 = v233 * v32;
+double v235 = v224 * v75;
+double v236 = -v235;
+double v237 = -v236;
+double v238 = v237 * v20;
+double v239 = v234 + v238;
+double v240 = v239 * v15;
+double v241 = v5 * v224;
+double v242 = v82 * v241;
+double v243 = v242 * v14;
+double v244 = v242 * v4;
+double v245 = v244 * v13;
+double v246 = v243 + v245;
+double v247 = v246 * v33;
+double v248 = v240 + v247;
+double v249 = v230 + v248;
+double v250 = v249 * v42;
+double v251 = v226 * v17;
+double v252 = -v226;
+double v253 = v252 * v16;
+double v254 = v251 + v253;
+double v255 = v233 * v19;
+double v256 = v232 * v20;
+double v257 = v255 + v256;
+double v258 = v254 + v257;
+double v259 = v258 * v15;
+double v260 = v246 * v22;
+double v261 = v259 + v260;
+double v262 = -v261;
+double v263 = v262 * v26;
+double v264 = -v249;
+double v265 = v264 * v0;
+double v266 = v263 + v265;
+double v267 = v0 + v266;
+double v268 = -v267;
+double v269 = v268 * v113;
+double v270 = v224 * v11;
+double v271 = v270 + v270;
+double v272 = v271 * v117;
+double v273 = v269 - v272;
+double v274 = v273 * v35;
+double v275 = v250 + v274;
+double v276 = v233 * v29;
+double v277 = v228 * v20;
+double v278 = v276 + v277;
+double v279 = v226 * v31;
+double v280 = v236 * v16;
+double v281 = v279 + v280;
+double v282 = v281 * v15;
+double v283 = v246 * v48;
+double v284 = v282 + v283;
+double v285 = v278 + v284;
+double v286 = v285 * v55;
+double v287 = v262 * v2;
+double v288 = v287 + v27;
+double v289 = -v285;
+double v290 = v289 * v46;
+double v291 = v288 + v290;
+double v292 = v291 * v113;
+double v293 = v271 * v141;
+double v294 = v292 - v293;
+double v295 = v294 * v50;
+double v296 = v286 + v295;
+double v297 = v275 + v296;
+double v298 = v1 * v2;
+double v299 = v29 * v17;
+double v300 = v19 * v31;
+double v301 = v15 * v300;
+double v302 = v299 + v301;
+double v303 = -v302;
+double v304 = v26 * v303;
+double v305 = v32 * v31;
+double v306 = v18 + v305;
+double v307 = v15 * v306;
+double v308 = v3 + v307;
+double v309 = v3 - v308;
+double v310 = v0 * v309;
+double v311 = v304 + v310;
+double v312 = v298 + v311;
+double v313 = -v312;
+double v314 = v313 / v41;
+double v316 = v2 * v303;
+double v317 = v29 * v31;
+double v318 = v20 * v17;
+double v319 = v15 * v318;
+double v320 = v317 + v319;
+double v321 = -v320;
+double v322 = v46 * v321;
+double v323 = v316 + v322;
+double v324 = v7 + v323;
+double v325 = v324 / v41;
+double v328 = v91 * v314;
+double v329 = v94 * v29;
+double v330 = v66 * v17;
+double v331 = v329 + v330;
+double v332 = v77 * v19;
+double v333 = v71 * v31;
+double v334 = v332 + v333;
+double v335 = v334 * v15;
+double v336 = v88 * v300;
+double v337 = v335 + v336;
+double v338 = v331 + v337;
+double v339 = -v338;
+double v340 = v339 * v26;
+double v341 = v77 * v32;
+double v342 = v78 * v31;
+double v343 = v341 + v342;
+double v344 = v96 + v343;
+double v345 = v344 * v15;
+double v346 = v88 * v306;
+double v347 = v345 + v346;
+double v348 = -v347;
+double v349 = v348 * v0;
+double v350 = v349 + v309;
+double v351 = v340 + v350;
+double v352 = -v351;
+double v353 = v352 * v113;
+double v354 = v313 / v112;
+double v355 = v116 * v354;
+double v356 = v353 - v355;
+double v357 = v356 * v35;
+double v358 = v328 + v357;
+double v359 = v131 * v325;
+double v360 = v339 * v2;
+double v361 = v77 * v29;
+double v362 = v66 * v31;
+double v363 = v361 + v362;
+double v364 = v94 * v20;
+double v365 = v72 * v17;
+double v366 = v364 + v365;
+double v367 = v366 * v15;
+double v368 = v88 * v318;
+double v369 = v367 + v368;
+double v370 = v363 + v369;
+double v371 = -v370;
+double v372 = v371 * v46;
+double v373 = -v321;
+double v374 = v372 + v373;
+double v375 = v360 + v374;
+double v376 = v375 * v113;
+double v377 = v324 / v112;
+double v378 = v116 * v377;
+double v379 = v376 - v378;
+double v380 = v379 * v50;
+double v381 = v359 + v380;
+double v382 = v358 + v381;
+double v383 = v173 * v314;
+double v384 = v176 * v29;
+double v385 = v152 * v17;
+double v386 = v384 + v385;
+double v387 = v160 * v19;
+double v388 = v156 * v31;
+double v389 = v387 + v388;
+double v390 = v389 * v15;
+double v391 = v170 * v300;
+double v392 = v390 + v391;
+double v393 = v386 + v392;
+double v394 = -v393;
+double v395 = v394 * v26;
+double v396 = -v303;
+double v397 = v395 + v396;
+double v398 = v160 * v32;
+double v399 = v161 * v31;
+double v400 = v398 + v399;
+double v401 = v178 + v400;
+double v402 = v401 * v15;
+double v403 = v170 * v306;
+double v404 = v402 + v403;
+double v405 = -v404;
+double v406 = v405 * v0;
+double v407 = v397 + v406;
+double v408 = v2 + v407;
+double v409 = -v408;
+double v410 = v409 * v113;
+double v411 = v196 * v354;
+double v412 = v410 - v411;
+double v413 = v412 * v35;
+double v414 = v383 + v413;
+double v415 = v210 * v325;
+double v416 = v394 * v2;
+double v417 = v160 * v29;
+double v418 = v152 * v31;
+double v419 = v417 + v418;
+double v420 = v176 * v20;
+double v421 = v157 * v17;
+double v422 = v420 + v421;
+double v423 = v422 * v15;
+double v424 = v170 * v318;
+double v425 = v423 + v424;
+double v426 = v419 + v425;
+double v427 = -v426;
+double v428 = v427 * v46;
+double v429 = v416 + v428;
+double v430 = v147 + v429;
+double v431 = v430 * v113;
+double v432 = v196 * v377;
+double v433 = v431 - v432;
+double v434 = v433 * v50;
+double v435 = v415 + v434;
+double v436 = v414 + v435;
+double v437 = v249 * v314;
+double v438 = v252 * v29;
+double v439 = v228 * v17;
+double v440 = v438 + v439;
+double v441 = v236 * v19;
+double v442 = v232 * v31;
+double v443 = v441 + v442;
+double v444 = v443 * v15;
+double v445 = v246 * v300;
+double v446 = v444 + v445;
+double v447 = v440 + v446;
+double v448 = -v447;
+double v449 = v448 * v26;
+double v450 = v236 * v32;
+double v451 = v237 * v31;
+double v452 = v450 + v451;
+double v453 = v254 + v452;
+double v454 = v453 * v15;
+double v455 = v246 * v306;
+double v456 = v454 + v455;
+double v457 = -v456;
+double v458 = v457 * v0;
+double v459 = v449 + v458;
+double v460 = v1 + v459;
+double v461 = -v460;
+double v462 = v461 * v113;
+double v463 = v271 * v354;
+double v464 = v462 - v463;
+double v465 = v464 * v35;
+double v466 = v437 + v465;
+double v467 = v285 * v325;
+double v468 = v448 * v2;
+double v469 = v468 + v303;
+double v470 = v236 * v29;
+double v471 = v228 * v31;
+double v472 = v470 + v471;
+double v473 = v252 * v20;
+double v474 = v233 * v17;
+double v475 = v473 + v474;
+double v476 = v475 * v15;
+double v477 = v246 * v318;
+double v478 = v476 + v477;
+double v479 = v472 + v478;
+double v480 = -v479;
+double v481 = v480 * v46;
+double v482 = v469 + v481;
+double v483 = v482 * v113;
+double v484 = v271 * v377;
+double v485 = v483 - v484;
+double v486 = v485 * v50;
+double v487 = v467 + v486;
+double v488 = v466 + v487;
+double v489 = v29 * v19;
+double v490 = v17 * v32;
+double v491 = v15 * v490;
+double v492 = v489 + v491;
+double v493 = -v492;
+double v494 = v26 * v493;
+double v495 = v29 * v32;
+double v496 = v16 * v19;
+double v497 = v15 * v496;
+double v498 = v495 + v497;
+double v499 = -v498;
+double v500 = v0 * v499;
+double v501 = v494 + v500;
+double v502 = v8 + v501;
+double v503 = -v502;
+double v504 = v503 / v41;
+double v506 = v2 * v493;
+double v507 = v21 + v305;
+double v508 = v15 * v507;
+double v509 = v3 + v508;
+double v510 = v3 - v509;
+double v511 = v46 * v510;
+double v512 = v506 + v511;
+double v513 = v298 + v512;
+double v514 = v513 / v41;
+double v517 = v91 * v504;
+double v518 = v71 * v29;
+double v519 = v66 * v19;
+double v520 = v518 + v519;
+double v521 = v78 * v17;
+double v522 = v94 * v32;
+double v523 = v521 + v522;
+double v524 = v523 * v15;
+double v525 = v88 * v490;
+double v526 = v524 + v525;
+double v527 = v520 + v526;
+double v528 = -v527;
+double v529 = v528 * v26;
+double v530 = v78 * v29;
+double v531 = v66 * v32;
+double v532 = v530 + v531;
+double v533 = v71 * v16;
+double v534 = v63 * v19;
+double v535 = v533 + v534;
+double v536 = v535 * v15;
+double v537 = v88 * v496;
+double v538 = v536 + v537;
+double v539 = v532 + v538;
+double v540 = -v539;
+double v541 = v540 * v0;
+double v542 = v541 + v499;
+double v543 = v529 + v542;
+double v544 = -v543;
+double v545 = v544 * v113;
+double v546 = v503 / v112;
+double v547 = v116 * v546;
+double v548 = v545 - v547;
+double v549 = v548 * v35;
+double v550 = v517 + v549;
+double v551 = v131 * v514;
+double v552 = v528 * v2;
+double v553 = v99 + v343;
+double v554 = v553 * v15;
+double v555 = v88 * v507;
+double v556 = v554 + v555;
+double v557 = -v556;
+double v558 = v557 * v46;
+double v559 = -v510;
+double v560 = v558 + v559;
+double v561 = v552 + v560;
+double v562 = v561 * v113;
+double v563 = v513 / v112;
+double v564 = v116 * v563;
+double v565 = v562 - v564;
+double v566 = v565 * v50;
+double v567 = v551 + v566;
+double v568 = v550 + v567;
+double v569 = v173 * v504;
+double v570 = v156 * v29;
+double v571 = v152 * v19;
+double v572 = v570 + v571;
+double v573 = v161 * v17;
+double v574 = v176 * v32;
+double v575 = v573 + v574;
+double v576 = v575 * v15;
+double v577 = v170 * v490;
+double v578 = v576 + v577;
+double v579 = v572 + v578;
+double v580 = -v579;
+double v581 = v580 * v26;
+double v582 = -v493;
+double v583 = v581 + v582;
+double v584 = v161 * v29;
+double v585 = v152 * v32;
+double v586 = v584 + v585;
+double v587 = v156 * v16;
+double v588 = v150 * v19;
+double v589 = v587 + v588;
+double v590 = v589 * v15;
+double v591 = v170 * v496;
+double v592 = v590 + v591;
+double v593 = v586 + v592;
+double v594 = -v593;
+double v595 = v594 * v0;
+double v596 = v583 + v595;
+double v597 = -v596;
+double v598 = v597 * v113;
+double v599 = v196 * v546;
+double v600 = v598 - v599;
+double v601 = v600 * v35;
+double v602 = v569 + v601;
+double v603 = v210 * v514;
+double v604 = v580 * v2;
+double v605 = v181 + v400;
+double v606 = v605 * v15;
+double v607 = v170 * v507;
+double v608 = v606 + v607;
+double v609 = -v608;
+double v610 = v609 * v46;
+double v611 = v604 + v610;
+double v612 = v2 + v611;
+double v613 = v612 * v113;
+double v614 = v196 * v563;
+double v615 = v613 - v614;
+double v616 = v615 * v50;
+double v617 = v603 + v616;
+double v618 = v602 + v617;
+double v619 = v249 * v504;
+double v620 = v232 * v29;
+double v621 = v228 * v19;
+double v622 = v620 + v621;
+double v623 = v237 * v17;
+double v624 = v252 * v32;
+double v625 = v623 + v624;
+double v626 = v625 * v15;
+double v627 = v246 * v490;
+double v628 = v626 + v627;
+double v629 = v622 + v628;
+double v630 = -v629;
+double v631 = v630 * v26;
+double v632 = v237 * v29;
+double v633 = v228 * v32;
+double v634 = v632 + v633;
+double v635 = v232 * v16;
+double v636 = v226 * v19;
+double v637 = v635 + v636;
+double v638 = v637 * v15;
+double v639 = v246 * v496;
+double v640 = v638 + v639;
+double v641 = v634 + v640;
+double v642 = -v641;
+double v643 = v642 * v0;
+double v644 = v631 + v643;
+double v645 = v223 + v644;
+double v646 = -v645;
+double v647 = v646 * v113;
+double v648 = v271 * v546;
+double v649 = v647 - v648;
+double v650 = v649 * v35;
+double v651 = v619 + v650;
+double v652 = v285 * v514;
+double v653 = v630 * v2;
+double v654 = v653 + v493;
+double v655 = v257 + v452;
+double v656 = v655 * v15;
+double v657 = v246 * v507;
+double v658 = v656 + v657;
+double v659 = -v658;
+double v660 = v659 * v46;
+double v661 = v654 + v660;
+double v662 = v1 + v661;
+double v663 = v662 * v113;
+double v664 = v271 * v563;
+double v665 = v663 - v664;
+double v666 = v665 * v50;
+double v667 = v652 + v666;
+double v668 = v651 + v667;
+double v672 = v347 * v42;
+double v673 = v119 * v308;
+double v674 = v672 + v673;
+double v675 = v370 * v55;
+double v676 = v143 * v320;
+double v677 = v675 + v676;
+double v678 = v674 + v677;
+double v679 = v404 * v42;
+double v680 = v198 * v308;
+double v681 = v679 + v680;
+double v682 = v426 * v55;
+double v683 = v219 * v320;
+double v684 = v682 + v683;
+double v685 = v681 + v684;
+double v686 = v456 * v42;
+double v687 = v273 * v308;
+double v688 = v686 + v687;
+double v689 = v479 * v55;
+double v690 = v294 * v320;
+double v691 = v689 + v690;
+double v692 = v688 + v691;
+double v696 = v347 * v314;
+double v697 = v356 * v308;
+double v698 = v696 + v697;
+double v699 = v370 * v325;
+double v700 = v379 * v320;
+double v701 = v699 + v700;
+double v702 = v698 + v701;
+double v703 = v404 * v314;
+double v704 = v412 * v308;
+double v705 = v703 + v704;
+double v706 = v426 * v325;
+double v707 = v433 * v320;
+double v708 = v706 + v707;
+double v709 = v705 + v708;
+double v710 = v456 * v314;
+double v711 = v464 * v308;
+double v712 = v710 + v711;
+double v713 = v479 * v325;
+double v714 = v485 * v320;
+double v715 = v713 + v714;
+double v716 = v712 + v715;
+double v720 = v347 * v504;
+double v721 = v548 * v308;
+double v722 = v720 + v721;
+double v723 = v370 * v514;
+double v724 = v565 * v320;
+double v725 = v723 + v724;
+double v726 = v722 + v725;
+double v727 = v404 * v504;
+double v728 = v600 * v308;
+double v729 = v727 + v728;
+double v730 = v426 * v514;
+double v731 = v615 * v320;
+double v732 = v730 + v731;
+double v733 = v729 + v732;
+double v734 = v456 * v504;
+double v735 = v649 * v308;
+double v736 = v734 + v735;
+double v737 = v479 * v514;
+double v738 = v665 * v320;
+double v739 = v737 + v738;
+double v740 = v736 + v739;
+double v744 = v539 * v42;
+double v745 = v119 * v498;
+double v746 = v744 + v745;
+double v747 = v556 * v55;
+double v748 = v143 * v509;
+double v749 = v747 + v748;
+double v750 = v746 + v749;
+double v751 = v593 * v42;
+double v752 = v198 * v498;
+double v753 = v751 + v752;
+double v754 = v608 * v55;
+double v755 = v219 * v509;
+double v756 = v754 + v755;
+double v757 = v753 + v756;
+double v758 = v641 * v42;
+double v759 = v273 * v498;
+double v760 = v758 + v759;
+double v761 = v658 * v55;
+double v762 = v294 * v509;
+double v763 = v761 + v762;
+double v764 = v760 + v763;
+double v768 = v539 * v314;
+double v769 = v356 * v498;
+double v770 = v768 + v769;
+double v771 = v556 * v325;
+double v772 = v379 * v509;
+double v773 = v771 + v772;
+double v774 = v770 + v773;
+double v775 = v593 * v314;
+double v776 = v412 * v498;
+double v777 = v775 + v776;
+double v778 = v608 * v325;
+double v779 = v433 * v509;
+double v780 = v778 + v779;
+double v781 = v777 + v780;
+double v782 = v641 * v314;
+double v783 = v464 * v498;
+double v784 = v782 + v783;
+double v785 = v658 * v325;
+double v786 = v485 * v509;
+double v787 = v785 + v786;
+double v788 = v784 + v787;
+double v792 = v539 * v504;
+double v793 = v548 * v498;
+double v794 = v792 + v793;
+double v795 = v556 * v514;
+double v796 = v565 * v509;
+double v797 = v795 + v796;
+double v798 = v794 + v797;
+double v799 = v593 * v504;
+double v800 = v600 * v498;
+double v801 = v799 + v800;
+double v802 = v608 * v514;
+double v803 = v615 * v509;
+double v804 = v802 + v803;
+double v805 = v801 + v804;
+double v806 = v641 * v504;
+double v807 = v649 * v498;
+double v808 = v806 + v807;
+double v809 = v658 * v514;
+double v810 = v665 * v509;
+double v811 = v809 + v810;
+double v812 = v808 + v811;
+double v813 = v39 / v41;
+double v815 = -v2;
+double v816 = v815 * v36;
+double v817 = v1 * v51;
+double v818 = v816 + v817;
+double v819 = v6 + v818;
+double v820 = -v819;
+double v821 = v820 / v41;
+double v824 = v103 * v813;
+double v825 = v110 * v113;
+double v826 = v39 / v112;
+double v827 = v116 * v826;
+double v828 = v825 - v827;
+double v829 = v828 * v24;
+double v830 = v824 + v829;
+double v831 = v131 * v821;
+double v832 = v106 * v815;
+double v833 = v134 * v1;
+double v834 = v832 + v833;
+double v835 = v59 + v834;
+double v836 = -v835;
+double v837 = v836 * v113;
+double v838 = v820 / v112;
+double v839 = v116 * v838;
+double v840 = v837 - v839;
+double v841 = v840 * v50;
+double v842 = v831 + v841;
+double v843 = v830 + v842;
+double v844 = v185 * v813;
+double v845 = v192 * v113;
+double v846 = v196 * v826;
+double v847 = v845 - v846;
+double v848 = v847 * v24;
+double v849 = v844 + v848;
+double v850 = v210 * v821;
+double v851 = v190 * v815;
+double v852 = v213 * v1;
+double v853 = v852 + v51;
+double v854 = v851 + v853;
+double v855 = -v854;
+double v856 = v855 * v113;
+double v857 = v196 * v838;
+double v858 = v856 - v857;
+double v859 = v858 * v50;
+double v860 = v850 + v859;
+double v861 = v849 + v860;
+double v862 = v261 * v813;
+double v863 = v267 * v113;
+double v864 = v271 * v826;
+double v865 = v863 - v864;
+double v866 = v865 * v24;
+double v867 = v862 + v866;
+double v868 = v285 * v821;
+double v869 = v264 * v815;
+double v870 = -v36;
+double v871 = v869 + v870;
+double v872 = v289 * v1;
+double v873 = v871 + v872;
+double v874 = -v873;
+double v875 = v874 * v113;
+double v876 = v271 * v838;
+double v877 = v875 - v876;
+double v878 = v877 * v50;
+double v879 = v868 + v878;
+double v880 = v867 + v879;
+double v881 = v312 / v41;
+double v883 = v815 * v309;
+double v884 = v1 * v321;
+double v885 = v883 + v884;
+double v886 = v44 + v885;
+double v887 = -v886;
+double v888 = v887 / v41;
+double v891 = v103 * v881;
+double v892 = v351 * v113;
+double v893 = v312 / v112;
+double v894 = v116 * v893;
+double v895 = v892 - v894;
+double v896 = v895 * v24;
+double v897 = v891 + v896;
+double v898 = v131 * v888;
+double v899 = v348 * v815;
+double v900 = v371 * v1;
+double v901 = v899 + v900;
+double v902 = v1 + v901;
+double v903 = -v902;
+double v904 = v903 * v113;
+double v905 = v887 / v112;
+double v906 = v116 * v905;
+double v907 = v904 - v906;
+double v908 = v907 * v50;
+double v909 = v898 + v908;
+double v910 = v897 + v909;
+double v911 = v185 * v881;
+double v912 = v408 * v113;
+double v913 = v196 * v893;
+double v914 = v912 - v913;
+double v915 = v914 * v24;
+double v916 = v911 + v915;
+double v917 = v210 * v888;
+double v918 = v405 * v815;
+double v919 = v427 * v1;
+double v920 = v919 + v321;
+double v921 = v918 + v920;
+double v922 = v0 + v921;
+double v923 = -v922;
+double v924 = v923 * v113;
+double v925 = v196 * v905;
+double v926 = v924 - v925;
+double v927 = v926 * v50;
+double v928 = v917 + v927;
+double v929 = v916 + v928;
+double v930 = v261 * v881;
+double v931 = v460 * v113;
+double v932 = v271 * v893;
+double v933 = v931 - v932;
+double v934 = v933 * v24;
+double v935 = v930 + v934;
+double v936 = v285 * v888;
+double v937 = v457 * v815;
+double v938 = -v309;
+double v939 = v937 + v938;
+double v940 = v480 * v1;
+double v941 = v939 + v940;
+double v942 = -v941;
+double v943 = v942 * v113;
+double v944 = v271 * v905;
+double v945 = v943 - v944;
+double v946 = v945 * v50;
+double v947 = v936 + v946;
+double v948 = v935 + v947;
+double v949 = v502 / v41;
+double v951 = v815 * v499;
+double v952 = v1 * v510;
+double v953 = v951 + v952;
+double v954 = v25 + v953;
+double v955 = -v954;
+double v956 = v955 / v41;
+double v959 = v103 * v949;
+double v960 = v543 * v113;
+double v961 = v502 / v112;
+double v962 = v116 * v961;
+double v963 = v960 - v962;
+double v964 = v963 * v24;
+double v965 = v959 + v964;
+double v966 = v131 * v956;
+double v967 = v540 * v815;
+double v968 = v557 * v1;
+double v969 = v967 + v968;
+double v970 = v2 + v969;
+double v971 = -v970;
+double v972 = v971 * v113;
+double v973 = v955 / v112;
+double v974 = v116 * v973;
+double v975 = v972 - v974;
+double v976 = v975 * v50;
+double v977 = v966 + v976;
+double v978 = v965 + v977;
+double v979 = v185 * v949;
+double v980 = v596 * v113;
+double v981 = v196 * v961;
+double v982 = v980 - v981;
+double v983 = v982 * v24;
+double v984 = v979 + v983;
+double v985 = v210 * v956;
+double v986 = v594 * v815;
+double v987 = v609 * v1;
+double v988 = v987 + v510;
+double v989 = v986 + v988;
+double v990 = -v989;
+double v991 = v990 * v113;
+double v992 = v196 * v973;
+double v993 = v991 - v992;
+double v994 = v993 * v50;
+double v995 = v985 + v994;
+double v996 = v984 + v995;
+double v997 = v261 * v949;
+double v998 = v645 * v113;
+double v999 = v271 * v961;
+double v1000 = v998 - v999;
+double v1001 = v1000 * v24;
+double v1002 = v997 + v1001;
+double v1003 = v285 * v956;
+double v1004 = v642 * v815;
+double v1005 = -v499;
+double v1006 = v1004 + v1005;
+double v1007 = v659 * v1;
+double v1008 = v1006 + v1007;
+double v1009 = v0 + v1008;
+double v1010 = -v1009;
+double v1011 = v1010 * v113;
+double v1012 = v271 * v973;
+double v1013 = v1011 - v1012;
+double v1014 = v1013 * v50;
+double v1015 = v1003 + v1014;
+double v1016 = v1002 + v1015;
+double v1020 = v338 * v813;
+double v1021 = v828 * v302;
+double v1022 = v1020 + v1021;
+double v1023 = v370 * v821;
+double v1024 = v840 * v320;
+double v1025 = v1023 + v1024;
+double v1026 = v1022 + v1025;
+double v1027 = v393 * v813;
+double v1028 = v847 * v302;
+double v1029 = v1027 + v1028;
+double v1030 = v426 * v821;
+double v1031 = v858 * v320;
+double v1032 = v1030 + v1031;
+double v1033 = v1029 + v1032;
+double v1034 = v447 * v813;
+double v1035 = v865 * v302;
+double v1036 = v1034 + v1035;
+double v1037 = v479 * v821;
+double v1038 = v877 * v320;
+double v1039 = v1037 + v1038;
+double v1040 = v1036 + v1039;
+double v1044 = v338 * v881;
+double v1045 = v895 * v302;
+double v1046 = v1044 + v1045;
+double v1047 = v370 * v888;
+double v1048 = v907 * v320;
+double v1049 = v1047 + v1048;
+double v1050 = v1046 + v1049;
+double v1051 = v393 * v881;
+double v1052 = v914 * v302;
+double v1053 = v1051 + v1052;
+double v1054 = v426 * v888;
+double v1055 = v926 * v320;
+double v1056 = v1054 + v1055;
+double v1057 = v1053 + v1056;
+double v1058 = v447 * v881;
+double v1059 = v933 * v302;
+double v1060 = v1058 + v1059;
+double v1061 = v479 * v888;
+double v1062 = v945 * v320;
+double v1063 = v1061 + v1062;
+double v1064 = v1060 + v1063;
+double v1068 = v338 * v949;
+double v1069 = v963 * v302;
+double v1070 = v1068 + v1069;
+double v1071 = v370 * v956;
+double v1072 = v975 * v320;
+double v1073 = v1071 + v1072;
+double v1074 = v1070 + v1073;
+double v1075 = v393 * v949;
+double v1076 = v982 * v302;
+double v1077 = v1075 + v1076;
+double v1078 = v426 * v956;
+double v1079 = v993 * v320;
+double v1080 = v1078 + v1079;
+double v1081 = v1077 + v1080;
+double v1082 = v447 * v949;
+double v1083 = v1000 * v302;
+double v1084 = v1082 + v1083;
+double v1085 = v479 * v956;
+double v1086 = v1013 * v320;
+double v1087 = v1085 + v1086;
+double v1088 = v1084 + v1087;
+double v1092 = v527 * v813;
+double v1093 = v828 * v492;
+double v1094 = v1092 + v1093;
+double v1095 = v556 * v821;
+double v1096 = v840 * v509;
+double v1097 = v1095 + v1096;
+double v1098 = v1094 + v1097;
+double v1099 = v579 * v813;
+double v1100 = v847 * v492;
+double v1101 = v1099 + v1100;
+double v1102 = v608 * v821;
+double v1103 = v858 * v509;
+double v1104 = v1102 + v1103;
+double v1105 = v1101 + v1104;
+double v1106 = v629 * v813;
+double v1107 = v865 * v492;
+double v1108 = v1106 + v1107;
+double v1109 = v658 * v821;
+double v1110 = v877 * v509;
+double v1111 = v1109 + v1110;
+double v1112 = v1108 + v1111;
+double v1116 = v527 * v881;
+double v1117 = v895 * v492;
+double v1118 = v1116 + v1117;
+double v1119 = v556 * v888;
+double v1120 = v907 * v509;
+double v1121 = v1119 + v1120;
+double v1122 = v1118 + v1121;
+double v1123 = v579 * v881;
+double v1124 = v914 * v492;
+double v1125 = v1123 + v1124;
+double v1126 = v608 * v888;
+double v1127 = v926 * v509;
+double v1128 = v1126 + v1127;
+double v1129 = v1125 + v1128;
+double v1130 = v629 * v881;
+double v1131 = v933 * v492;
+double v1132 = v1130 + v1131;
+double v1133 = v658 * v888;
+double v1134 = v945 * v509;
+double v1135 = v1133 + v1134;
+double v1136 = v1132 + v1135;
+double v1140 = v527 * v949;
+double v1141 = v963 * v492;
+double v1142 = v1140 + v1141;
+double v1143 = v556 * v956;
+double v1144 = v975 * v509;
+double v1145 = v1143 + v1144;
+double v1146 = v1142 + v1145;
+double v1147 = v579 * v949;
+double v1148 = v982 * v492;
+double v1149 = v1147 + v1148;
+double v1150 = v608 * v956;
+double v1151 = v993 * v509;
+double v1152 = v1150 + v1151;
+double v1153 = v1149 + v1152;
+double v1154 = v629 * v949;
+double v1155 = v1000 * v492;
+double v1156 = v1154 + v1155;
+double v1157 = v658 * v956;
+double v1158 = v1013 * v509;
+double v1159 = v1157 + v1158;
+double v1160 = v1156 + v1159;
+double v1161 = -v54;
+double v1162 = v1161 / v41;
+double v1164 = v819 / v41;
+double v1167 = v103 * v1162;
+double v1168 = -v139;
+double v1169 = v1168 * v113;
+double v1170 = v1161 / v112;
+double v1171 = v116 * v1170;
+double v1172 = v1169 - v1171;
+double v1173 = v1172 * v24;
+double v1174 = v1167 + v1173;
+double v1175 = v91 * v1164;
+double v1176 = v835 * v113;
+double v1177 = v819 / v112;
+double v1178 = v116 * v1177;
+double v1179 = v1176 - v1178;
+double v1180 = v1179 * v35;
+double v1181 = v1175 + v1180;
+double v1182 = v1174 + v1181;
+double v1183 = v185 * v1162;
+double v1184 = -v216;
+double v1185 = v1184 * v113;
+double v1186 = v196 * v1170;
+double v1187 = v1185 - v1186;
+double v1188 = v1187 * v24;
+double v1189 = v1183 + v1188;
+double v1190 = v173 * v1164;
+double v1191 = v854 * v113;
+double v1192 = v196 * v1177;
+double v1193 = v1191 - v1192;
+double v1194 = v1193 * v35;
+double v1195 = v1190 + v1194;
+double v1196 = v1189 + v1195;
+double v1197 = v261 * v1162;
+double v1198 = -v291;
+double v1199 = v1198 * v113;
+double v1200 = v271 * v1170;
+double v1201 = v1199 - v1200;
+double v1202 = v1201 * v24;
+double v1203 = v1197 + v1202;
+double v1204 = v249 * v1164;
+double v1205 = v873 * v113;
+double v1206 = v271 * v1177;
+double v1207 = v1205 - v1206;
+double v1208 = v1207 * v35;
+double v1209 = v1204 + v1208;
+double v1210 = v1203 + v1209;
+double v1211 = -v324;
+double v1212 = v1211 / v41;
+double v1214 = v886 / v41;
+double v1217 = v103 * v1212;
+double v1218 = -v375;
+double v1219 = v1218 * v113;
+double v1220 = v1211 / v112;
+double v1221 = v116 * v1220;
+double v1222 = v1219 - v1221;
+double v1223 = v1222 * v24;
+double v1224 = v1217 + v1223;
+double v1225 = v91 * v1214;
+double v1226 = v902 * v113;
+double v1227 = v886 / v112;
+double v1228 = v116 * v1227;
+double v1229 = v1226 - v1228;
+double v1230 = v1229 * v35;
+double v1231 = v1225 + v1230;
+double v1232 = v1224 + v1231;
+double v1233 = v185 * v1212;
+double v1234 = -v430;
+double v1235 = v1234 * v113;
+double v1236 = v196 * v1220;
+double v1237 = v1235 - v1236;
+double v1238 = v1237 * v24;
+double v1239 = v1233 + v1238;
+double v1240 = v173 * v1214;
+double v1241 = v922 * v113;
+double v1242 = v196 * v1227;
+double v1243 = v1241 - v1242;
+double v1244 = v1243 * v35;
+double v1245 = v1240 + v1244;
+double v1246 = v1239 + v1245;
+double v1247 = v261 * v1212;
+double v1248 = -v482;
+double v1249 = v1248 * v113;
+double v1250 = v271 * v1220;
+double v1251 = v1249 - v1250;
+double v1252 = v1251 * v24;
+double v1253 = v1247 + v1252;
+double v1254 = v249 * v1214;
+double v1255 = v941 * v113;
+double v1256 = v271 * v1227;
+double v1257 = v1255 - v1256;
+double v1258 = v1257 * v35;
+double v1259 = v1254 + v1258;
+double v1260 = v1253 + v1259;
+double v1261 = -v513;
+double v1262 = v1261 / v41;
+double v1264 = v954 / v41;
+double v1267 = v103 * v1262;
+double v1268 = -v561;
+double v1269 = v1268 * v113;
+double v1270 = v1261 / v112;
+double v1271 = v116 * v1270;
+double v1272 = v1269 - v1271;
+double v1273 = v1272 * v24;
+double v1274 = v1267 + v1273;
+double v1275 = v91 * v1264;
+double v1276 = v970 * v113;
+double v1277 = v954 / v112;
+double v1278 = v116 * v1277;
+double v1279 = v1276 - v1278;
+double v1280 = v1279 * v35;
+double v1281 = v1275 + v1280;
+double v1282 = v1274 + v1281;
+double v1283 = v185 * v1262;
+double v1284 = -v612;
+double v1285 = v1284 * v113;
+double v1286 = v196 * v1270;
+double v1287 = v1285 - v1286;
+double v1288 = v1287 * v24;
+double v1289 = v1283 + v1288;
+double v1290 = v173 * v1264;
+double v1291 = v989 * v113;
+double v1292 = v196 * v1277;
+double v1293 = v1291 - v1292;
+double v1294 = v1293 * v35;
+double v1295 = v1290 + v1294;
+double v1296 = v1289 + v1295;
+double v1297 = v261 * v1262;
+double v1298 = -v662;
+double v1299 = v1298 * v113;
+double v1300 = v271 * v1270;
+double v1301 = v1299 - v1300;
+double v1302 = v1301 * v24;
+double v1303 = v1297 + v1302;
+double v1304 = v249 * v1264;
+double v1305 = v1009 * v113;
+double v1306 = v271 * v1277;
+double v1307 = v1305 - v1306;
+double v1308 = v1307 * v35;
+double v1309 = v1304 + v1308;
+double v1310 = v1303 + v1309;
+double v1314 = v338 * v1162;
+double v1315 = v1172 * v302;
+double v1316 = v1314 + v1315;
+double v1317 = v347 * v1164;
+double v1318 = v1179 * v308;
+double v1319 = v1317 + v1318;
+double v1320 = v1316 + v1319;
+double v1321 = v393 * v1162;
+double v1322 = v1187 * v302;
+double v1323 = v1321 + v1322;
+double v1324 = v404 * v1164;
+double v1325 = v1193 * v308;
+double v1326 = v1324 + v1325;
+double v1327 = v1323 + v1326;
+double v1328 = v447 * v1162;
+double v1329 = v1201 * v302;
+double v1330 = v1328 + v1329;
+double v1331 = v456 * v1164;
+double v1332 = v1207 * v308;
+double v1333 = v1331 + v1332;
+double v1334 = v1330 + v1333;
+double v1338 = v338 * v1212;
+double v1339 = v1222 * v302;
+double v1340 = v1338 + v1339;
+double v1341 = v347 * v1214;
+double v1342 = v1229 * v308;
+double v1343 = v1341 + v1342;
+double v1344 = v1340 + v1343;
+double v1345 = v393 * v1212;
+double v1346 = v1237 * v302;
+double v1347 = v1345 + v1346;
+double v1348 = v404 * v1214;
+double v1349 = v1243 * v308;
+double v1350 = v1348 + v1349;
+double v1351 = v1347 + v1350;
+double v1352 = v447 * v1212;
+double v1353 = v1251 * v302;
+double v1354 = v1352 + v1353;
+double v1355 = v456 * v1214;
+double v1356 = v1257 * v308;
+double v1357 = v1355 + v1356;
+double v1358 = v1354 + v1357;
+double v1362 = v338 * v1262;
+double v1363 = v1272 * v302;
+double v1364 = v1362 + v1363;
+double v1365 = v347 * v1264;
+double v1366 = v1279 * v308;
+double v1367 = v1365 + v1366;
+double v1368 = v1364 + v1367;
+double v1369 = v393 * v1262;
+double v1370 = v1287 * v302;
+double v1371 = v1369 + v1370;
+double v1372 = v404 * v1264;
+double v1373 = v1293 * v308;
+double v1374 = v1372 + v1373;
+double v1375 = v1371 + v1374;
+double v1376 = v447 * v1262;
+double v1377 = v1301 * v302;
+double v1378 = v1376 + v1377;
+double v1379 = v456 * v1264;
+double v1380 = v1307 * v308;
+double v1381 = v1379 + v1380;
+double v1382 = v1378 + v1381;
+double v1386 = v527 * v1162;
+double v1387 = v1172 * v492;
+double v1388 = v1386 + v1387;
+double v1389 = v539 * v1164;
+double v1390 = v1179 * v498;
+double v1391 = v1389 + v1390;
+double v1392 = v1388 + v1391;
+double v1393 = v579 * v1162;
+double v1394 = v1187 * v492;
+double v1395 = v1393 + v1394;
+double v1396 = v593 * v1164;
+double v1397 = v1193 * v498;
+double v1398 = v1396 + v1397;
+double v1399 = v1395 + v1398;
+double v1400 = v629 * v1162;
+double v1401 = v1201 * v492;
+double v1402 = v1400 + v1401;
+double v1403 = v641 * v1164;
+double v1404 = v1207 * v498;
+double v1405 = v1403 + v1404;
+double v1406 = v1402 + v1405;
+double v1410 = v527 * v1212;
+double v1411 = v1222 * v492;
+double v1412 = v1410 + v1411;
+double v1413 = v539 * v1214;
+double v1414 = v1229 * v498;
+double v1415 = v1413 + v1414;
+double v1416 = v1412 + v1415;
+double v1417 = v579 * v1212;
+double v1418 = v1237 * v492;
+double v1419 = v1417 + v1418;
+double v1420 = v593 * v1214;
+double v1421 = v1243 * v498;
+double v1422 = v1420 + v1421;
+double v1423 = v1419 + v1422;
+double v1424 = v629 * v1212;
+double v1425 = v1251 * v492;
+double v1426 = v1424 + v1425;
+double v1427 = v641 * v1214;
+double v1428 = v1257 * v498;
+double v1429 = v1427 + v1428;
+double v1430 = v1426 + v1429;
+double v1434 = v527 * v1262;
+double v1435 = v1272 * v492;
+double v1436 = v1434 + v1435;
+double v1437 = v539 * v1264;
+double v1438 = v1279 * v498;
+double v1439 = v1437 + v1438;
+double v1440 = v1436 + v1439;
+double v1441 = v579 * v1262;
+double v1442 = v1287 * v492;
+double v1443 = v1441 + v1442;
+double v1444 = v593 * v1264;
+double v1445 = v1293 * v498;
+double v1446 = v1444 + v1445;
+double v1447 = v1443 + v1446;
+double v1448 = v629 * v1262;
+double v1449 = v1301 * v492;
+double v1450 = v1448 + v1449;
+double v1451 = v641 * v1264;
+double v1452 = v1307 * v498;
+double v1453 = v1451 + v1452;
+double v1454 = v1450 + v1453;
+ddR[0] = v146;
+ddR[27] = v222;
+ddR[54] = v297;
+ddR[9] = v382;
+ddR[36] = v436;
+ddR[63] = v488;
+ddR[18] = v568;
+ddR[45] = v618;
+ddR[72] = v668;
+ddR[1] = v678;
+ddR[28] = v685;
+ddR[55] = v692;
+ddR[10] = v702;
+ddR[37] = v709;
+ddR[64] = v716;
+ddR[19] = v726;
+ddR[46] = v733;
+ddR[73] = v740;
+ddR[2] = v750;
+ddR[29] = v757;
+ddR[56] = v764;
+ddR[11] = v774;
+ddR[38] = v781;
+ddR[65] = v788;
+ddR[20] = v798;
+ddR[47] = v805;
+ddR[74] = v812;
+ddR[3] = v843;
+ddR[30] = v861;
+ddR[57] = v880;
+ddR[12] = v910;
+ddR[39] = v929;
+ddR[66] = v948;
+ddR[21] = v978;
+ddR[48] = v996;
+ddR[75] = v1016;
+ddR[4] = v1026;
+ddR[31] = v1033;
+ddR[58] = v1040;
+ddR[13] = v1050;
+ddR[40] = v1057;
+ddR[67] = v1064;
+ddR[22] = v1074;
+ddR[49] = v1081;
+ddR[76] = v1088;
+ddR[5] = v1098;
+ddR[32] = v1105;
+ddR[59] = v1112;
+ddR[14] = v1122;
+ddR[41] = v1129;
+ddR[68] = v1136;
+ddR[23] = v1146;
+ddR[50] = v1153;
+ddR[77] = v1160;
+ddR[6] = v1182;
+ddR[33] = v1196;
+ddR[60] = v1210;
+ddR[15] = v1232;
+ddR[42] = v1246;
+ddR[69] = v1260;
+ddR[24] = v1282;
+ddR[51] = v1296;
+ddR[78] = v1310;
+ddR[7] = v1320;
+ddR[34] = v1327;
+ddR[61] = v1334;
+ddR[16] = v1344;
+ddR[43] = v1351;
+ddR[70] = v1358;
+ddR[25] = v1368;
+ddR[52] = v1375;
+ddR[79] = v1382;
+ddR[8] = v1392;
+ddR[35] = v1399;
+ddR[62] = v1406;
+ddR[17] = v1416;
+ddR[44] = v1423;
+ddR[71] = v1430;
+ddR[26] = v1440;
+ddR[53] = v1447;
+ddR[80] = v1454;
+}
+
+void R_dR_ddR(const double *v, double *R, double *dR, double *ddR) {
+double v0 = v[0];
+double v1 = v[1];
+double v2 = v[2];
+double v3 = 1.0;
+double v4 = 2.0;
+double v5 = 0.5;
+double v6 = v0 * v0;
+double v7 = v1 * v1;
+double v8 = v2 * v2;
+double v9 = v7 + v8;
+double v10 = v6 + v9;
+double v11 = sqrt(v10);
+double v12 = v5 * v11;
+double v13 = sin(v12);
+double v14 = v4 * v13;
+double v15 = v14 * v13;
+double v16 = v2 / v11;
+double v17 = -v16;
+double v18 = v17 * v16;
+double v19 = v1 / v11;
+double v20 = -v19;
+double v21 = v19 * v20;
+double v22 = v18 + v21;
+double v23 = v15 * v22;
+double v24 = v3 + v23;
+double v25 = v0 * v2;
+double v26 = -v1;
+double v27 = v3 - v24;
+double v28 = v26 * v27;
+double v29 = sin(v11);
+double v30 = v29 * v16;
+double v31 = v0 / v11;
+double v32 = -v31;
+double v33 = v32 * v20;
+double v34 = v15 * v33;
+double v35 = v30 + v34;
+double v36 = -v35;
+double v37 = v0 * v36;
+double v38 = v28 + v37;
+double v39 = v25 + v38;
+double v40 = -v39;
+double v41 = v11 * v11;
+double v42 = v40 / v41;
+double v43 = v42 * v35;
+double v44 = v0 * v1;
+double v45 = v2 * v27;
+double v46 = -v0;
+double v47 = v29 * v20;
+double v48 = v31 * v16;
+double v49 = v15 * v48;
+double v50 = v47 + v49;
+double v51 = -v50;
+double v52 = v46 * v51;
+double v53 = v45 + v52;
+double v54 = v44 + v53;
+double v55 = v54 / v41;
+double v56 = v55 * v50;
+double v57 = v43 + v56;
+double v58 = v5 / v11;
+double v59 = v0 + v0;
+double v60 = v58 * v59;
+double v61 = v2 / v41;
+double v62 = v60 * v61;
+double v63 = -v62;
+double v64 = v63 * v29;
+double v65 = cos(v11);
+double v66 = v65 * v60;
+double v67 = v66 * v16;
+double v68 = v64 + v67;
+double v69 = v1 / v41;
+double v70 = v60 * v69;
+double v71 = -v70;
+double v72 = -v71;
+double v73 = v72 * v32;
+double v74 = v11 / v41;
+double v75 = v0 / v41;
+double v76 = v60 * v75;
+double v77 = v74 - v76;
+double v78 = -v77;
+double v79 = v78 * v20;
+double v80 = v73 + v79;
+double v81 = v80 * v15;
+double v82 = cos(v12);
+double v83 = v5 * v60;
+double v84 = v82 * v83;
+double v85 = v84 * v14;
+double v86 = v84 * v4;
+double v87 = v86 * v13;
+double v88 = v85 + v87;
+double v89 = v88 * v33;
+double v90 = v81 + v89;
+double v91 = v68 + v90;
+double v92 = v91 * v42;
+double v93 = v63 * v17;
+double v94 = -v63;
+double v95 = v94 * v16;
+double v96 = v93 + v95;
+double v97 = v72 * v19;
+double v98 = v71 * v20;
+double v99 = v97 + v98;
+double v100 = v96 + v99;
+double v101 = v100 * v15;
+double v102 = v88 * v22;
+double v103 = v101 + v102;
+double v104 = -v103;
+double v105 = v104 * v26;
+double v106 = -v91;
+double v107 = v106 * v0;
+double v108 = v107 + v36;
+double v109 = v105 + v108;
+double v110 = v2 + v109;
+double v111 = -v110;
+double v112 = v41 * v41;
+double v113 = v41 / v112;
+double v114 = v111 * v113;
+double v115 = v60 * v11;
+double v116 = v115 + v115;
+double v117 = v40 / v112;
+double v118 = v116 * v117;
+double v119 = v114 - v118;
+double v120 = v119 * v35;
+double v121 = v92 + v120;
+double v122 = v72 * v29;
+double v123 = v66 * v20;
+double v124 = v122 + v123;
+double v125 = v63 * v31;
+double v126 = v77 * v16;
+double v127 = v125 + v126;
+double v128 = v127 * v15;
+double v129 = v88 * v48;
+double v130 = v128 + v129;
+double v131 = v124 + v130;
+double v132 = v131 * v55;
+double v133 = v104 * v2;
+double v134 = -v131;
+double v135 = v134 * v46;
+double v136 = -v51;
+double v137 = v135 + v136;
+double v138 = v133 + v137;
+double v139 = v1 + v138;
+double v140 = v139 * v113;
+double v141 = v54 / v112;
+double v142 = v116 * v141;
+double v143 = v140 - v142;
+double v144 = v143 * v50;
+double v145 = v132 + v144;
+double v146 = v121 + v145;
+double v147 = v1 + v1;
+double v148 = v58 * v147;
+double v149 = v148 * v61;
+double v150 = -v149;
+double v151 = v150 * v29;
+double v152 = v65 * v148;
+double v153 = v152 * v16;
+double v154 = v151 + v153;
+double v155 = v148 * v69;
+double v156 = v74 - v155;
+double v157 = -v156;
+double v158 = v157 * v32;
+double v159 = v148 * v75;
+double v160 = -v159;
+double v161 = -v160;
+double v162 = v161 * v20;
+double v163 = v158 + v162;
+double v164 = v163 * v15;
+double v165 = v5 * v148;
+double v166 = v82 * v165;
+double v167 = v166 * v14;
+double v168 = v166 * v4;
+double v169 = v168 * v13;
+double v170 = v167 + v169;
+double v171 = v170 * v33;
+double v172 = v164 + v171;
+double v173 = v154 + v172;
+double v174 = v173 * v42;
+double v175 = v150 * v17;
+double v176 = -v150;
+double v177 = v176 * v16;
+double v178 = v175 + v177;
+double v179 = v157 * v19;
+double v180 = v156 * v20;
+double v181 = v179 + v180;
+double v182 = v178 + v181;
+double v183 = v182 * v15;
+double v184 = v170 * v22;
+double v185 = v183 + v184;
+double v186 = -v185;
+double v187 = v186 * v26;
+double v188 = -v27;
+double v189 = v187 + v188;
+double v190 = -v173;
+double v191 = v190 * v0;
+double v192 = v189 + v191;
+double v193 = -v192;
+double v194 = v193 * v113;
+double v195 = v148 * v11;
+double v196 = v195 + v195;
+double v197 = v196 * v117;
+double v198 = v194 - v197;
+double v199 = v198 * v35;
+double v200 = v174 + v199;
+double v201 = v157 * v29;
+double v202 = v152 * v20;
+double v203 = v201 + v202;
+double v204 = v150 * v31;
+double v205 = v160 * v16;
+double v206 = v204 + v205;
+double v207 = v206 * v15;
+double v208 = v170 * v48;
+double v209 = v207 + v208;
+double v210 = v203 + v209;
+double v211 = v210 * v55;
+double v212 = v186 * v2;
+double v213 = -v210;
+double v214 = v213 * v46;
+double v215 = v212 + v214;
+double v216 = v0 + v215;
+double v217 = v216 * v113;
+double v218 = v196 * v141;
+double v219 = v217 - v218;
+double v220 = v219 * v50;
+double v221 = v211 + v220;
+double v222 = v200 + v221;
+double v223 = v2 + v2;
+double v224 = v58 * v223;
+double v225 = v224 * v61;
+double v226 = v74 - v225;
+double v227 = v226 * v29;
+double v228 = v65 * v224;
+double v229 = v228 * v16;
+double v230 = v227 + v229;
+double v231 = v224 * v69;
+double v232 = -v231;
+double v233 = -v232;
+double v234 = v233 * v32;
+double v235 = v224 * v75;
+double v236 = -v235;
+double v237 = -v236;
+double v238 = v237 * v20;
+double v239 = v234 + v238;
+double v240 = v239 * v15;
+double v241 = v5 * v224;
+double v242 = v82 * v241;
+double v243 = v242 * v14;
+double v244 = v242 * v4;
+double v245 = v244 * v13;
+double v246 = v243 + v245;
+double v247 = v246 * v33;
+double v248 = v240 + v247;
+double v249 = v230 + v248;
+double v250 = v249 * v42;
+double v251 = v226 * v17;
+double v252 = -v226;
+double v253 = v252 * v16;
+double v254 = v251 + v253;
+double v255 = v233 * v19;
+double v256 = v232 * v20;
+double v257 = v255 + v256;
+double v258 = v254 + v257;
+double v259 = v258 * v15;
+double v260 = v246 * v22;
+double v261 = v259 + v260;
+double v262 = -v261;
+double v263 = v262 * v26;
+double v264 = -v249;
+double v265 = v264 * v0;
+double v266 = v263 + v265;
+double v267 = v0 + v266;
+double v268 = -v267;
+double v269 = v268 * v113;
+double v270 = v224 * v11;
+double v271 = v270 + v270;
+double v272 = v271 * v117;
+double v273 = v269 - v272;
+double v274 = v273 * v35;
+double v275 = v250 + v274;
+double v276 = v233 * v29;
+double v277 = v228 * v20;
+double v278 = v276 + v277;
+double v279 = v226 * v31;
+double v280 = v236 * v16;
+double v281 = v279 + v280;
+double v282 = v281 * v15;
+double v283 = v246 * v48;
+double v284 = v282 + v283;
+double v285 = v278 + v284;
+double v286 = v285 * v55;
+double v287 = v262 * v2;
+double v288 = v287 + v27;
+double v289 = -v285;
+double v290 = v289 * v46;
+double v291 = v288 + v290;
+double v292 = v291 * v113;
+double v293 = v271 * v141;
+double v294 = v292 - v293;
+double v295 = v294 * v50;
+double v296 = v286 + v295;
+double v297 = v275 + v296;
+double v298 = v1 * v2;
+double v299 = v29 * v17;
+double v300 = v19 * v31;
+double v301 = v15 * v300;
+double v302 = v299 + v301;
+double v303 = -v302;
+double v304 = v26 * v303;
+double v305 = v32 * v31;
+double v306 = v18 + v305;
+double v307 = v15 * v306;
+double v308 = v3 + v307;
+double v309 = v3 - v308;
+double v310 = v0 * v309;
+double v311 = v304 + v310;
+double v312 = v298 + v311;
+double v313 = -v312;
+double v314 = v313 / v41;
+double v315 = v314 * v35;
+double v316 = v2 * v303;
+double v317 = v29 * v31;
+double v318 = v20 * v17;
+double v319 = v15 * v318;
+double v320 = v317 + v319;
+double v321 = -v320;
+double v322 = v46 * v321;
+double v323 = v316 + v322;
+double v324 = v7 + v323;
+double v325 = v324 / v41;
+double v326 = v325 * v50;
+double v327 = v315 + v326;
+double v328 = v91 * v314;
+double v329 = v94 * v29;
+double v330 = v66 * v17;
+double v331 = v329 + v330;
+double v332 = v77 * v19;
+double v333 = v71 * v31;
+double v334 = v332 + v333;
+double v335 = v334 * v15;
+double v336 = v88 * v300;
+double v337 = v335 + v336;
+double v338 = v331 + v337;
+double v339 = -v338;
+double v340 = v339 * v26;
+double v341 = v77 * v32;
+double v342 = v78 * v31;
+double v343 = v341 + v342;
+double v344 = v96 + v343;
+double v345 = v344 * v15;
+double v346 = v88 * v306;
+double v347 = v345 + v346;
+double v348 = -v347;
+double v349 = v348 * v0;
+double v350 = v349 + v309;
+double v351 = v340 + v350;
+double v352 = -v351;
+double v353 = v352 * v113;
+double v354 = v313 / v112;
+double v355 = v116 * v354;
+double v356 = v353 - v355;
+double v357 = v356 * v35;
+double v358 = v328 + v357;
+double v359 = v131 * v325;
+double v360 = v339 * v2;
+double v361 = v77 * v29;
+double v362 = v66 * v31;
+double v363 = v361 + v362;
+double v364 = v94 * v20;
+double v365 = v72 * v17;
+double v366 = v364 + v365;
+double v367 = v366 * v15;
+double v368 = v88 * v318;
+double v369 = v367 + v368;
+double v370 = v363 + v369;
+double v371 = -v370;
+double v372 = v371 * v46;
+double v373 = -v321;
+double v374 = v372 + v373;
+double v375 = v360 + v374;
+double v376 = v375 * v113;
+double v377 = v324 / v112;
+double v378 = v116 * v377;
+double v379 = v376 - v378;
+double v380 = v379 * v50;
+double v381 = v359 + v380;
+double v382 = v358 + v381;
+double v383 = v173 * v314;
+double v384 = v176 * v29;
+double v385 = v152 * v17;
+double v386 = v384 + v385;
+double v387 = v160 * v19;
+double v388 = v156 * v31;
+double v389 = v387 + v388;
+double v390 = v389 * v15;
+double v391 = v170 * v300;
+double v392 = v390 + v391;
+double v393 = v386 + v392;
+double v394 = -v393;
+double v395 = v394 * v26;
+double v396 = -v303;
+double v397 = v395 + v396;
+double v398 = v160 * v32;
+double v399 = v161 * v31;
+double v400 = v398 + v399;
+double v401 = v178 + v400;
+double v402 = v401 * v15;
+double v403 = v170 * v306;
+double v404 = v402 + v403;
+double v405 = -v404;
+double v406 = v405 * v0;
+double v407 = v397 + v406;
+double v408 = v2 + v407;
+double v409 = -v408;
+double v410 = v409 * v113;
+double v411 = v196 * v354;
+double v412 = v410 - v411;
+double v413 = v412 * v35;
+double v414 = v383 + v413;
+double v415 = v210 * v325;
+double v416 = v394 * v2;
+double v417 = v160 * v29;
+double v418 = v152 * v31;
+double v419 = v417 + v418;
+double v420 = v176 * v20;
+double v421 = v157 * v17;
+double v422 = v420 + v421;
+double v423 = v422 * v15;
+double v424 = v170 * v318;
+double v425 = v423 + v424;
+double v426 = v419 + v425;
+double v427 = -v426;
+double v428 = v427 * v46;
+double v429 = v416 + v428;
+double v430 = v147 + v429;
+double v431 = v430 * v113;
+double v432 = v196 * v377;
+double v433 = v431 - v432;
+double v434 = v433 * v50;
+double v435 = v415 + v434;
+double v436 = v414 + v435;
+double v437 = v249 * v314;
+double v438 = v252 * v29;
+double v439 = v228 * v17;
+double v440 = v438 + v439;
+double v441 = v236 * v19;
+double v442 = v232 * v31;
+double v443 = v441 + v442;
+double v444 = v443 * v15;
+double v445 = v246 * v300;
+double v446 = v444 + v445;
+double v447 = v440 + v446;
+double v448 = -v447;
+double v449 = v448 * v26;
+double v450 = v236 * v32;
+double v451 = v237 * v31;
+double v452 = v450 + v451;
+double v453 = v254 + v452;
+double v454 = v453 * v15;
+double v455 = v246 * v306;
+double v456 = v454 + v455;
+double v457 = -v456;
+double v458 = v457 * v0;
+double v459 = v449 + v458;
+double v460 = v1 + v459;
+double v461 = -v460;
+double v462 = v461 * v113;
+double v463 = v271 * v354;
+double v464 = v462 - v463;
+double v465 = v464 * v35;
+double v466 = v437 + v465;
+double v467 = v285 * v325;
+double v468 = v448 * v2;
+double v469 = v468 + v303;
+double v470 = v236 * v29;
+double v471 = v228 * v31;
+double v472 = v470 + v471;
+double v473 = v252 * v20;
+double v474 = v233 * v17;
+double v475 = v473 + v474;
+double v476 = v475 * v15;
+double v477 = v246 * v318;
+double v478 = v476 + v477;
+double v479 = v472 + v478;
+double v480 = -v479;
+double v481 = v480 * v46;
+double v482 = v469 + v481;
+double v483 = v482 * v113;
+double v484 = v271 * v377;
+double v485 = v483 - v484;
+double v486 = v485 * v50;
+double v487 = v467 + v486;
+double v488 = v466 + v487;
+double v489 = v29 * v19;
+double v490 = v17 * v32;
+double v491 = v15 * v490;
+double v492 = v489 + v491;
+double v493 = -v492;
+double v494 = v26 * v493;
+double v495 = v29 * v32;
+double v496 = v16 * v19;
+double v497 = v15 * v496;
+double v498 = v495 + v497;
+double v499 = -v498;
+double v500 = v0 * v499;
+double v501 = v494 + v500;
+double v502 = v8 + v501;
+double v503 = -v502;
+double v504 = v503 / v41;
+double v505 = v504 * v35;
+double v506 = v2 * v493;
+double v507 = v21 + v305;
+double v508 = v15 * v507;
+double v509 = v3 + v508;
+double v510 = v3 - v509;
+double v511 = v46 * v510;
+double v512 = v506 + v511;
+double v513 = v298 + v512;
+double v514 = v513 / v41;
+double v515 = v514 * v50;
+double v516 = v505 + v515;
+double v517 = v91 * v504;
+double v518 = v71 * v29;
+double v519 = v66 * v19;
+double v520 = v518 + v519;
+double v521 = v78 * v17;
+double v522 = v94 * v32;
+double v523 = v521 + v522;
+double v524 = v523 * v15;
+double v525 = v88 * v490;
+double v526 = v524 + v525;
+double v527 = v520 + v526;
+double v528 = -v527;
+double v529 = v528 * v26;
+double v530 = v78 * v29;
+double v531 = v66 * v32;
+double v532 = v530 + v531;
+double v533 = v71 * v16;
+double v534 = v63 * v19;
+double v535 = v533 + v534;
+double v536 = v535 * v15;
+double v537 = v88 * v496;
+double v538 = v536 + v537;
+double v539 = v532 + v538;
+double v540 = -v539;
+double v541 = v540 * v0;
+double v542 = v541 + v499;
+double v543 = v529 + v542;
+double v544 = -v543;
+double v545 = v544 * v113;
+double v546 = v503 / v112;
+double v547 = v116 * v546;
+double v548 = v545 - v547;
+double v549 = v548 * v35;
+double v550 = v517 + v549;
+double v551 = v131 * v514;
+double v552 = v528 * v2;
+double v553 = v99 + v343;
+double v554 = v553 * v15;
+double v555 = v88 * v507;
+double v556 = v554 + v555;
+double v557 = -v556;
+double v558 = v557 * v46;
+double v559 = -v510;
+double v560 = v558 + v559;
+double v561 = v552 + v560;
+double v562 = v561 * v113;
+double v563 = v513 / v112;
+double v564 = v116 * v563;
+double v565 = v562 - v564;
+double v566 = v565 * v50;
+double v567 = v551 + v566;
+double v568 = v550 + v567;
+double v569 = v173 * v504;
+double v570 = v156 * v29;
+double v571 = v152 * v19;
+double v572 = v570 + v571;
+double v573 = v161 * v17;
+double v574 = v176 * v32;
+double v575 = v573 + v574;
+double v576 = v575 * v15;
+double v577 = v170 * v490;
+double v578 = v576 + v577;
+double v579 = v572 + v578;
+double v580 = -v579;
+double v581 = v580 * v26;
+double v582 = -v493;
+double v583 = v581 + v582;
+double v584 = v161 * v29;
+double v585 = v152 * v32;
+double v586 = v584 + v585;
+double v587 = v156 * v16;
+double v588 = v150 * v19;
+double v589 = v587 + v588;
+double v590 = v589 * v15;
+double v591 = v170 * v496;
+double v592 = v590 + v591;
+double v593 = v586 + v592;
+double v594 = -v593;
+double v595 = v594 * v0;
+double v596 = v583 + v595;
+double v597 = -v596;
+double v598 = v597 * v113;
+double v599 = v196 * v546;
+double v600 = v598 - v599;
+double v601 = v600 * v35;
+double v602 = v569 + v601;
+double v603 = v210 * v514;
+double v604 = v580 * v2;
+double v605 = v181 + v400;
+double v606 = v605 * v15;
+double v607 = v170 * v507;
+double v608 = v606 + v607;
+double v609 = -v608;
+double v610 = v609 * v46;
+double v611 = v604 + v610;
+double v612 = v2 + v611;
+double v613 = v612 * v113;
+double v614 = v196 * v563;
+double v615 = v613 - v614;
+double v616 = v615 * v50;
+double v617 = v603 + v616;
+double v618 = v602 + v617;
+double v619 = v249 * v504;
+double v620 = v232 * v29;
+double v621 = v228 * v19;
+double v622 = v620 + v621;
+double v623 = v237 * v17;
+double v624 = v252 * v32;
+double v625 = v623 + v624;
+double v626 = v625 * v15;
+double v627 = v246 * v490;
+double v628 = v626 + v627;
+double v629 = v622 + v628;
+double v630 = -v629;
+double v631 = v630 * v26;
+double v632 = v237 * v29;
+double v633 = v228 * v32;
+double v634 = v632 + v633;
+double v635 = v232 * v16;
+double v636 = v226 * v19;
+double v637 = v635 + v636;
+double v638 = v637 * v15;
+double v639 = v246 * v496;
+double v640 = v638 + v639;
+double v641 = v634 + v640;
+double v642 = -v641;
+double v643 = v642 * v0;
+double v644 = v631 + v643;
+double v645 = v223 + v644;
+double v646 = -v645;
+double v647 = v646 * v113;
+double v648 = v271 * v546;
+double v649 = v647 - v648;
+double v650 = v649 * v35;
+double v651 = v619 + v650;
+double v652 = v285 * v514;
+double v653 = v630 * v2;
+double v654 = v653 + v493;
+double v655 = v257 + v452;
+double v656 = v655 * v15;
+double v657 = v246 * v507;
+double v658 = v656 + v657;
+double v659 = -v658;
+double v660 = v659 * v46;
+double v661 = v654 + v660;
+double v662 = v1 + v661;
+double v663 = v662 * v113;
+double v664 = v271 * v563;
+double v665 = v663 - v664;
+double v666 = v665 * v50;
+double v667 = v652 + v666;
+double v668 = v651 + v667;
+double v669 = v42 * v308;
+double v670 = v55 * v320;
+double v671 = v669 + v670;
+double v672 = v347 * v42;
+double v673 = v119 * v308;
+double v674 = v672 + v673;
+double v675 = v370 * v55;
+double v676 = v143 * v320;
+double v677 = v675 + v676;
+double v678 = v674 + v677;
+double v679 = v404 * v42;
+double v680 = v198 * v308;
+double v681 = v679 + v680;
+double v682 = v426 * v55;
+double v683 = v219 * v320;
+double v684 = v682 + v683;
+double v685 = v681 + v684;
+double v686 = v456 * v42;
+double v687 = v273 * v308;
+double v688 = v686 + v687;
+double v689 = v479 * v55;
+double v690 = v294 * v320;
+double v691 = v689 + v690;
+double v692 = v688 + v691;
+double v693 = v314 * v308;
+double v694 = v325 * v320;
+double v695 = v693 + v694;
+double v696 = v347 * v314;
+double v697 = v356 * v308;
+double v698 = v696 + v697;
+double v699 = v370 * v325;
+double v700 = v379 * v320;
+double v701 = v699 + v700;
+double v702 = v698 + v701;
+double v703 = v404 * v314;
+double v704 = v412 * v308;
+double v705 = v703 + v704;
+double v706 = v426 * v325;
+double v707 = v433 * v320;
+double v708 = v706 + v707;
+double v709 = v705 + v708;
+double v710 = v456 * v314;
+double v711 = v464 * v308;
+double v712 = v710 + v711;
+double v713 = v479 * v325;
+double v714 = v485 * v320;
+double v715 = v713 + v714;
+double v716 = v712 + v715;
+double v717 = v504 * v308;
+double v718 = v514 * v320;
+double v719 = v717 + v718;
+double v720 = v347 * v504;
+double v721 = v548 * v308;
+double v722 = v720 + v721;
+double v723 = v370 * v514;
+double v724 = v565 * v320;
+double v725 = v723 + v724;
+double v726 = v722 + v725;
+double v727 = v404 * v504;
+double v728 = v600 * v308;
+double v729 = v727 + v728;
+double v730 = v426 * v514;
+double v731 = v615 * v320;
+double v732 = v730 + v731;
+double v733 = v729 + v732;
+double v734 = v456 * v504;
+double v735 = v649 * v308;
+double v736 = v734 + v735;
+double v737 = v479 * v514;
+double v738 = v665 * v320;
+double v739 = v737 + v738;
+double v740 = v736 + v739;
+double v741 = v42 * v498;
+double v742 = v55 * v509;
+double v743 = v741 + v742;
+double v744 = v539 * v42;
+double v745 = v119 * v498;
+double v746 = v744 + v745;
+double v747 = v556 * v55;
+double v748 = v143 * v509;
+double v749 = v747 + v748;
+double v750 = v746 + v749;
+double v751 = v593 * v42;
+double v752 = v198 * v498;
+double v753 = v751 + v752;
+double v754 = v608 * v55;
+double v755 = v219 * v509;
+double v756 = v754 + v755;
+double v757 = v753 + v756;
+double v758 = v641 * v42;
+double v759 = v273 * v498;
+double v760 = v758 + v759;
+double v761 = v658 * v55;
+double v762 = v294 * v509;
+double v763 = v761 + v762;
+double v764 = v760 + v763;
+double v765 = v314 * v498;
+double v766 = v325 * v509;
+double v767 = v765 + v766;
+double v768 = v539 * v314;
+double v769 = v356 * v498;
+double v770 = v768 + v769;
+double v771 = v556 * v325;
+double v772 = v379 * v509;
+double v773 = v771 + v772;
+double v774 = v770 + v773;
+double v775 = v593 * v314;
+double v776 = v412 * v498;
+double v777 = v775 + v776;
+double v778 = v608 * v325;
+double v779 = v433 * v509;
+double v780 = v778 + v779;
+double v781 = v777 + v780;
+double v782 = v641 * v314;
+double v783 = v464 * v498;
+double v784 = v782 + v783;
+double v785 = v658 * v325;
+double v786 = v485 * v509;
+double v787 = v785 + v786;
+double v788 = v784 + v787;
+double v789 = v504 * v498;
+double v790 = v514 * v509;
+double v791 = v789 + v790;
+double v792 = v539 * v504;
+double v793 = v548 * v498;
+double v794 = v792 + v793;
+double v795 = v556 * v514;
+double v796 = v565 * v509;
+double v797 = v795 + v796;
+double v798 = v794 + v797;
+double v799 = v593 * v504;
+double v800 = v600 * v498;
+double v801 = v799 + v800;
+double v802 = v608 * v514;
+double v803 = v615 * v509;
+double v804 = v802 + v803;
+double v805 = v801 + v804;
+double v806 = v641 * v504;
+double v807 = v649 * v498;
+double v808 = v806 + v807;
+double v809 = v658 * v514;
+double v810 = v665 * v509;
+double v811 = v809 + v810;
+double v812 = v808 + v811;
+double v813 = v39 / v41;
+double v814 = v813 * v24;
+double v815 = -v2;
+double v816 = v815 * v36;
+double v817 = v1 * v51;
+double v818 = v816 + v817;
+double v819 = v6 + v818;
+double v820 = -v819;
+double v821 = v820 / v41;
+double v822 = v821 * v50;
+double v823 = v814 + v822;
+double v824 = v103 * v813;
+double v825 = v110 * v113;
+double v826 = v39 / v112;
+double v827 = v116 * v826;
+double v828 = v825 - v827;
+double v829 = v828 * v24;
+double v830 = v824 + v829;
+double v831 = v131 * v821;
+double v832 = v106 * v815;
+double v833 = v134 * v1;
+double v834 = v832 + v833;
+double v835 = v59 + v834;
+double v836 = -v835;
+double v837 = v836 * v113;
+double v838 = v820 / v112;
+double v839 = v116 * v838;
+double v840 = v837 - v839;
+double v841 = v840 * v50;
+double v842 = v831 + v841;
+double v843 = v830 + v842;
+double v844 = v185 * v813;
+double v845 = v192 * v113;
+double v846 = v196 * v826;
+double v847 = v845 - v846;
+double v848 = v847 * v24;
+double v849 = v844 + v848;
+double v850 = v210 * v821;
+double v851 = v190 * v815;
+double v852 = v213 * v1;
+double v853 = v852 + v51;
+double v854 = v851 + v853;
+double v855 = -v854;
+double v856 = v855 * v113;
+double v857 = v196 * v838;
+double v858 = v856 - v857;
+double v859 = v858 * v50;
+double v860 = v850 + v859;
+double v861 = v849 + v860;
+double v862 = v261 * v813;
+double v863 = v267 * v113;
+double v864 = v271 * v826;
+double v865 = v863 - v864;
+double v866 = v865 * v24;
+double v867 = v862 + v866;
+double v868 = v285 * v821;
+double v869 = v264 * v815;
+double v870 = -v36;
+double v871 = v869 + v870;
+double v872 = v289 * v1;
+double v873 = v871 + v872;
+double v874 = -v873;
+double v875 = v874 * v113;
+double v876 = v271 * v838;
+double v877 = v875 - v876;
+double v878 = v877 * v50;
+double v879 = v868 + v878;
+double v880 = v867 + v879;
+double v881 = v312 / v41;
+double v882 = v881 * v24;
+double v883 = v815 * v309;
+double v884 = v1 * v321;
+double v885 = v883 + v884;
+double v886 = v44 + v885;
+double v887 = -v886;
+double v888 = v887 / v41;
+double v889 = v888 * v50;
+double v890 = v882 + v889;
+double v891 = v103 * v881;
+double v892 = v351 * v113;
+double v893 = v312 / v112;
+double v894 = v116 * v893;
+double v895 = v892 - v894;
+double v896 = v895 * v24;
+double v897 = v891 + v896;
+double v898 = v131 * v888;
+double v899 = v348 * v815;
+double v900 = v371 * v1;
+double v901 = v899 + v900;
+double v902 = v1 + v901;
+double v903 = -v902;
+double v904 = v903 * v113;
+double v905 = v887 / v112;
+double v906 = v116 * v905;
+double v907 = v904 - v906;
+double v908 = v907 * v50;
+double v909 = v898 + v908;
+double v910 = v897 + v909;
+double v911 = v185 * v881;
+double v912 = v408 * v113;
+double v913 = v196 * v893;
+double v914 = v912 - v913;
+double v915 = v914 * v24;
+double v916 = v911 + v915;
+double v917 = v210 * v888;
+double v918 = v405 * v815;
+double v919 = v427 * v1;
+double v920 = v919 + v321;
+double v921 = v918 + v920;
+double v922 = v0 + v921;
+double v923 = -v922;
+double v924 = v923 * v113;
+double v925 = v196 * v905;
+double v926 = v924 - v925;
+double v927 = v926 * v50;
+double v928 = v917 + v927;
+double v929 = v916 + v928;
+double v930 = v261 * v881;
+double v931 = v460 * v113;
+double v932 = v271 * v893;
+double v933 = v931 - v932;
+double v934 = v933 * v24;
+double v935 = v930 + v934;
+double v936 = v285 * v888;
+double v937 = v457 * v815;
+double v938 = -v309;
+double v939 = v937 + v938;
+double v940 = v480 * v1;
+double v941 = v939 + v940;
+double v942 = -v941;
+double v943 = v942 * v113;
+double v944 = v271 * v905;
+double v945 = v943 - v944;
+double v946 = v945 * v50;
+double v947 = v936 + v946;
+double v948 = v935 + v947;
+double v949 = v502 / v41;
+double v950 = v949 * v24;
+double v951 = v815 * v499;
+double v952 = v1 * v510;
+double v953 = v951 + v952;
+double v954 = v25 + v953;
+double v955 = -v954;
+double v956 = v955 / v41;
+double v957 = v956 * v50;
+double v958 = v950 + v957;
+double v959 = v103 * v949;
+double v960 = v543 * v113;
+double v961 = v502 / v112;
+double v962 = v116 * v961;
+double v963 = v960 - v962;
+double v964 = v963 * v24;
+double v965 = v959 + v964;
+double v966 = v131 * v956;
+double v967 = v540 * v815;
+double v968 = v557 * v1;
+double v969 = v967 + v968;
+double v970 = v2 + v969;
+double v971 = -v970;
+double v972 = v971 * v113;
+double v973 = v955 / v112;
+double v974 = v116 * v973;
+double v975 = v972 - v974;
+double v976 = v975 * v50;
+double v977 = v966 + v976;
+double v978 = v965 + v977;
+double v979 = v185 * v949;
+double v980 = v596 * v113;
+double v981 = v196 * v961;
+double v982 = v980 - v981;
+double v983 = v982 * v24;
+double v984 = v979 + v983;
+double v985 = v210 * v956;
+double v986 = v594 * v815;
+double v987 = v609 * v1;
+double v988 = v987 + v510;
+double v989 = v986 + v988;
+double v990 = -v989;
+double v991 = v990 * v113;
+double v992 = v196 * v973;
+double v993 = v991 - v992;
+double v994 = v993 * v50;
+double v995 = v985 + v994;
+double v996 = v984 + v995;
+double v997 = v261 * v949;
+double v998 = v645 * v113;
+double v999 = v271 * v961;
+double v1000 = v998 - v999;
+double v1001 = v1000 * v24;
+double v1002 = v997 + v1001;
+double v1003 = v285 * v956;
+double v1004 = v642 * v815;
+double v1005 = -v499;
+double v1006 = v1004 + v1005;
+double v1007 = v659 * v1;
+double v1008 = v1006 + v1007;
+double v1009 = v0 + v1008;
+double v1010 = -v1009;
+double v1011 = v1010 * v113;
+double v1012 = v271 * v973;
+double v1013 = v1011 - v1012;
+double v1014 = v1013 * v50;
+double v1015 = v1003 + v1014;
+double v1016 = v1002 + v1015;
+double v1017 = v813 * v302;
+double v1018 = v821 * v320;
+double v1019 = v1017 + v1018;
+double v1020 = v338 * v813;
+double v1021 = v828 * v302;
+double v1022 = v1020 + v1021;
+double v1023 = v370 * v821;
+double v1024 = v840 * v320;
+double v1025 = v1023 + v1024;
+double v1026 = v1022 + v1025;
+double v1027 = v393 * v813;
+double v1028 = v847 * v302;
+double v1029 = v1027 + v1028;
+double v1030 = v426 * v821;
+double v1031 = v858 * v320;
+double v1032 = v1030 + v1031;
+double v1033 = v1029 + v1032;
+double v1034 = v447 * v813;
+double v1035 = v865 * v302;
+double v1036 = v1034 + v1035;
+double v1037 = v479 * v821;
+double v1038 = v877 * v320;
+double v1039 = v1037 + v1038;
+double v1040 = v1036 + v1039;
+double v1041 = v881 * v302;
+double v1042 = v888 * v320;
+double v1043 = v1041 + v1042;
+double v1044 = v338 * v881;
+double v1045 = v895 * v302;
+double v1046 = v1044 + v1045;
+double v1047 = v370 * v888;
+double v1048 = v907 * v320;
+double v1049 = v1047 + v1048;
+double v1050 = v1046 + v1049;
+double v1051 = v393 * v881;
+double v1052 = v914 * v302;
+double v1053 = v1051 + v1052;
+double v1054 = v426 * v888;
+double v1055 = v926 * v320;
+double v1056 = v1054 + v1055;
+double v1057 = v1053 + v1056;
+double v1058 = v447 * v881;
+double v1059 = v933 * v302;
+double v1060 = v1058 + v1059;
+double v1061 = v479 * v888;
+double v1062 = v945 * v320;
+double v1063 = v1061 + v1062;
+double v1064 = v1060 + v1063;
+double v1065 = v949 * v302;
+double v1066 = v956 * v320;
+double v1067 = v1065 + v1066;
+double v1068 = v338 * v949;
+double v1069 = v963 * v302;
+double v1070 = v1068 + v1069;
+double v1071 = v370 * v956;
+double v1072 = v975 * v320;
+double v1073 = v1071 + v1072;
+double v1074 = v1070 + v1073;
+double v1075 = v393 * v949;
+double v1076 = v982 * v302;
+double v1077 = v1075 + v1076;
+double v1078 = v426 * v956;
+double v1079 = v993 * v320;
+double v1080 = v1078 + v1079;
+double v1081 = v1077 + v1080;
+double v1082 = v447 * v949;
+double v1083 = v1000 * v302;
+double v1084 = v1082 + v1083;
+double v1085 = v479 * v956;
+double v1086 = v1013 * v320;
+double v1087 = v1085 + v1086;
+double v1088 = v1084 + v1087;
+double v1089 = v813 * v492;
+double v1090 = v821 * v509;
+double v1091 = v1089 + v1090;
+double v1092 = v527 * v813;
+double v1093 = v828 * v492;
+double v1094 = v1092 + v1093;
+double v1095 = v556 * v821;
+double v1096 = v840 * v509;
+double v1097 = v1095 + v1096;
+double v1098 = v1094 + v1097;
+double v1099 = v579 * v813;
+double v1100 = v847 * v492;
+double v1101 = v1099 + v1100;
+double v1102 = v608 * v821;
+double v1103 = v858 * v509;
+double v1104 = v1102 + v1103;
+double v1105 = v1101 + v1104;
+double v1106 = v629 * v813;
+double v1107 = v865 * v492;
+double v1108 = v1106 + v1107;
+double v1109 = v658 * v821;
+double v1110 = v877 * v509;
+double v1111 = v1109 + v1110;
+double v1112 = v1108 + v1111;
+double v1113 = v881 * v492;
+double v1114 = v888 * v509;
+double v1115 = v1113 + v1114;
+double v1116 = v527 * v881;
+double v1117 = v895 * v492;
+double v1118 = v1116 + v1117;
+double v1119 = v556 * v888;
+double v1120 = v907 * v509;
+double v1121 = v1119 + v1120;
+double v1122 = v1118 + v1121;
+double v1123 = v579 * v881;
+double v1124 = v914 * v492;
+double v1125 = v1123 + v1124;
+double v1126 = v608 * v888;
+double v1127 = v926 * v509;
+double v1128 = v1126 + v1127;
+double v1129 = v1125 + v1128;
+double v1130 = v629 * v881;
+double v1131 = v933 * v492;
+double v1132 = v1130 + v1131;
+double v1133 = v658 * v888;
+double v1134 = v945 * v509;
+double v1135 = v1133 + v1134;
+double v1136 = v1132 + v1135;
+double v1137 = v949 * v492;
+double v1138 = v956 * v509;
+double v1139 = v1137 + v1138;
+double v1140 = v527 * v949;
+double v1141 = v963 * v492;
+double v1142 = v1140 + v1141;
+double v1143 = v556 * v956;
+double v1144 = v975 * v509;
+double v1145 = v1143 + v1144;
+double v1146 = v1142 + v1145;
+double v1147 = v579 * v949;
+double v1148 = v982 * v492;
+double v1149 = v1147 + v1148;
+double v1150 = v608 * v956;
+double v1151 = v993 * v509;
+double v1152 = v1150 + v1151;
+double v1153 = v1149 + v1152;
+double v1154 = v629 * v949;
+double v1155 = v1000 * v492;
+double v1156 = v1154 + v1155;
+double v1157 = v658 * v956;
+double v1158 = v1013 * v509;
+double v1159 = v1157 + v1158;
+double v1160 = v1156 + v1159;
+double v1161 = -v54;
+double v1162 = v1161 / v41;
+double v1163 = v1162 * v24;
+double v1164 = v819 / v41;
+double v1165 = v1164 * v35;
+double v1166 = v1163 + v1165;
+double v1167 = v103 * v1162;
+double v1168 = -v139;
+double v1169 = v1168 * v113;
+double v1170 = v1161 / v112;
+double v1171 = v116 * v1170;
+double v1172 = v1169 - v1171;
+double v1173 = v1172 * v24;
+double v1174 = v1167 + v1173;
+double v1175 = v91 * v1164;
+double v1176 = v835 * v113;
+double v1177 = v819 / v112;
+double v1178 = v116 * v1177;
+double v1179 = v1176 - v1178;
+double v1180 = v1179 * v35;
+double v1181 = v1175 + v1180;
+double v1182 = v1174 + v1181;
+double v1183 = v185 * v1162;
+double v1184 = -v216;
+double v1185 = v1184 * v113;
+double v1186 = v196 * v1170;
+double v1187 = v1185 - v1186;
+double v1188 = v1187 * v24;
+double v1189 = v1183 + v1188;
+double v1190 = v173 * v1164;
+double v1191 = v854 * v113;
+double v1192 = v196 * v1177;
+double v1193 = v1191 - v1192;
+double v1194 = v1193 * v35;
+double v1195 = v1190 + v1194;
+double v1196 = v1189 + v1195;
+double v1197 = v261 * v1162;
+double v1198 = -v291;
+double v1199 = v1198 * v113;
+double v1200 = v271 * v1170;
+double v1201 = v1199 - v1200;
+double v1202 = v1201 * v24;
+double v1203 = v1197 + v1202;
+double v1204 = v249 * v1164;
+double v1205 = v873 * v113;
+double v1206 = v271 * v1177;
+double v1207 = v1205 - v1206;
+double v1208 = v1207 * v35;
+double v1209 = v1204 + v1208;
+double v1210 = v1203 + v1209;
+double v1211 = -v324;
+double v1212 = v1211 / v41;
+double v1213 = v1212 * v24;
+double v1214 = v886 / v41;
+double v1215 = v1214 * v35;
+double v1216 = v1213 + v1215;
+double v1217 = v103 * v1212;
+double v1218 = -v375;
+double v1219 = v1218 * v113;
+double v1220 = v1211 / v112;
+double v1221 = v116 * v1220;
+double v1222 = v1219 - v1221;
+double v1223 = v1222 * v24;
+double v1224 = v1217 + v1223;
+double v1225 = v91 * v1214;
+double v1226 = v902 * v113;
+double v1227 = v886 / v112;
+double v1228 = v116 * v1227;
+double v1229 = v1226 - v1228;
+double v1230 = v1229 * v35;
+double v1231 = v1225 + v1230;
+double v1232 = v1224 + v1231;
+double v1233 = v185 * v1212;
+double v1234 = -v430;
+double v1235 = v1234 * v113;
+double v1236 = v196 * v1220;
+double v1237 = v1235 - v1236;
+double v1238 = v1237 * v24;
+double v1239 = v1233 + v1238;
+double v1240 = v173 * v1214;
+double v1241 = v922 * v113;
+double v1242 = v196 * v1227;
+double v1243 = v1241 - v1242;
+double v1244 = v1243 * v35;
+double v1245 = v1240 + v1244;
+double v1246 = v1239 + v1245;
+double v1247 = v261 * v1212;
+double v1248 = -v482;
+double v1249 = v1248 * v113;
+double v1250 = v271 * v1220;
+double v1251 = v1249 - v1250;
+double v1252 = v1251 * v24;
+double v1253 = v1247 + v1252;
+double v1254 = v249 * v1214;
+double v1255 = v941 * v113;
+double v1256 = v271 * v1227;
+double v1257 = v1255 - v1256;
+double v1258 = v1257 * v35;
+double v1259 = v1254 + v1258;
+double v1260 = v1253 + v1259;
+double v1261 = -v513;
+double v1262 = v1261 / v41;
+double v1263 = v1262 * v24;
+double v1264 = v954 / v41;
+double v1265 = v1264 * v35;
+double v1266 = v1263 + v1265;
+double v1267 = v103 * v1262;
+double v1268 = -v561;
+double v1269 = v1268 * v113;
+double v1270 = v1261 / v112;
+double v1271 = v116 * v1270;
+double v1272 = v1269 - v1271;
+double v1273 = v1272 * v24;
+double v1274 = v1267 + v1273;
+double v1275 = v91 * v1264;
+double v1276 = v970 * v113;
+double v1277 = v954 / v112;
+double v1278 = v116 * v1277;
+double v1279 = v1276 - v1278;
+double v1280 = v1279 * v35;
+double v1281 = v1275 + v1280;
+double v1282 = v1274 + v1281;
+double v1283 = v185 * v1262;
+double v1284 = -v612;
+double v1285 = v1284 * v113;
+double v1286 = v196 * v1270;
+double v1287 = v1285 - v1286;
+double v1288 = v1287 * v24;
+double v1289 = v1283 + v1288;
+double v1290 = v173 * v1264;
+double v1291 = v989 * v113;
+double v1292 = v196 * v1277;
+double v1293 = v1291 - v1292;
+double v1294 = v1293 * v35;
+double v1295 = v1290 + v1294;
+double v1296 = v1289 + v1295;
+double v1297 = v261 * v1262;
+double v1298 = -v662;
+double v1299 = v1298 * v113;
+double v1300 = v271 * v1270;
+double v1301 = v1299 - v1300;
+double v1302 = v1301 * v24;
+double v1303 = v1297 + v1302;
+double v1304 = v249 * v1264;
+double v1305 = v1009 * v113;
+double v1306 = v271 * v1277;
+double v1307 = v1305 - v1306;
+double v1308 = v1307 * v35;
+double v1309 = v1304 + v1308;
+double v1310 = v1303 + v1309;
+double v1311 = v1162 * v302;
+double v1312 = v1164 * v308;
+double v1313 = v1311 + v1312;
+double v1314 = v338 * v1162;
+double v1315 = v1172 * v302;
+double v1316 = v1314 + v1315;
+double v1317 = v347 * v1164;
+double v1318 = v1179 * v308;
+double v1319 = v1317 + v1318;
+double v1320 = v1316 + v1319;
+double v1321 = v393 * v1162;
+double v1322 = v1187 * v302;
+double v1323 = v1321 + v1322;
+double v1324 = v404 * v1164;
+double v1325 = v1193 * v308;
+double v1326 = v1324 + v1325;
+double v1327 = v1323 + v1326;
+double v1328 = v447 * v1162;
+double v1329 = v1201 * v302;
+double v1330 = v1328 + v1329;
+double v1331 = v456 * v1164;
+double v1332 = v1207 * v308;
+double v1333 = v1331 + v1332;
+double v1334 = v1330 + v1333;
+double v1335 = v1212 * v302;
+double v1336 = v1214 * v308;
+double v1337 = v1335 + v1336;
+double v1338 = v338 * v1212;
+double v1339 = v1222 * v302;
+double v1340 = v1338 + v1339;
+double v1341 = v347 * v1214;
+double v1342 = v1229 * v308;
+double v1343 = v1341 + v1342;
+double v1344 = v1340 + v1343;
+double v1345 = v393 * v1212;
+double v1346 = v1237 * v302;
+double v1347 = v1345 + v1346;
+double v1348 = v404 * v1214;
+double v1349 = v1243 * v308;
+double v1350 = v1348 + v1349;
+double v1351 = v1347 + v1350;
+double v1352 = v447 * v1212;
+double v1353 = v1251 * v302;
+double v1354 = v1352 + v1353;
+double v1355 = v456 * v1214;
+double v1356 = v1257 * v308;
+double v1357 = v1355 + v1356;
+double v1358 = v1354 + v1357;
+double v1359 = v1262 * v302;
+double v1360 = v1264 * v308;
+double v1361 = v1359 + v1360;
+double v1362 = v338 * v1262;
+double v1363 = v1272 * v302;
+double v1364 = v1362 + v1363;
+double v1365 = v347 * v1264;
+double v1366 = v1279 * v308;
+double v1367 = v1365 + v1366;
+double v1368 = v1364 + v1367;
+double v1369 = v393 * v1262;
+double v1370 = v1287 * v302;
+double v1371 = v1369 + v1370;
+double v1372 = v404 * v1264;
+double v1373 = v1293 * v308;
+double v1374 = v1372 + v1373;
+double v1375 = v1371 + v1374;
+double v1376 = v447 * v1262;
+double v1377 = v1301 * v302;
+double v1378 = v1376 + v1377;
+double v1379 = v456 * v1264;
+double v1380 = v1307 * v308;
+double v1381 = v1379 + v1380;
+double v1382 = v1378 + v1381;
+double v1383 = v1162 * v492;
+double v1384 = v1164 * v498;
+double v1385 = v1383 + v1384;
+double v1386 = v527 * v1162;
+double v1387 = v1172 * v492;
+double v1388 = v1386 + v1387;
+double v1389 = v539 * v1164;
+double v1390 = v1179 * v498;
+double v1391 = v1389 + v1390;
+double v1392 = v1388 + v1391;
+double v1393 = v579 * v1162;
+double v1394 = v1187 * v492;
+double v1395 = v1393 + v1394;
+double v1396 = v593 * v1164;
+double v1397 = v1193 * v498;
+double v1398 = v1396 + v1397;
+double v1399 = v1395 + v1398;
+double v1400 = v629 * v1162;
+double v1401 = v1201 * v492;
+double v1402 = v1400 + v1401;
+double v1403 = v641 * v1164;
+double v1404 = v1207 * v498;
+double v1405 = v1403 + v1404;
+double v1406 = v1402 + v1405;
+double v1407 = v1212 * v492;
+double v1408 = v1214 * v498;
+double v1409 = v1407 + v1408;
+double v1410 = v527 * v1212;
+double v1411 = v1222 * v492;
+double v1412 = v1410 + v1411;
+double v1413 = v539 * v1214;
+double v1414 = v1229 * v498;
+double v1415 = v1413 + v1414;
+double v1416 = v1412 + v1415;
+double v1417 = v579 * v1212;
+double v1418 = v1237 * v492;
+double v1419 = v1417 + v1418;
+double v1420 = v593 * v1214;
+double v1421 = v1243 * v498;
+double v1422 = v1420 + v1421;
+double v1423 = v1419 + v1422;
+double v1424 = v629 * v1212;
+double v1425 = v1251 * v492;
+double v1426 = v1424 + v1425;
+double v1427 = v641 * v1214;
+double v1428 = v1257 * v498;
+double v1429 = v1427 + v1428;
+double v1430 = v1426 + v1429;
+double v1431 = v1262 * v492;
+double v1432 = v1264 * v498;
+double v1433 = v1431 + v1432;
+double v1434 = v527 * v1262;
+double v1435 = v1272 * v492;
+double v1436 = v1434 + v1435;
+double v1437 = v539 * v1264;
+double v1438 = v1279 * v498;
+double v1439 = v1437 + v1438;
+double v1440 = v1436 + v1439;
+double v1441 = v579 * v1262;
+double v1442 = v1287 * v492;
+double v1443 = v1441 + v1442;
+double v1444 = v593 * v1264;
+double v1445 = v1293 * v498;
+double v1446 = v1444 + v1445;
+double v1447 = v1443 + v1446;
+double v1448 = v629 * v1262;
+double v1449 = v1301 * v492;
+double v1450 = v1448 + v1449;
+double v1451 = v641 * v1264;
+double v1452 = v1307 * v498;
+double v1453 = v1451 + v1452;
+double v1454 = v1450 + v1453;
+R[0] = v24;
+dR[0] = v57;
+ddR[0] = v146;
+ddR[27] = v222;
+ddR[54] = v297;
+dR[9] = v327;
+ddR[9] = v382;
+ddR[36] = v436;
+ddR[63] = v488;
+dR[18] = v516;
+ddR[18] = v568;
+ddR[45] = v618;
+ddR[72] = v668;
+R[1] = v302;
+dR[1] = v671;
+ddR[1] = v678;
+ddR[28] = v685;
+ddR[55] = v692;
+dR[10] = v695;
+ddR[10] = v702;
+ddR[37] = v709;
+ddR[64] = v716;
+dR[19] = v719;
+ddR[19] = v726;
+ddR[46] = v733;
+ddR[73] = v740;
+R[2] = v492;
+dR[2] = v743;
+ddR[2] = v750;
+ddR[29] = v757;
+ddR[56] = v764;
+dR[11] = v767;
+ddR[11] = v774;
+ddR[38] = v781;
+ddR[65] = v788;
+dR[20] = v791;
+ddR[20] = v798;
+ddR[47] = v805;
+ddR[74] = v812;
+R[3] = v35;
+dR[3] = v823;
+ddR[3] = v843;
+ddR[30] = v861;
+ddR[57] = v880;
+dR[12] = v890;
+ddR[12] = v910;
+ddR[39] = v929;
+ddR[66] = v948;
+dR[21] = v958;
+ddR[21] = v978;
+ddR[48] = v996;
+ddR[75] = v1016;
+R[4] = v308;
+dR[4] = v1019;
+ddR[4] = v1026;
+ddR[31] = v1033;
+ddR[58] = v1040;
+dR[13] = v1043;
+ddR[13] = v1050;
+ddR[40] = v1057;
+ddR[67] = v1064;
+dR[22] = v1067;
+ddR[22] = v1074;
+ddR[49] = v1081;
+ddR[76] = v1088;
+R[5] = v498;
+dR[5] = v1091;
+ddR[5] = v1098;
+ddR[32] = v1105;
+ddR[59] = v1112;
+dR[14] = v1115;
+ddR[14] = v1122;
+ddR[41] = v1129;
+ddR[68] = v1136;
+dR[23] = v1139;
+ddR[23] = v1146;
+ddR[50] = v1153;
+ddR[77] = v1160;
+R[6] = v50;
+dR[6] = v1166;
+ddR[6] = v1182;
+ddR[33] = v1196;
+ddR[60] = v1210;
+dR[15] = v1216;
+ddR[15] = v1232;
+ddR[42] = v1246;
+ddR[69] = v1260;
+dR[24] = v1266;
+ddR[24] = v1282;
+ddR[51] = v1296;
+ddR[78] = v1310;
+R[7] = v320;
+dR[7] = v1313;
+ddR[7] = v1320;
+ddR[34] = v1327;
+ddR[61] = v1334;
+dR[16] = v1337;
+ddR[16] = v1344;
+ddR[43] = v1351;
+ddR[70] = v1358;
+dR[25] = v1361;
+ddR[25] = v1368;
+ddR[52] = v1375;
+ddR[79] = v1382;
+R[8] = v509;
+dR[8] = v1385;
+ddR[8] = v1392;
+ddR[35] = v1399;
+ddR[62] = v1406;
+dR[17] = v1409;
+ddR[17] = v1416;
+ddR[44] = v1423;
+ddR[71] = v1430;
+dR[26] = v1433;
+ddR[26] = v1440;
+ddR[53] = v1447;
+ddR[80] = v1454;
+}
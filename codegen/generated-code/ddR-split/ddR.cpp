@@ -0,0 +1,8 @@
+#include "ddR.h"
+
+void compute_ddR(const double *v, double *ddR) {
+	compute_ddR_State state;
+	compute_ddR_part0(v, ddR, state);
+	compute_ddR_part1(v, ddR, state);
+	compute_ddR_part2(v, ddR, state);
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cmath>
+
+struct compute_ddR_State {
+	double v0;
+	double v1;
+	double v2;
+	double v3;
+	double v9;
+	double v10;
+	double v13;
+	double v14;
+	double v17;
+	double v19;
+	double v21;
+	double v24;
+	double v28;
+	double v29;
+	double v31;
+	double v32;
+	double v36;
+	double v37;
+	double v40;
+	double v42;
+	double v43;
+	double v44;
+	double v46;
+	double v53;
+	double v56;
+	double v57;
+	double v58;
+	double v60;
+	double v63;
+	double v65;
+	double v66;
+	double v70;
+	double v71;
+	double v76;
+	double v88;
+	double v97;
+	double v98;
+	double v101;
+	double v102;
+	double v114;
+	double v117;
+	double v120;
+	double v123;
+	double v124;
+	double v128;
+	double v138;
+	double v143;
+	double v150;
+	double v152;
+	double v155;
+	double v165;
+	double v168;
+	double v172;
+	double v175;
+	double v183;
+	double v186;
+	double v190;
+	double v195;
+	double v197;
+	double v200;
+	double v203;
+	double v204;
+	double v207;
+	double v212;
+	double v218;
+	double v226;
+	double v231;
+	double v239;
+	double v242;
+	double v246;
+	double v252;
+	double v260;
+	double v263;
+	double v267;
+	double v273;
+	double v275;
+	double v279;
+	double v284;
+	double v287;
+	double v292;
+	double v299;
+	double v306;
+	double v308;
+	double v310;
+	double v315;
+	double v325;
+	double v331;
+	double v335;
+	double v344;
+	double v349;
+	double v356;
+	double v363;
+	double v364;
+	double v367;
+	double v377;
+	double v385;
+	double v390;
+	double v397;
+	double v404;
+	double v406;
+	double v410;
+	double v415;
+	double v418;
+	double v423;
+	double v430;
+	double v437;
+	double v438;
+	double v440;
+	double v445;
+	double v449;
+	double v455;
+	double v461;
+	double v464;
+	double v465;
+	double v468;
+	double v472;
+	double v474;
+	double v479;
+	double v486;
+	double v493;
+	double v494;
+	double v495;
+	double v497;
+	double v499;
+	double v507;
+	double v515;
+	double v520;
+	double v527;
+	double v534;
+	double v536;
+	double v540;
+	double v545;
+	double v548;
+	double v553;
+	double v560;
+	double v567;
+	double v643;
+	double v667;
+	double v688;
+	double v706;
+	double v723;
+	double v740;
+	double v754;
+	double v761;
+	double v768;
+	double v795;
+	double v802;
+	double v809;
+	double v828;
+	double v835;
+	double v842;
+	double v856;
+	double v863;
+	double v870;
+	double v896;
+	double v903;
+	double v910;
+	double v928;
+	double v935;
+	double v942;
+	double v956;
+	double v963;
+	double v970;
+	double v971;
+	double v972;
+	double v974;
+	double v976;
+	double v980;
+	double v981;
+	double v984;
+	double v985;
+	double v994;
+	double v997;
+	double v998;
+	double v999;
+};
+
+void compute_ddR_part0(const double *v, double *ddR, compute_ddR_State &state);
+void compute_ddR_part1(const double *v, double *ddR, compute_ddR_State &state);
+void compute_ddR_part2(const double *v, double *ddR, compute_ddR_State &state);
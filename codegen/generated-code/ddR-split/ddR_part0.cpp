@@ -0,0 +1,628 @@
+#include "ddR.h"
+
+void compute_ddR_part0(const double *v, double *ddR, compute_ddR_State &state) {
+	double v0 = v[0];
+	double v1 = v[1];
+	double v2 = v[2];
+	double v3 = 0.5;
+	double v4 = v0 * v0;
+	double v5 = v1 * v1;
+	double v6 = v2 * v2;
+	double v7 = v5 + v6;
+	double v8 = v4 + v7;
+	double v9 = sqrt(v8);
+	double v10 = v3 / v9;
+	double v11 = v0 + v0;
+	double v12 = v10 * v11;
+	double v13 = v9 * v9;
+	double v14 = v2 / v13;
+	double v15 = v12 * v14;
+	double v16 = -v15;
+	double v17 = sin(v9);
+	double v18 = v16 * v17;
+	double v19 = cos(v9);
+	double v20 = v19 * v12;
+	double v21 = v2 / v9;
+	double v22 = v20 * v21;
+	double v23 = v18 + v22;
+	double v24 = v1 / v13;
+	double v25 = v12 * v24;
+	double v26 = -v25;
+	double v27 = -v26;
+	double v28 = v0 / v9;
+	double v29 = -v28;
+	double v30 = v27 * v29;
+	double v31 = v9 / v13;
+	double v32 = v0 / v13;
+	double v33 = v12 * v32;
+	double v34 = v31 - v33;
+	double v35 = -v34;
+	double v36 = v1 / v9;
+	double v37 = -v36;
+	double v38 = v35 * v37;
+	double v39 = v30 + v38;
+	double v40 = 2.0;
+	double v41 = v3 * v9;
+	double v42 = sin(v41);
+	double v43 = v40 * v42;
+	double v44 = v43 * v42;
+	double v45 = v39 * v44;
+	double v46 = cos(v41);
+	double v47 = v3 * v12;
+	double v48 = v46 * v47;
+	double v49 = v48 * v43;
+	double v50 = v48 * v40;
+	double v51 = v50 * v42;
+	double v52 = v49 + v51;
+	double v53 = v29 * v37;
+	double v54 = v52 * v53;
+	double v55 = v45 + v54;
+	double v56 = v23 + v55;
+	double v57 = v0 * v2;
+	double v58 = -v1;
+	double v59 = 1.0;
+	double v60 = -v21;
+	double v61 = v60 * v21;
+	double v62 = v36 * v37;
+	double v63 = v61 + v62;
+	double v64 = v44 * v63;
+	double v65 = v59 + v64;
+	double v66 = v59 - v65;
+	double v67 = v58 * v66;
+	double v68 = v17 * v21;
+	double v69 = v44 * v53;
+	double v70 = v68 + v69;
+	double v71 = -v70;
+	double v72 = v0 * v71;
+	double v73 = v67 + v72;
+	double v74 = v57 + v73;
+	double v75 = -v74;
+	double v76 = v75 / v13;
+	double v77 = v56 * v76;
+	double v78 = v16 * v60;
+	double v79 = -v16;
+	double v80 = v79 * v21;
+	double v81 = v78 + v80;
+	double v82 = v27 * v36;
+	double v83 = v26 * v37;
+	double v84 = v82 + v83;
+	double v85 = v81 + v84;
+	double v86 = v85 * v44;
+	double v87 = v52 * v63;
+	double v88 = v86 + v87;
+	double v89 = -v88;
+	double v90 = v89 * v58;
+	double v91 = -v56;
+	double v92 = v91 * v0;
+	double v93 = v92 + v71;
+	double v94 = v90 + v93;
+	double v95 = v2 + v94;
+	double v96 = -v95;
+	double v97 = v13 * v13;
+	double v98 = v13 / v97;
+	double v99 = v96 * v98;
+	double v100 = v12 * v9;
+	double v101 = v100 + v100;
+	double v102 = v75 / v97;
+	double v103 = v101 * v102;
+	double v104 = v99 - v103;
+	double v105 = v104 * v70;
+	double v106 = v77 + v105;
+	double v107 = v27 * v17;
+	double v108 = v20 * v37;
+	double v109 = v107 + v108;
+	double v110 = v16 * v28;
+	double v111 = v34 * v21;
+	double v112 = v110 + v111;
+	double v113 = v112 * v44;
+	double v114 = v28 * v21;
+	double v115 = v52 * v114;
+	double v116 = v113 + v115;
+	double v117 = v109 + v116;
+	double v118 = v0 * v1;
+	double v119 = v2 * v66;
+	double v120 = -v0;
+	double v121 = v17 * v37;
+	double v122 = v44 * v114;
+	double v123 = v121 + v122;
+	double v124 = -v123;
+	double v125 = v120 * v124;
+	double v126 = v119 + v125;
+	double v127 = v118 + v126;
+	double v128 = v127 / v13;
+	double v129 = v117 * v128;
+	double v130 = v89 * v2;
+	double v131 = -v117;
+	double v132 = v131 * v120;
+	double v133 = -v124;
+	double v134 = v132 + v133;
+	double v135 = v130 + v134;
+	double v136 = v1 + v135;
+	double v137 = v136 * v98;
+	double v138 = v127 / v97;
+	double v139 = v101 * v138;
+	double v140 = v137 - v139;
+	double v141 = v140 * v123;
+	double v142 = v129 + v141;
+	double v143 = v106 + v142;
+	double v144 = v34 * v29;
+	double v145 = v35 * v28;
+	double v146 = v144 + v145;
+	double v147 = v81 + v146;
+	double v148 = v147 * v44;
+	double v149 = v29 * v28;
+	double v150 = v61 + v149;
+	double v151 = v52 * v150;
+	double v152 = v148 + v151;
+	double v153 = v152 * v76;
+	double v154 = v44 * v150;
+	double v155 = v59 + v154;
+	double v156 = v104 * v155;
+	double v157 = v153 + v156;
+	double v158 = v34 * v17;
+	double v159 = v20 * v28;
+	double v160 = v158 + v159;
+	double v161 = v79 * v37;
+	double v162 = v27 * v60;
+	double v163 = v161 + v162;
+	double v164 = v163 * v44;
+	double v165 = v37 * v60;
+	double v166 = v52 * v165;
+	double v167 = v164 + v166;
+	double v168 = v160 + v167;
+	double v169 = v168 * v128;
+	double v170 = v17 * v28;
+	double v171 = v44 * v165;
+	double v172 = v170 + v171;
+	double v173 = v140 * v172;
+	double v174 = v169 + v173;
+	double v175 = v157 + v174;
+	double v176 = v35 * v17;
+	double v177 = v20 * v29;
+	double v178 = v176 + v177;
+	double v179 = v26 * v21;
+	double v180 = v16 * v36;
+	double v181 = v179 + v180;
+	double v182 = v181 * v44;
+	double v183 = v21 * v36;
+	double v184 = v52 * v183;
+	double v185 = v182 + v184;
+	double v186 = v178 + v185;
+	double v187 = v186 * v76;
+	double v188 = v17 * v29;
+	double v189 = v44 * v183;
+	double v190 = v188 + v189;
+	double v191 = v104 * v190;
+	double v192 = v187 + v191;
+	double v193 = v84 + v146;
+	double v194 = v193 * v44;
+	double v195 = v62 + v149;
+	double v196 = v52 * v195;
+	double v197 = v194 + v196;
+	double v198 = v197 * v128;
+	double v199 = v44 * v195;
+	double v200 = v59 + v199;
+	double v201 = v140 * v200;
+	double v202 = v198 + v201;
+	double v203 = v192 + v202;
+	double v204 = v74 / v13;
+	double v205 = v88 * v204;
+	double v206 = v95 * v98;
+	double v207 = v74 / v97;
+	double v208 = v101 * v207;
+	double v209 = v206 - v208;
+	double v210 = v209 * v65;
+	double v211 = v205 + v210;
+	double v212 = -v2;
+	double v213 = v212 * v71;
+	double v214 = v1 * v124;
+	double v215 = v213 + v214;
+	double v216 = v4 + v215;
+	double v217 = -v216;
+	double v218 = v217 / v13;
+	double v219 = v117 * v218;
+	double v220 = v91 * v212;
+	double v221 = v131 * v1;
+	double v222 = v220 + v221;
+	double v223 = v11 + v222;
+	double v224 = -v223;
+	double v225 = v224 * v98;
+	double v226 = v217 / v97;
+	double v227 = v101 * v226;
+	double v228 = v225 - v227;
+	double v229 = v228 * v123;
+	double v230 = v219 + v229;
+	double v231 = v211 + v230;
+	double v232 = v79 * v17;
+	double v233 = v20 * v60;
+	double v234 = v232 + v233;
+	double v235 = v34 * v36;
+	double v236 = v26 * v28;
+	double v237 = v235 + v236;
+	double v238 = v237 * v44;
+	double v239 = v36 * v28;
+	double v240 = v52 * v239;
+	double v241 = v238 + v240;
+	double v242 = v234 + v241;
+	double v243 = v242 * v204;
+	double v244 = v17 * v60;
+	double v245 = v44 * v239;
+	double v246 = v244 + v245;
+	double v247 = v209 * v246;
+	double v248 = v243 + v247;
+	double v249 = v168 * v218;
+	double v250 = v228 * v172;
+	double v251 = v249 + v250;
+	double v252 = v248 + v251;
+	double v253 = v26 * v17;
+	double v254 = v20 * v36;
+	double v255 = v253 + v254;
+	double v256 = v35 * v60;
+	double v257 = v79 * v29;
+	double v258 = v256 + v257;
+	double v259 = v258 * v44;
+	double v260 = v60 * v29;
+	double v261 = v52 * v260;
+	double v262 = v259 + v261;
+	double v263 = v255 + v262;
+	double v264 = v263 * v204;
+	double v265 = v17 * v36;
+	double v266 = v44 * v260;
+	double v267 = v265 + v266;
+	double v268 = v209 * v267;
+	double v269 = v264 + v268;
+	double v270 = v197 * v218;
+	double v271 = v228 * v200;
+	double v272 = v270 + v271;
+	double v273 = v269 + v272;
+	double v274 = -v127;
+	double v275 = v274 / v13;
+	double v276 = v88 * v275;
+	double v277 = -v136;
+	double v278 = v277 * v98;
+	double v279 = v274 / v97;
+	double v280 = v101 * v279;
+	double v281 = v278 - v280;
+	double v282 = v281 * v65;
+	double v283 = v276 + v282;
+	double v284 = v216 / v13;
+	double v285 = v56 * v284;
+	double v286 = v223 * v98;
+	double v287 = v216 / v97;
+	double v288 = v101 * v287;
+	double v289 = v286 - v288;
+	double v290 = v289 * v70;
+	double v291 = v285 + v290;
+	double v292 = v283 + v291;
+	double v293 = v242 * v275;
+	double v294 = v281 * v246;
+	double v295 = v293 + v294;
+	double v296 = v152 * v284;
+	double v297 = v289 * v155;
+	double v298 = v296 + v297;
+	double v299 = v295 + v298;
+	double v300 = v263 * v275;
+	double v301 = v281 * v267;
+	double v302 = v300 + v301;
+	double v303 = v186 * v284;
+	double v304 = v289 * v190;
+	double v305 = v303 + v304;
+	double v306 = v302 + v305;
+	double v307 = v1 * v2;
+	double v308 = -v246;
+	double v309 = v58 * v308;
+	double v310 = v59 - v155;
+	double v311 = v0 * v310;
+	double v312 = v309 + v311;
+	double v313 = v307 + v312;
+	double v314 = -v313;
+	double v315 = v314 / v13;
+	double v316 = v56 * v315;
+	double v317 = -v242;
+	double v318 = v317 * v58;
+	double v319 = -v152;
+	double v320 = v319 * v0;
+	double v321 = v320 + v310;
+	double v322 = v318 + v321;
+	double v323 = -v322;
+	double v324 = v323 * v98;
+	double v325 = v314 / v97;
+	double v326 = v101 * v325;
+	double v327 = v324 - v326;
+	double v328 = v327 * v70;
+	double v329 = v316 + v328;
+	double v330 = v2 * v308;
+	double v331 = -v172;
+	double v332 = v120 * v331;
+	double v333 = v330 + v332;
+	double v334 = v5 + v333;
+	double v335 = v334 / v13;
+	double v336 = v117 * v335;
+	double v337 = v317 * v2;
+	double v338 = -v168;
+	double v339 = v338 * v120;
+	double v340 = -v331;
+	double v341 = v339 + v340;
+	double v342 = v337 + v341;
+	double v343 = v342 * v98;
+	double v344 = v334 / v97;
+	double v345 = v101 * v344;
+	double v346 = v343 - v345;
+	double v347 = v346 * v123;
+	double v348 = v336 + v347;
+	double v349 = v329 + v348;
+	double v350 = v152 * v315;
+	double v351 = v327 * v155;
+	double v352 = v350 + v351;
+	double v353 = v168 * v335;
+	double v354 = v346 * v172;
+	double v355 = v353 + v354;
+	double v356 = v352 + v355;
+	double v357 = v186 * v315;
+	double v358 = v327 * v190;
+	double v359 = v357 + v358;
+	double v360 = v197 * v335;
+	double v361 = v346 * v200;
+	double v362 = v360 + v361;
+	double v363 = v359 + v362;
+	double v364 = v313 / v13;
+	double v365 = v88 * v364;
+	double v366 = v322 * v98;
+	double v367 = v313 / v97;
+	double v368 = v101 * v367;
+	double v369 = v366 - v368;
+	double v370 = v369 * v65;
+	double v371 = v365 + v370;
+	double v372 = v212 * v310;
+	double v373 = v1 * v331;
+	double v374 = v372 + v373;
+	double v375 = v118 + v374;
+	double v376 = -v375;
+	double v377 = v376 / v13;
+	double v378 = v117 * v377;
+	double v379 = v319 * v212;
+	double v380 = v338 * v1;
+	double v381 = v379 + v380;
+	double v382 = v1 + v381;
+	double v383 = -v382;
+	double v384 = v383 * v98;
+	double v385 = v376 / v97;
+	double v386 = v101 * v385;
+	double v387 = v384 - v386;
+	double v388 = v387 * v123;
+	double v389 = v378 + v388;
+	double v390 = v371 + v389;
+	double v391 = v242 * v364;
+	double v392 = v369 * v246;
+	double v393 = v391 + v392;
+	double v394 = v168 * v377;
+	double v395 = v387 * v172;
+	double v396 = v394 + v395;
+	double v397 = v393 + v396;
+	double v398 = v263 * v364;
+	double v399 = v369 * v267;
+	double v400 = v398 + v399;
+	double v401 = v197 * v377;
+	double v402 = v387 * v200;
+	double v403 = v401 + v402;
+	double v404 = v400 + v403;
+	double v405 = -v334;
+	double v406 = v405 / v13;
+	double v407 = v88 * v406;
+	double v408 = -v342;
+	double v409 = v408 * v98;
+	double v410 = v405 / v97;
+	double v411 = v101 * v410;
+	double v412 = v409 - v411;
+	double v413 = v412 * v65;
+	double v414 = v407 + v413;
+	double v415 = v375 / v13;
+	double v416 = v56 * v415;
+	double v417 = v382 * v98;
+	double v418 = v375 / v97;
+	double v419 = v101 * v418;
+	double v420 = v417 - v419;
+	double v421 = v420 * v70;
+	double v422 = v416 + v421;
+	double v423 = v414 + v422;
+	double v424 = v242 * v406;
+	double v425 = v412 * v246;
+	double v426 = v424 + v425;
+	double v427 = v152 * v415;
+	double v428 = v420 * v155;
+	double v429 = v427 + v428;
+	double v430 = v426 + v429;
+	double v431 = v263 * v406;
+	double v432 = v412 * v267;
+	double v433 = v431 + v432;
+	double v434 = v186 * v415;
+	double v435 = v420 * v190;
+	double v436 = v434 + v435;
+	double v437 = v433 + v436;
+	double v438 = -v267;
+	double v439 = v58 * v438;
+	double v440 = -v190;
+	double v441 = v0 * v440;
+	double v442 = v439 + v441;
+	double v443 = v6 + v442;
+	double v444 = -v443;
+	double v445 = v444 / v13;
+	double v446 = v56 * v445;
+	double v447 = -v263;
+	double v448 = v447 * v58;
+	double v449 = -v186;
+	double v450 = v449 * v0;
+	double v451 = v450 + v440;
+	double v452 = v448 + v451;
+	double v453 = -v452;
+	double v454 = v453 * v98;
+	double v455 = v444 / v97;
+	double v456 = v101 * v455;
+	double v457 = v454 - v456;
+	double v458 = v457 * v70;
+	double v459 = v446 + v458;
+	double v460 = v2 * v438;
+	double v461 = v59 - v200;
+	double v462 = v120 * v461;
+	double v463 = v460 + v462;
+	double v464 = v307 + v463;
+	double v465 = v464 / v13;
+	double v466 = v117 * v465;
+	double v467 = v447 * v2;
+	double v468 = -v197;
+	double v469 = v468 * v120;
+	double v470 = -v461;
+	double v471 = v469 + v470;
+	double v472 = v467 + v471;
+	double v473 = v472 * v98;
+	double v474 = v464 / v97;
+	double v475 = v101 * v474;
+	double v476 = v473 - v475;
+	double v477 = v476 * v123;
+	double v478 = v466 + v477;
+	double v479 = v459 + v478;
+	double v480 = v152 * v445;
+	double v481 = v457 * v155;
+	double v482 = v480 + v481;
+	double v483 = v168 * v465;
+	double v484 = v476 * v172;
+	double v485 = v483 + v484;
+	double v486 = v482 + v485;
+	double v487 = v186 * v445;
+	double v488 = v457 * v190;
+	double v489 = v487 + v488;
+	double v490 = v197 * v465;
+	double v491 = v476 * v200;
+	double v492 = v490 + v491;
+	double v493 = v489 + v492;
+	double v494 = v443 / v13;
+	double v495 = v88 * v494;
+	double v496 = v452 * v98;
+	double v497 = v443 / v97;
+	double v498 = v101 * v497;
+	double v499 = v496 - v498;
+	state.v0 = v0;
+	state.v1 = v1;
+	state.v2 = v2;
+	state.v3 = v3;
+	state.v9 = v9;
+	state.v10 = v10;
+	state.v13 = v13;
+	state.v14 = v14;
+	state.v17 = v17;
+	state.v19 = v19;
+	state.v21 = v21;
+	state.v24 = v24;
+	state.v28 = v28;
+	state.v29 = v29;
+	state.v31 = v31;
+	state.v32 = v32;
+	state.v36 = v36;
+	state.v37 = v37;
+	state.v40 = v40;
+	state.v42 = v42;
+	state.v43 = v43;
+	state.v44 = v44;
+	state.v46 = v46;
+	state.v53 = v53;
+	state.v56 = v56;
+	state.v57 = v57;
+	state.v58 = v58;
+	state.v60 = v60;
+	state.v63 = v63;
+	state.v65 = v65;
+	state.v66 = v66;
+	state.v70 = v70;
+	state.v71 = v71;
+	state.v76 = v76;
+	state.v88 = v88;
+	state.v97 = v97;
+	state.v98 = v98;
+	state.v101 = v101;
+	state.v102 = v102;
+	state.v114 = v114;
+	state.v117 = v117;
+	state.v120 = v120;
+	state.v123 = v123;
+	state.v124 = v124;
+	state.v128 = v128;
+	state.v138 = v138;
+	state.v143 = v143;
+	state.v150 = v150;
+	state.v152 = v152;
+	state.v155 = v155;
+	state.v165 = v165;
+	state.v168 = v168;
+	state.v172 = v172;
+	state.v175 = v175;
+	state.v183 = v183;
+	state.v186 = v186;
+	state.v190 = v190;
+	state.v195 = v195;
+	state.v197 = v197;
+	state.v200 = v200;
+	state.v203 = v203;
+	state.v204 = v204;
+	state.v207 = v207;
+	state.v212 = v212;
+	state.v218 = v218;
+	state.v226 = v226;
+	state.v231 = v231;
+	state.v239 = v239;
+	state.v242 = v242;
+	state.v246 = v246;
+	state.v252 = v252;
+	state.v260 = v260;
+	state.v263 = v263;
+	state.v267 = v267;
+	state.v273 = v273;
+	state.v275 = v275;
+	state.v279 = v279;
+	state.v284 = v284;
+	state.v287 = v287;
+	state.v292 = v292;
+	state.v299 = v299;
+	state.v306 = v306;
+	state.v308 = v308;
+	state.v310 = v310;
+	state.v315 = v315;
+	state.v325 = v325;
+	state.v331 = v331;
+	state.v335 = v335;
+	state.v344 = v344;
+	state.v349 = v349;
+	state.v356 = v356;
+	state.v363 = v363;
+	state.v364 = v364;
+	state.v367 = v367;
+	state.v377 = v377;
+	state.v385 = v385;
+	state.v390 = v390;
+	state.v397 = v397;
+	state.v404 = v404;
+	state.v406 = v406;
+	state.v410 = v410;
+	state.v415 = v415;
+	state.v418 = v418;
+	state.v423 = v423;
+	state.v430 = v430;
+	state.v437 = v437;
+	state.v438 = v438;
+	state.v440 = v440;
+	state.v445 = v445;
+	state.v449 = v449;
+	state.v455 = v455;
+	state.v461 = v461;
+	state.v464 = v464;
+	state.v465 = v465;
+	state.v468 = v468;
+	state.v472 = v472;
+	state.v474 = v474;
+	state.v479 = v479;
+	state.v486 = v486;
+	state.v493 = v493;
+	state.v494 = v494;
+	state.v495 = v495;
+	state.v497 = v497;
+	state.v499 = v499;
+}
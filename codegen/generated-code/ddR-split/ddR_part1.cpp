@@ -0,0 +1,656 @@
+#include "ddR.h"
+
+void compute_ddR_part1(const double *v, double *ddR, compute_ddR_State &state) {
+	const double v0 = state.v0;
+	const double v1 = state.v1;
+	const double v2 = state.v2;
+	const double v3 = state.v3;
+	const double v9 = state.v9;
+	const double v10 = state.v10;
+	const double v13 = state.v13;
+	const double v14 = state.v14;
+	const double v17 = state.v17;
+	const double v19 = state.v19;
+	const double v21 = state.v21;
+	const double v24 = state.v24;
+	const double v28 = state.v28;
+	const double v29 = state.v29;
+	const double v31 = state.v31;
+	const double v32 = state.v32;
+	const double v36 = state.v36;
+	const double v37 = state.v37;
+	const double v40 = state.v40;
+	const double v42 = state.v42;
+	const double v43 = state.v43;
+	const double v44 = state.v44;
+	const double v46 = state.v46;
+	const double v53 = state.v53;
+	const double v56 = state.v56;
+	const double v57 = state.v57;
+	const double v58 = state.v58;
+	const double v60 = state.v60;
+	const double v63 = state.v63;
+	const double v65 = state.v65;
+	const double v66 = state.v66;
+	const double v70 = state.v70;
+	const double v76 = state.v76;
+	const double v88 = state.v88;
+	const double v97 = state.v97;
+	const double v98 = state.v98;
+	const double v101 = state.v101;
+	const double v102 = state.v102;
+	const double v114 = state.v114;
+	const double v117 = state.v117;
+	const double v120 = state.v120;
+	const double v123 = state.v123;
+	const double v124 = state.v124;
+	const double v128 = state.v128;
+	const double v138 = state.v138;
+	const double v150 = state.v150;
+	const double v152 = state.v152;
+	const double v155 = state.v155;
+	const double v165 = state.v165;
+	const double v168 = state.v168;
+	const double v172 = state.v172;
+	const double v183 = state.v183;
+	const double v186 = state.v186;
+	const double v190 = state.v190;
+	const double v195 = state.v195;
+	const double v197 = state.v197;
+	const double v200 = state.v200;
+	const double v204 = state.v204;
+	const double v207 = state.v207;
+	const double v212 = state.v212;
+	const double v218 = state.v218;
+	const double v226 = state.v226;
+	const double v239 = state.v239;
+	const double v242 = state.v242;
+	const double v246 = state.v246;
+	const double v260 = state.v260;
+	const double v263 = state.v263;
+	const double v267 = state.v267;
+	const double v275 = state.v275;
+	const double v279 = state.v279;
+	const double v284 = state.v284;
+	const double v287 = state.v287;
+	const double v308 = state.v308;
+	const double v315 = state.v315;
+	const double v325 = state.v325;
+	const double v331 = state.v331;
+	const double v335 = state.v335;
+	const double v344 = state.v344;
+	const double v364 = state.v364;
+	const double v367 = state.v367;
+	const double v377 = state.v377;
+	const double v385 = state.v385;
+	const double v406 = state.v406;
+	const double v410 = state.v410;
+	const double v415 = state.v415;
+	const double v418 = state.v418;
+	const double v438 = state.v438;
+	const double v440 = state.v440;
+	const double v445 = state.v445;
+	const double v449 = state.v449;
+	const double v455 = state.v455;
+	const double v461 = state.v461;
+	const double v464 = state.v464;
+	const double v465 = state.v465;
+	const double v468 = state.v468;
+	const double v472 = state.v472;
+	const double v474 = state.v474;
+	const double v494 = state.v494;
+	const double v495 = state.v495;
+	const double v497 = state.v497;
+	const double v499 = state.v499;
+	double v500 = v499 * v65;
+	double v501 = v495 + v500;
+	double v502 = v212 * v440;
+	double v503 = v1 * v461;
+	double v504 = v502 + v503;
+	double v505 = v57 + v504;
+	double v506 = -v505;
+	double v507 = v506 / v13;
+	double v508 = v117 * v507;
+	double v509 = v449 * v212;
+	double v510 = v468 * v1;
+	double v511 = v509 + v510;
+	double v512 = v2 + v511;
+	double v513 = -v512;
+	double v514 = v513 * v98;
+	double v515 = v506 / v97;
+	double v516 = v101 * v515;
+	double v517 = v514 - v516;
+	double v518 = v517 * v123;
+	double v519 = v508 + v518;
+	double v520 = v501 + v519;
+	double v521 = v242 * v494;
+	double v522 = v499 * v246;
+	double v523 = v521 + v522;
+	double v524 = v168 * v507;
+	double v525 = v517 * v172;
+	double v526 = v524 + v525;
+	double v527 = v523 + v526;
+	double v528 = v263 * v494;
+	double v529 = v499 * v267;
+	double v530 = v528 + v529;
+	double v531 = v197 * v507;
+	double v532 = v517 * v200;
+	double v533 = v531 + v532;
+	double v534 = v530 + v533;
+	double v535 = -v464;
+	double v536 = v535 / v13;
+	double v537 = v88 * v536;
+	double v538 = -v472;
+	double v539 = v538 * v98;
+	double v540 = v535 / v97;
+	double v541 = v101 * v540;
+	double v542 = v539 - v541;
+	double v543 = v542 * v65;
+	double v544 = v537 + v543;
+	double v545 = v505 / v13;
+	double v546 = v56 * v545;
+	double v547 = v512 * v98;
+	double v548 = v505 / v97;
+	double v549 = v101 * v548;
+	double v550 = v547 - v549;
+	double v551 = v550 * v70;
+	double v552 = v546 + v551;
+	double v553 = v544 + v552;
+	double v554 = v242 * v536;
+	double v555 = v542 * v246;
+	double v556 = v554 + v555;
+	double v557 = v152 * v545;
+	double v558 = v550 * v155;
+	double v559 = v557 + v558;
+	double v560 = v556 + v559;
+	double v561 = v263 * v536;
+	double v562 = v542 * v267;
+	double v563 = v561 + v562;
+	double v564 = v186 * v545;
+	double v565 = v550 * v190;
+	double v566 = v564 + v565;
+	double v567 = v563 + v566;
+	double v568 = v1 + v1;
+	double v569 = v10 * v568;
+	double v570 = v569 * v14;
+	double v571 = -v570;
+	double v572 = v571 * v17;
+	double v573 = v19 * v569;
+	double v574 = v573 * v21;
+	double v575 = v572 + v574;
+	double v576 = v569 * v24;
+	double v577 = v31 - v576;
+	double v578 = -v577;
+	double v579 = v578 * v29;
+	double v580 = v569 * v32;
+	double v581 = -v580;
+	double v582 = -v581;
+	double v583 = v582 * v37;
+	double v584 = v579 + v583;
+	double v585 = v584 * v44;
+	double v586 = v3 * v569;
+	double v587 = v46 * v586;
+	double v588 = v587 * v43;
+	double v589 = v587 * v40;
+	double v590 = v589 * v42;
+	double v591 = v588 + v590;
+	double v592 = v591 * v53;
+	double v593 = v585 + v592;
+	double v594 = v575 + v593;
+	double v595 = v594 * v76;
+	double v596 = v571 * v60;
+	double v597 = -v571;
+	double v598 = v597 * v21;
+	double v599 = v596 + v598;
+	double v600 = v578 * v36;
+	double v601 = v577 * v37;
+	double v602 = v600 + v601;
+	double v603 = v599 + v602;
+	double v604 = v603 * v44;
+	double v605 = v591 * v63;
+	double v606 = v604 + v605;
+	double v607 = -v606;
+	double v608 = v607 * v58;
+	double v609 = -v66;
+	double v610 = v608 + v609;
+	double v611 = -v594;
+	double v612 = v611 * v0;
+	double v613 = v610 + v612;
+	double v614 = -v613;
+	double v615 = v614 * v98;
+	double v616 = v569 * v9;
+	double v617 = v616 + v616;
+	double v618 = v617 * v102;
+	double v619 = v615 - v618;
+	double v620 = v619 * v70;
+	double v621 = v595 + v620;
+	double v622 = v578 * v17;
+	double v623 = v573 * v37;
+	double v624 = v622 + v623;
+	double v625 = v571 * v28;
+	double v626 = v581 * v21;
+	double v627 = v625 + v626;
+	double v628 = v627 * v44;
+	double v629 = v591 * v114;
+	double v630 = v628 + v629;
+	double v631 = v624 + v630;
+	double v632 = v631 * v128;
+	double v633 = v607 * v2;
+	double v634 = -v631;
+	double v635 = v634 * v120;
+	double v636 = v633 + v635;
+	double v637 = v0 + v636;
+	double v638 = v637 * v98;
+	double v639 = v617 * v138;
+	double v640 = v638 - v639;
+	double v641 = v640 * v123;
+	double v642 = v632 + v641;
+	double v643 = v621 + v642;
+	double v644 = v581 * v29;
+	double v645 = v582 * v28;
+	double v646 = v644 + v645;
+	double v647 = v599 + v646;
+	double v648 = v647 * v44;
+	double v649 = v591 * v150;
+	double v650 = v648 + v649;
+	double v651 = v650 * v76;
+	double v652 = v619 * v155;
+	double v653 = v651 + v652;
+	double v654 = v581 * v17;
+	double v655 = v573 * v28;
+	double v656 = v654 + v655;
+	double v657 = v597 * v37;
+	double v658 = v578 * v60;
+	double v659 = v657 + v658;
+	double v660 = v659 * v44;
+	double v661 = v591 * v165;
+	double v662 = v660 + v661;
+	double v663 = v656 + v662;
+	double v664 = v663 * v128;
+	double v665 = v640 * v172;
+	double v666 = v664 + v665;
+	double v667 = v653 + v666;
+	double v668 = v582 * v17;
+	double v669 = v573 * v29;
+	double v670 = v668 + v669;
+	double v671 = v577 * v21;
+	double v672 = v571 * v36;
+	double v673 = v671 + v672;
+	double v674 = v673 * v44;
+	double v675 = v591 * v183;
+	double v676 = v674 + v675;
+	double v677 = v670 + v676;
+	double v678 = v677 * v76;
+	double v679 = v619 * v190;
+	double v680 = v678 + v679;
+	double v681 = v602 + v646;
+	double v682 = v681 * v44;
+	double v683 = v591 * v195;
+	double v684 = v682 + v683;
+	double v685 = v684 * v128;
+	double v686 = v640 * v200;
+	double v687 = v685 + v686;
+	double v688 = v680 + v687;
+	double v689 = v606 * v204;
+	double v690 = v613 * v98;
+	double v691 = v617 * v207;
+	double v692 = v690 - v691;
+	double v693 = v692 * v65;
+	double v694 = v689 + v693;
+	double v695 = v631 * v218;
+	double v696 = v611 * v212;
+	double v697 = v634 * v1;
+	double v698 = v697 + v124;
+	double v699 = v696 + v698;
+	double v700 = -v699;
+	double v701 = v700 * v98;
+	double v702 = v617 * v226;
+	double v703 = v701 - v702;
+	double v704 = v703 * v123;
+	double v705 = v695 + v704;
+	double v706 = v694 + v705;
+	double v707 = v597 * v17;
+	double v708 = v573 * v60;
+	double v709 = v707 + v708;
+	double v710 = v581 * v36;
+	double v711 = v577 * v28;
+	double v712 = v710 + v711;
+	double v713 = v712 * v44;
+	double v714 = v591 * v239;
+	double v715 = v713 + v714;
+	double v716 = v709 + v715;
+	double v717 = v716 * v204;
+	double v718 = v692 * v246;
+	double v719 = v717 + v718;
+	double v720 = v663 * v218;
+	double v721 = v703 * v172;
+	double v722 = v720 + v721;
+	double v723 = v719 + v722;
+	double v724 = v577 * v17;
+	double v725 = v573 * v36;
+	double v726 = v724 + v725;
+	double v727 = v582 * v60;
+	double v728 = v597 * v29;
+	double v729 = v727 + v728;
+	double v730 = v729 * v44;
+	double v731 = v591 * v260;
+	double v732 = v730 + v731;
+	double v733 = v726 + v732;
+	double v734 = v733 * v204;
+	double v735 = v692 * v267;
+	double v736 = v734 + v735;
+	double v737 = v684 * v218;
+	double v738 = v703 * v200;
+	double v739 = v737 + v738;
+	double v740 = v736 + v739;
+	double v741 = v606 * v275;
+	double v742 = -v637;
+	double v743 = v742 * v98;
+	double v744 = v617 * v279;
+	double v745 = v743 - v744;
+	double v746 = v745 * v65;
+	double v747 = v741 + v746;
+	double v748 = v594 * v284;
+	double v749 = v699 * v98;
+	double v750 = v617 * v287;
+	double v751 = v749 - v750;
+	double v752 = v751 * v70;
+	double v753 = v748 + v752;
+	double v754 = v747 + v753;
+	double v755 = v716 * v275;
+	double v756 = v745 * v246;
+	double v757 = v755 + v756;
+	double v758 = v650 * v284;
+	double v759 = v751 * v155;
+	double v760 = v758 + v759;
+	double v761 = v757 + v760;
+	double v762 = v733 * v275;
+	double v763 = v745 * v267;
+	double v764 = v762 + v763;
+	double v765 = v677 * v284;
+	double v766 = v751 * v190;
+	double v767 = v765 + v766;
+	double v768 = v764 + v767;
+	double v769 = v594 * v315;
+	double v770 = -v716;
+	double v771 = v770 * v58;
+	double v772 = -v308;
+	double v773 = v771 + v772;
+	double v774 = -v650;
+	double v775 = v774 * v0;
+	double v776 = v773 + v775;
+	double v777 = v2 + v776;
+	double v778 = -v777;
+	double v779 = v778 * v98;
+	double v780 = v617 * v325;
+	double v781 = v779 - v780;
+	double v782 = v781 * v70;
+	double v783 = v769 + v782;
+	double v784 = v631 * v335;
+	double v785 = v770 * v2;
+	double v786 = -v663;
+	double v787 = v786 * v120;
+	double v788 = v785 + v787;
+	double v789 = v568 + v788;
+	double v790 = v789 * v98;
+	double v791 = v617 * v344;
+	double v792 = v790 - v791;
+	double v793 = v792 * v123;
+	double v794 = v784 + v793;
+	double v795 = v783 + v794;
+	double v796 = v650 * v315;
+	double v797 = v781 * v155;
+	double v798 = v796 + v797;
+	double v799 = v663 * v335;
+	double v800 = v792 * v172;
+	double v801 = v799 + v800;
+	double v802 = v798 + v801;
+	double v803 = v677 * v315;
+	double v804 = v781 * v190;
+	double v805 = v803 + v804;
+	double v806 = v684 * v335;
+	double v807 = v792 * v200;
+	double v808 = v806 + v807;
+	double v809 = v805 + v808;
+	double v810 = v606 * v364;
+	double v811 = v777 * v98;
+	double v812 = v617 * v367;
+	double v813 = v811 - v812;
+	double v814 = v813 * v65;
+	double v815 = v810 + v814;
+	double v816 = v631 * v377;
+	double v817 = v774 * v212;
+	double v818 = v786 * v1;
+	double v819 = v818 + v331;
+	double v820 = v817 + v819;
+	double v821 = v0 + v820;
+	double v822 = -v821;
+	double v823 = v822 * v98;
+	double v824 = v617 * v385;
+	double v825 = v823 - v824;
+	double v826 = v825 * v123;
+	double v827 = v816 + v826;
+	double v828 = v815 + v827;
+	double v829 = v716 * v364;
+	double v830 = v813 * v246;
+	double v831 = v829 + v830;
+	double v832 = v663 * v377;
+	double v833 = v825 * v172;
+	double v834 = v832 + v833;
+	double v835 = v831 + v834;
+	double v836 = v733 * v364;
+	double v837 = v813 * v267;
+	double v838 = v836 + v837;
+	double v839 = v684 * v377;
+	double v840 = v825 * v200;
+	double v841 = v839 + v840;
+	double v842 = v838 + v841;
+	double v843 = v606 * v406;
+	double v844 = -v789;
+	double v845 = v844 * v98;
+	double v846 = v617 * v410;
+	double v847 = v845 - v846;
+	double v848 = v847 * v65;
+	double v849 = v843 + v848;
+	double v850 = v594 * v415;
+	double v851 = v821 * v98;
+	double v852 = v617 * v418;
+	double v853 = v851 - v852;
+	double v854 = v853 * v70;
+	double v855 = v850 + v854;
+	double v856 = v849 + v855;
+	double v857 = v716 * v406;
+	double v858 = v847 * v246;
+	double v859 = v857 + v858;
+	double v860 = v650 * v415;
+	double v861 = v853 * v155;
+	double v862 = v860 + v861;
+	double v863 = v859 + v862;
+	double v864 = v733 * v406;
+	double v865 = v847 * v267;
+	double v866 = v864 + v865;
+	double v867 = v677 * v415;
+	double v868 = v853 * v190;
+	double v869 = v867 + v868;
+	double v870 = v866 + v869;
+	double v871 = v594 * v445;
+	double v872 = -v733;
+	double v873 = v872 * v58;
+	double v874 = -v438;
+	double v875 = v873 + v874;
+	double v876 = -v677;
+	double v877 = v876 * v0;
+	double v878 = v875 + v877;
+	double v879 = -v878;
+	double v880 = v879 * v98;
+	double v881 = v617 * v455;
+	double v882 = v880 - v881;
+	double v883 = v882 * v70;
+	double v884 = v871 + v883;
+	double v885 = v631 * v465;
+	double v886 = v872 * v2;
+	double v887 = -v684;
+	double v888 = v887 * v120;
+	double v889 = v886 + v888;
+	double v890 = v2 + v889;
+	double v891 = v890 * v98;
+	double v892 = v617 * v474;
+	double v893 = v891 - v892;
+	double v894 = v893 * v123;
+	double v895 = v885 + v894;
+	double v896 = v884 + v895;
+	double v897 = v650 * v445;
+	double v898 = v882 * v155;
+	double v899 = v897 + v898;
+	double v900 = v663 * v465;
+	double v901 = v893 * v172;
+	double v902 = v900 + v901;
+	double v903 = v899 + v902;
+	double v904 = v677 * v445;
+	double v905 = v882 * v190;
+	double v906 = v904 + v905;
+	double v907 = v684 * v465;
+	double v908 = v893 * v200;
+	double v909 = v907 + v908;
+	double v910 = v906 + v909;
+	double v911 = v606 * v494;
+	double v912 = v878 * v98;
+	double v913 = v617 * v497;
+	double v914 = v912 - v913;
+	double v915 = v914 * v65;
+	double v916 = v911 + v915;
+	double v917 = v631 * v507;
+	double v918 = v876 * v212;
+	double v919 = v887 * v1;
+	double v920 = v919 + v461;
+	double v921 = v918 + v920;
+	double v922 = -v921;
+	double v923 = v922 * v98;
+	double v924 = v617 * v515;
+	double v925 = v923 - v924;
+	double v926 = v925 * v123;
+	double v927 = v917 + v926;
+	double v928 = v916 + v927;
+	double v929 = v716 * v494;
+	double v930 = v914 * v246;
+	double v931 = v929 + v930;
+	double v932 = v663 * v507;
+	double v933 = v925 * v172;
+	double v934 = v932 + v933;
+	double v935 = v931 + v934;
+	double v936 = v733 * v494;
+	double v937 = v914 * v267;
+	double v938 = v936 + v937;
+	double v939 = v684 * v507;
+	double v940 = v925 * v200;
+	double v941 = v939 + v940;
+	double v942 = v938 + v941;
+	double v943 = v606 * v536;
+	double v944 = -v890;
+	double v945 = v944 * v98;
+	double v946 = v617 * v540;
+	double v947 = v945 - v946;
+	double v948 = v947 * v65;
+	double v949 = v943 + v948;
+	double v950 = v594 * v545;
+	double v951 = v921 * v98;
+	double v952 = v617 * v548;
+	double v953 = v951 - v952;
+	double v954 = v953 * v70;
+	double v955 = v950 + v954;
+	double v956 = v949 + v955;
+	double v957 = v716 * v536;
+	double v958 = v947 * v246;
+	double v959 = v957 + v958;
+	double v960 = v650 * v545;
+	double v961 = v953 * v155;
+	double v962 = v960 + v961;
+	double v963 = v959 + v962;
+	double v964 = v733 * v536;
+	double v965 = v947 * v267;
+	double v966 = v964 + v965;
+	double v967 = v677 * v545;
+	double v968 = v953 * v190;
+	double v969 = v967 + v968;
+	double v970 = v966 + v969;
+	double v971 = v2 + v2;
+	double v972 = v10 * v971;
+	double v973 = v972 * v14;
+	double v974 = v31 - v973;
+	double v975 = v974 * v17;
+	double v976 = v19 * v972;
+	double v977 = v976 * v21;
+	double v978 = v975 + v977;
+	double v979 = v972 * v24;
+	double v980 = -v979;
+	double v981 = -v980;
+	double v982 = v981 * v29;
+	double v983 = v972 * v32;
+	double v984 = -v983;
+	double v985 = -v984;
+	double v986 = v985 * v37;
+	double v987 = v982 + v986;
+	double v988 = v987 * v44;
+	double v989 = v3 * v972;
+	double v990 = v46 * v989;
+	double v991 = v990 * v43;
+	double v992 = v990 * v40;
+	double v993 = v992 * v42;
+	double v994 = v991 + v993;
+	double v995 = v994 * v53;
+	double v996 = v988 + v995;
+	double v997 = v978 + v996;
+	double v998 = v997 * v76;
+	double v999 = v974 * v60;
+	state.v507 = v507;
+	state.v515 = v515;
+	state.v520 = v520;
+	state.v527 = v527;
+	state.v534 = v534;
+	state.v536 = v536;
+	state.v540 = v540;
+	state.v545 = v545;
+	state.v548 = v548;
+	state.v553 = v553;
+	state.v560 = v560;
+	state.v567 = v567;
+	state.v643 = v643;
+	state.v667 = v667;
+	state.v688 = v688;
+	state.v706 = v706;
+	state.v723 = v723;
+	state.v740 = v740;
+	state.v754 = v754;
+	state.v761 = v761;
+	state.v768 = v768;
+	state.v795 = v795;
+	state.v802 = v802;
+	state.v809 = v809;
+	state.v828 = v828;
+	state.v835 = v835;
+	state.v842 = v842;
+	state.v856 = v856;
+	state.v863 = v863;
+	state.v870 = v870;
+	state.v896 = v896;
+	state.v903 = v903;
+	state.v910 = v910;
+	state.v928 = v928;
+	state.v935 = v935;
+	state.v942 = v942;
+	state.v956 = v956;
+	state.v963 = v963;
+	state.v970 = v970;
+	state.v971 = v971;
+	state.v972 = v972;
+	state.v974 = v974;
+	state.v976 = v976;
+	state.v980 = v980;
+	state.v981 = v981;
+	state.v984 = v984;
+	state.v985 = v985;
+	state.v994 = v994;
+	state.v997 = v997;
+	state.v998 = v998;
+	state.v999 = v999;
+}
@@ -0,0 +1,600 @@
+#include "ddR.h"
+
+void compute_ddR_part2(const double *v, double *ddR, compute_ddR_State &state) {
+	const double v0 = state.v0;
+	const double v1 = state.v1;
+	const double v2 = state.v2;
+	const double v9 = state.v9;
+	const double v17 = state.v17;
+	const double v21 = state.v21;
+	const double v28 = state.v28;
+	const double v29 = state.v29;
+	const double v36 = state.v36;
+	const double v37 = state.v37;
+	const double v44 = state.v44;
+	const double v58 = state.v58;
+	const double v60 = state.v60;
+	const double v63 = state.v63;
+	const double v65 = state.v65;
+	const double v66 = state.v66;
+	const double v70 = state.v70;
+	const double v71 = state.v71;
+	const double v76 = state.v76;
+	const double v98 = state.v98;
+	const double v102 = state.v102;
+	const double v114 = state.v114;
+	const double v120 = state.v120;
+	const double v123 = state.v123;
+	const double v128 = state.v128;
+	const double v138 = state.v138;
+	const double v143 = state.v143;
+	const double v150 = state.v150;
+	const double v155 = state.v155;
+	const double v165 = state.v165;
+	const double v172 = state.v172;
+	const double v175 = state.v175;
+	const double v183 = state.v183;
+	const double v190 = state.v190;
+	const double v195 = state.v195;
+	const double v200 = state.v200;
+	const double v203 = state.v203;
+	const double v204 = state.v204;
+	const double v207 = state.v207;
+	const double v212 = state.v212;
+	const double v218 = state.v218;
+	const double v226 = state.v226;
+	const double v231 = state.v231;
+	const double v239 = state.v239;
+	const double v246 = state.v246;
+	const double v252 = state.v252;
+	const double v260 = state.v260;
+	const double v267 = state.v267;
+	const double v273 = state.v273;
+	const double v275 = state.v275;
+	const double v279 = state.v279;
+	const double v284 = state.v284;
+	const double v287 = state.v287;
+	const double v292 = state.v292;
+	const double v299 = state.v299;
+	const double v306 = state.v306;
+	const double v308 = state.v308;
+	const double v310 = state.v310;
+	const double v315 = state.v315;
+	const double v325 = state.v325;
+	const double v335 = state.v335;
+	const double v344 = state.v344;
+	const double v349 = state.v349;
+	const double v356 = state.v356;
+	const double v363 = state.v363;
+	const double v364 = state.v364;
+	const double v367 = state.v367;
+	const double v377 = state.v377;
+	const double v385 = state.v385;
+	const double v390 = state.v390;
+	const double v397 = state.v397;
+	const double v404 = state.v404;
+	const double v406 = state.v406;
+	const double v410 = state.v410;
+	const double v415 = state.v415;
+	const double v418 = state.v418;
+	const double v423 = state.v423;
+	const double v430 = state.v430;
+	const double v437 = state.v437;
+	const double v438 = state.v438;
+	const double v440 = state.v440;
+	const double v445 = state.v445;
+	const double v455 = state.v455;
+	const double v465 = state.v465;
+	const double v474 = state.v474;
+	const double v479 = state.v479;
+	const double v486 = state.v486;
+	const double v493 = state.v493;
+	const double v494 = state.v494;
+	const double v497 = state.v497;
+	const double v507 = state.v507;
+	const double v515 = state.v515;
+	const double v520 = state.v520;
+	const double v527 = state.v527;
+	const double v534 = state.v534;
+	const double v536 = state.v536;
+	const double v540 = state.v540;
+	const double v545 = state.v545;
+	const double v548 = state.v548;
+	const double v553 = state.v553;
+	const double v560 = state.v560;
+	const double v567 = state.v567;
+	const double v643 = state.v643;
+	const double v667 = state.v667;
+	const double v688 = state.v688;
+	const double v706 = state.v706;
+	const double v723 = state.v723;
+	const double v740 = state.v740;
+	const double v754 = state.v754;
+	const double v761 = state.v761;
+	const double v768 = state.v768;
+	const double v795 = state.v795;
+	const double v802 = state.v802;
+	const double v809 = state.v809;
+	const double v828 = state.v828;
+	const double v835 = state.v835;
+	const double v842 = state.v842;
+	const double v856 = state.v856;
+	const double v863 = state.v863;
+	const double v870 = state.v870;
+	const double v896 = state.v896;
+	const double v903 = state.v903;
+	const double v910 = state.v910;
+	const double v928 = state.v928;
+	const double v935 = state.v935;
+	const double v942 = state.v942;
+	const double v956 = state.v956;
+	const double v963 = state.v963;
+	const double v970 = state.v970;
+	const double v971 = state.v971;
+	const double v972 = state.v972;
+	const double v974 = state.v974;
+	const double v976 = state.v976;
+	const double v980 = state.v980;
+	const double v981 = state.v981;
+	const double v984 = state.v984;
+	const double v985 = state.v985;
+	const double v994 = state.v994;
+	const double v997 = state.v997;
+	const double v998 = state.v998;
+	const double v999 = state.v999;
+	double v1000 = -v974;
+	double v1001 = v1000 * v21;
+	double v1002 = v999 + v1001;
+	double v1003 = v981 * v36;
+	double v1004 = v980 * v37;
+	double v1005 = v1003 + v1004;
+	double v1006 = v1002 + v1005;
+	double v1007 = v1006 * v44;
+	double v1008 = v994 * v63;
+	double v1009 = v1007 + v1008;
+	double v1010 = -v1009;
+	double v1011 = v1010 * v58;
+	double v1012 = -v997;
+	double v1013 = v1012 * v0;
+	double v1014 = v1011 + v1013;
+	double v1015 = v0 + v1014;
+	double v1016 = -v1015;
+	double v1017 = v1016 * v98;
+	double v1018 = v972 * v9;
+	double v1019 = v1018 + v1018;
+	double v1020 = v1019 * v102;
+	double v1021 = v1017 - v1020;
+	double v1022 = v1021 * v70;
+	double v1023 = v998 + v1022;
+	double v1024 = v981 * v17;
+	double v1025 = v976 * v37;
+	double v1026 = v1024 + v1025;
+	double v1027 = v974 * v28;
+	double v1028 = v984 * v21;
+	double v1029 = v1027 + v1028;
+	double v1030 = v1029 * v44;
+	double v1031 = v994 * v114;
+	double v1032 = v1030 + v1031;
+	double v1033 = v1026 + v1032;
+	double v1034 = v1033 * v128;
+	double v1035 = v1010 * v2;
+	double v1036 = v1035 + v66;
+	double v1037 = -v1033;
+	double v1038 = v1037 * v120;
+	double v1039 = v1036 + v1038;
+	double v1040 = v1039 * v98;
+	double v1041 = v1019 * v138;
+	double v1042 = v1040 - v1041;
+	double v1043 = v1042 * v123;
+	double v1044 = v1034 + v1043;
+	double v1045 = v1023 + v1044;
+	double v1046 = v984 * v29;
+	double v1047 = v985 * v28;
+	double v1048 = v1046 + v1047;
+	double v1049 = v1002 + v1048;
+	double v1050 = v1049 * v44;
+	double v1051 = v994 * v150;
+	double v1052 = v1050 + v1051;
+	double v1053 = v1052 * v76;
+	double v1054 = v1021 * v155;
+	double v1055 = v1053 + v1054;
+	double v1056 = v984 * v17;
+	double v1057 = v976 * v28;
+	double v1058 = v1056 + v1057;
+	double v1059 = v1000 * v37;
+	double v1060 = v981 * v60;
+	double v1061 = v1059 + v1060;
+	double v1062 = v1061 * v44;
+	double v1063 = v994 * v165;
+	double v1064 = v1062 + v1063;
+	double v1065 = v1058 + v1064;
+	double v1066 = v1065 * v128;
+	double v1067 = v1042 * v172;
+	double v1068 = v1066 + v1067;
+	double v1069 = v1055 + v1068;
+	double v1070 = v985 * v17;
+	double v1071 = v976 * v29;
+	double v1072 = v1070 + v1071;
+	double v1073 = v980 * v21;
+	double v1074 = v974 * v36;
+	double v1075 = v1073 + v1074;
+	double v1076 = v1075 * v44;
+	double v1077 = v994 * v183;
+	double v1078 = v1076 + v1077;
+	double v1079 = v1072 + v1078;
+	double v1080 = v1079 * v76;
+	double v1081 = v1021 * v190;
+	double v1082 = v1080 + v1081;
+	double v1083 = v1005 + v1048;
+	double v1084 = v1083 * v44;
+	double v1085 = v994 * v195;
+	double v1086 = v1084 + v1085;
+	double v1087 = v1086 * v128;
+	double v1088 = v1042 * v200;
+	double v1089 = v1087 + v1088;
+	double v1090 = v1082 + v1089;
+	double v1091 = v1009 * v204;
+	double v1092 = v1015 * v98;
+	double v1093 = v1019 * v207;
+	double v1094 = v1092 - v1093;
+	double v1095 = v1094 * v65;
+	double v1096 = v1091 + v1095;
+	double v1097 = v1033 * v218;
+	double v1098 = v1012 * v212;
+	double v1099 = -v71;
+	double v1100 = v1098 + v1099;
+	double v1101 = v1037 * v1;
+	double v1102 = v1100 + v1101;
+	double v1103 = -v1102;
+	double v1104 = v1103 * v98;
+	double v1105 = v1019 * v226;
+	double v1106 = v1104 - v1105;
+	double v1107 = v1106 * v123;
+	double v1108 = v1097 + v1107;
+	double v1109 = v1096 + v1108;
+	double v1110 = v1000 * v17;
+	double v1111 = v976 * v60;
+	double v1112 = v1110 + v1111;
+	double v1113 = v984 * v36;
+	double v1114 = v980 * v28;
+	double v1115 = v1113 + v1114;
+	double v1116 = v1115 * v44;
+	double v1117 = v994 * v239;
+	double v1118 = v1116 + v1117;
+	double v1119 = v1112 + v1118;
+	double v1120 = v1119 * v204;
+	double v1121 = v1094 * v246;
+	double v1122 = v1120 + v1121;
+	double v1123 = v1065 * v218;
+	double v1124 = v1106 * v172;
+	double v1125 = v1123 + v1124;
+	double v1126 = v1122 + v1125;
+	double v1127 = v980 * v17;
+	double v1128 = v976 * v36;
+	double v1129 = v1127 + v1128;
+	double v1130 = v985 * v60;
+	double v1131 = v1000 * v29;
+	double v1132 = v1130 + v1131;
+	double v1133 = v1132 * v44;
+	double v1134 = v994 * v260;
+	double v1135 = v1133 + v1134;
+	double v1136 = v1129 + v1135;
+	double v1137 = v1136 * v204;
+	double v1138 = v1094 * v267;
+	double v1139 = v1137 + v1138;
+	double v1140 = v1086 * v218;
+	double v1141 = v1106 * v200;
+	double v1142 = v1140 + v1141;
+	double v1143 = v1139 + v1142;
+	double v1144 = v1009 * v275;
+	double v1145 = -v1039;
+	double v1146 = v1145 * v98;
+	double v1147 = v1019 * v279;
+	double v1148 = v1146 - v1147;
+	double v1149 = v1148 * v65;
+	double v1150 = v1144 + v1149;
+	double v1151 = v997 * v284;
+	double v1152 = v1102 * v98;
+	double v1153 = v1019 * v287;
+	double v1154 = v1152 - v1153;
+	double v1155 = v1154 * v70;
+	double v1156 = v1151 + v1155;
+	double v1157 = v1150 + v1156;
+	double v1158 = v1119 * v275;
+	double v1159 = v1148 * v246;
+	double v1160 = v1158 + v1159;
+	double v1161 = v1052 * v284;
+	double v1162 = v1154 * v155;
+	double v1163 = v1161 + v1162;
+	double v1164 = v1160 + v1163;
+	double v1165 = v1136 * v275;
+	double v1166 = v1148 * v267;
+	double v1167 = v1165 + v1166;
+	double v1168 = v1079 * v284;
+	double v1169 = v1154 * v190;
+	double v1170 = v1168 + v1169;
+	double v1171 = v1167 + v1170;
+	double v1172 = v997 * v315;
+	double v1173 = -v1119;
+	double v1174 = v1173 * v58;
+	double v1175 = -v1052;
+	double v1176 = v1175 * v0;
+	double v1177 = v1174 + v1176;
+	double v1178 = v1 + v1177;
+	double v1179 = -v1178;
+	double v1180 = v1179 * v98;
+	double v1181 = v1019 * v325;
+	double v1182 = v1180 - v1181;
+	double v1183 = v1182 * v70;
+	double v1184 = v1172 + v1183;
+	double v1185 = v1033 * v335;
+	double v1186 = v1173 * v2;
+	double v1187 = v1186 + v308;
+	double v1188 = -v1065;
+	double v1189 = v1188 * v120;
+	double v1190 = v1187 + v1189;
+	double v1191 = v1190 * v98;
+	double v1192 = v1019 * v344;
+	double v1193 = v1191 - v1192;
+	double v1194 = v1193 * v123;
+	double v1195 = v1185 + v1194;
+	double v1196 = v1184 + v1195;
+	double v1197 = v1052 * v315;
+	double v1198 = v1182 * v155;
+	double v1199 = v1197 + v1198;
+	double v1200 = v1065 * v335;
+	double v1201 = v1193 * v172;
+	double v1202 = v1200 + v1201;
+	double v1203 = v1199 + v1202;
+	double v1204 = v1079 * v315;
+	double v1205 = v1182 * v190;
+	double v1206 = v1204 + v1205;
+	double v1207 = v1086 * v335;
+	double v1208 = v1193 * v200;
+	double v1209 = v1207 + v1208;
+	double v1210 = v1206 + v1209;
+	double v1211 = v1009 * v364;
+	double v1212 = v1178 * v98;
+	double v1213 = v1019 * v367;
+	double v1214 = v1212 - v1213;
+	double v1215 = v1214 * v65;
+	double v1216 = v1211 + v1215;
+	double v1217 = v1033 * v377;
+	double v1218 = v1175 * v212;
+	double v1219 = -v310;
+	double v1220 = v1218 + v1219;
+	double v1221 = v1188 * v1;
+	double v1222 = v1220 + v1221;
+	double v1223 = -v1222;
+	double v1224 = v1223 * v98;
+	double v1225 = v1019 * v385;
+	double v1226 = v1224 - v1225;
+	double v1227 = v1226 * v123;
+	double v1228 = v1217 + v1227;
+	double v1229 = v1216 + v1228;
+	double v1230 = v1119 * v364;
+	double v1231 = v1214 * v246;
+	double v1232 = v1230 + v1231;
+	double v1233 = v1065 * v377;
+	double v1234 = v1226 * v172;
+	double v1235 = v1233 + v1234;
+	double v1236 = v1232 + v1235;
+	double v1237 = v1136 * v364;
+	double v1238 = v1214 * v267;
+	double v1239 = v1237 + v1238;
+	double v1240 = v1086 * v377;
+	double v1241 = v1226 * v200;
+	double v1242 = v1240 + v1241;
+	double v1243 = v1239 + v1242;
+	double v1244 = v1009 * v406;
+	double v1245 = -v1190;
+	double v1246 = v1245 * v98;
+	double v1247 = v1019 * v410;
+	double v1248 = v1246 - v1247;
+	double v1249 = v1248 * v65;
+	double v1250 = v1244 + v1249;
+	double v1251 = v997 * v415;
+	double v1252 = v1222 * v98;
+	double v1253 = v1019 * v418;
+	double v1254 = v1252 - v1253;
+	double v1255 = v1254 * v70;
+	double v1256 = v1251 + v1255;
+	double v1257 = v1250 + v1256;
+	double v1258 = v1119 * v406;
+	double v1259 = v1248 * v246;
+	double v1260 = v1258 + v1259;
+	double v1261 = v1052 * v415;
+	double v1262 = v1254 * v155;
+	double v1263 = v1261 + v1262;
+	double v1264 = v1260 + v1263;
+	double v1265 = v1136 * v406;
+	double v1266 = v1248 * v267;
+	double v1267 = v1265 + v1266;
+	double v1268 = v1079 * v415;
+	double v1269 = v1254 * v190;
+	double v1270 = v1268 + v1269;
+	double v1271 = v1267 + v1270;
+	double v1272 = v997 * v445;
+	double v1273 = -v1136;
+	double v1274 = v1273 * v58;
+	double v1275 = -v1079;
+	double v1276 = v1275 * v0;
+	double v1277 = v1274 + v1276;
+	double v1278 = v971 + v1277;
+	double v1279 = -v1278;
+	double v1280 = v1279 * v98;
+	double v1281 = v1019 * v455;
+	double v1282 = v1280 - v1281;
+	double v1283 = v1282 * v70;
+	double v1284 = v1272 + v1283;
+	double v1285 = v1033 * v465;
+	double v1286 = v1273 * v2;
+	double v1287 = v1286 + v438;
+	double v1288 = -v1086;
+	double v1289 = v1288 * v120;
+	double v1290 = v1287 + v1289;
+	double v1291 = v1 + v1290;
+	double v1292 = v1291 * v98;
+	double v1293 = v1019 * v474;
+	double v1294 = v1292 - v1293;
+	double v1295 = v1294 * v123;
+	double v1296 = v1285 + v1295;
+	double v1297 = v1284 + v1296;
+	double v1298 = v1052 * v445;
+	double v1299 = v1282 * v155;
+	double v1300 = v1298 + v1299;
+	double v1301 = v1065 * v465;
+	double v1302 = v1294 * v172;
+	double v1303 = v1301 + v1302;
+	double v1304 = v1300 + v1303;
+	double v1305 = v1079 * v445;
+	double v1306 = v1282 * v190;
+	double v1307 = v1305 + v1306;
+	double v1308 = v1086 * v465;
+	double v1309 = v1294 * v200;
+	double v1310 = v1308 + v1309;
+	double v1311 = v1307 + v1310;
+	double v1312 = v1009 * v494;
+	double v1313 = v1278 * v98;
+	double v1314 = v1019 * v497;
+	double v1315 = v1313 - v1314;
+	double v1316 = v1315 * v65;
+	double v1317 = v1312 + v1316;
+	double v1318 = v1033 * v507;
+	double v1319 = v1275 * v212;
+	double v1320 = -v440;
+	double v1321 = v1319 + v1320;
+	double v1322 = v1288 * v1;
+	double v1323 = v1321 + v1322;
+	double v1324 = v0 + v1323;
+	double v1325 = -v1324;
+	double v1326 = v1325 * v98;
+	double v1327 = v1019 * v515;
+	double v1328 = v1326 - v1327;
+	double v1329 = v1328 * v123;
+	double v1330 = v1318 + v1329;
+	double v1331 = v1317 + v1330;
+	double v1332 = v1119 * v494;
+	double v1333 = v1315 * v246;
+	double v1334 = v1332 + v1333;
+	double v1335 = v1065 * v507;
+	double v1336 = v1328 * v172;
+	double v1337 = v1335 + v1336;
+	double v1338 = v1334 + v1337;
+	double v1339 = v1136 * v494;
+	double v1340 = v1315 * v267;
+	double v1341 = v1339 + v1340;
+	double v1342 = v1086 * v507;
+	double v1343 = v1328 * v200;
+	double v1344 = v1342 + v1343;
+	double v1345 = v1341 + v1344;
+	double v1346 = v1009 * v536;
+	double v1347 = -v1291;
+	double v1348 = v1347 * v98;
+	double v1349 = v1019 * v540;
+	double v1350 = v1348 - v1349;
+	double v1351 = v1350 * v65;
+	double v1352 = v1346 + v1351;
+	double v1353 = v997 * v545;
+	double v1354 = v1324 * v98;
+	double v1355 = v1019 * v548;
+	double v1356 = v1354 - v1355;
+	double v1357 = v1356 * v70;
+	double v1358 = v1353 + v1357;
+	double v1359 = v1352 + v1358;
+	double v1360 = v1119 * v536;
+	double v1361 = v1350 * v246;
+	double v1362 = v1360 + v1361;
+	double v1363 = v1052 * v545;
+	double v1364 = v1356 * v155;
+	double v1365 = v1363 + v1364;
+	double v1366 = v1362 + v1365;
+	double v1367 = v1136 * v536;
+	double v1368 = v1350 * v267;
+	double v1369 = v1367 + v1368;
+	double v1370 = v1079 * v545;
+	double v1371 = v1356 * v190;
+	double v1372 = v1370 + v1371;
+	double v1373 = v1369 + v1372;
+	ddR[0] = v143;
+	ddR[1] = v175;
+	ddR[2] = v203;
+	ddR[3] = v231;
+	ddR[4] = v252;
+	ddR[5] = v273;
+	ddR[6] = v292;
+	ddR[7] = v299;
+	ddR[8] = v306;
+	ddR[9] = v349;
+	ddR[10] = v356;
+	ddR[11] = v363;
+	ddR[12] = v390;
+	ddR[13] = v397;
+	ddR[14] = v404;
+	ddR[15] = v423;
+	ddR[16] = v430;
+	ddR[17] = v437;
+	ddR[18] = v479;
+	ddR[19] = v486;
+	ddR[20] = v493;
+	ddR[21] = v520;
+	ddR[22] = v527;
+	ddR[23] = v534;
+	ddR[24] = v553;
+	ddR[25] = v560;
+	ddR[26] = v567;
+	ddR[27] = v643;
+	ddR[28] = v667;
+	ddR[29] = v688;
+	ddR[30] = v706;
+	ddR[31] = v723;
+	ddR[32] = v740;
+	ddR[33] = v754;
+	ddR[34] = v761;
+	ddR[35] = v768;
+	ddR[36] = v795;
+	ddR[37] = v802;
+	ddR[38] = v809;
+	ddR[39] = v828;
+	ddR[40] = v835;
+	ddR[41] = v842;
+	ddR[42] = v856;
+	ddR[43] = v863;
+	ddR[44] = v870;
+	ddR[45] = v896;
+	ddR[46] = v903;
+	ddR[47] = v910;
+	ddR[48] = v928;
+	ddR[49] = v935;
+	ddR[50] = v942;
+	ddR[51] = v956;
+	ddR[52] = v963;
+	ddR[53] = v970;
+	ddR[54] = v1045;
+	ddR[55] = v1069;
+	ddR[56] = v1090;
+	ddR[57] = v1109;
+	ddR[58] = v1126;
+	ddR[59] = v1143;
+	ddR[60] = v1157;
+	ddR[61] = v1164;
+	ddR[62] = v1171;
+	ddR[63] = v1196;
+	ddR[64] = v1203;
+	ddR[65] = v1210;
+	ddR[66] = v1229;
+	ddR[67] = v1236;
+	ddR[68] = v1243;
+	ddR[69] = v1257;
+	ddR[70] = v1264;
+	ddR[71] = v1271;
+	ddR[72] = v1297;
+	ddR[73] = v1304;
+	ddR[74] = v1311;
+	ddR[75] = v1331;
+	ddR[76] = v1338;
+	ddR[77] = v1345;
+	ddR[78] = v1359;
+	ddR[79] = v1366;
+	ddR[80] = v1373;
+}
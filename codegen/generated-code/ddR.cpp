@@ -1,7 +1,7 @@
 double v0 = v[0];
 double v1 = v[1];
 double v2 = v[2];
-double v3 = 0.500000;
+double v3 = 0.5;
 double v4 = v0 * v0;
 double v5 = v1 * v1;
 double v6 = v2 * v2;
@@ -38,7 +38,7 @@ double v36 = v1 / v9;
 double v37 = -v36;
 double v38 = v35 * v37;
 double v39 = v30 + v38;
-double v40 = 2.000000;
+double v40 = 2.0;
 double v41 = v3 * v9;
 double v42 = sin(v41);
 double v43 = v40 * v42;
@@ -57,7 +57,7 @@ double v55 = v45 + v54;
 double v56 = v23 + v55;
 double v57 = v0 * v2;
 double v58 = -v1;
-double v59 = 1.000000;
+double v59 = 1.0;
 double v60 = -v21;
 double v61 = v60 * v21;
 double v62 = v36 * v37;
@@ -6,6 +6,7 @@
 #include <ExpCoords.h>
 
 #include <CodeGenerator.h>
+#include <CodeModule.h>
 #include <AutoDiff.h>
 #include <RecType.h>
 #include <Tensors.h>
@@ -14,7 +15,7 @@
 
 using namespace AutoGen;
 
-void generateCode_dR(){
+void generateCode_dR(CodeModule<double> &module){
     typedef RecType<double> Rt;
     typedef AutoDiff<Rt, Rt> AD;
 
@@ -24,7 +25,7 @@ void generateCode_dR(){
         v[i] = Rt("v[" + std::to_string(i) + "]");
     }
 
-    CodeGenerator<double> generator;
+    module.addFunction("dR", "const Vector3d &v, Tensor3d3 &dR");
 
     // compute gradient and add to code gen
     {
@@ -35,20 +36,16 @@ void generateCode_dR(){
             for (int j = 0; j < 3; ++j)
                 for (int k = 0; k < 3; ++k){
                     dR[i](j,k) = R(j,k).deriv();
-                    dR[i](j,k).addToGeneratorAsResult(generator, "dR[" + std::to_string(i) + "]("
-                                                                       + std::to_string(j) + ","
-                                                                       + std::to_string(k) + ")");
+                    module.addOutput("dR", "dR[" + std::to_string(i) + "]("
+                                                 + std::to_string(j) + ","
+                                                 + std::to_string(k) + ")", dR[i](j,k));
                 }
             v(i).deriv() = 0.0;
         }
     }
-
-    generator.sortNodes();
-
-    std::cout << generator.generateCode() << std::endl;
 }
 
-void generateCode_ddR(){
+void generateCode_ddR(CodeModule<double> &module){
     typedef RecType<double> Rt;
     typedef AutoDiff<Rt, Rt> AD;
 
@@ -58,7 +55,7 @@ void generateCode_ddR(){
         v[i] = Rt("v[" + std::to_string(i) + "]");
     }
 
-    CodeGenerator<double> generator;
+    module.addFunction("ddR", "const Vector3d &v, Tensor4d3 &ddR");
 
     // compute gradient and add to code gen
     {
@@ -70,18 +67,14 @@ void generateCode_ddR(){
             for (int k = 0; k < 3; ++k)
                 for (int l = 0; l < 3; ++l){
                     ddR[i][j](k,l) = dR[j](k,l).deriv();
-                    ddR[i][j](k,l).addToGeneratorAsResult(generator, "ddR[" + std::to_string(i) + "]["
-                                                                            + std::to_string(j) + "]("
-                                                                            + std::to_string(k) + ","
-                                                                            + std::to_string(l) + ")");
+                    module.addOutput("ddR", "ddR[" + std::to_string(i) + "]["
+                                                   + std::to_string(j) + "]("
+                                                   + std::to_string(k) + ","
+                                                   + std::to_string(l) + ")", ddR[i][j](k,l));
                 }
             v(i).deriv() = 0.0;
         }
     }
-
-    generator.sortNodes();
-
-    std::cout << generator.generateCode() << std::endl;
 }
 
 void generateCode_ddR_ij(){
@@ -128,7 +121,8 @@ void generateCode_ddR_ij(){
 
                 out << "Matrix3d ddR_" << i << "_" << j << "() {\n";
                 out << "    Matrix3d ddR_" << i << "_" << j << ";\n";
-                out << generator.generateCode("    ") << std::endl;
+                generator.generateCode(out, "    ");
+                out << std::endl;
                 out << "    return ddR_" << i << "_" << j << ";\n";
                 out << "}\n\n";
 
@@ -140,7 +134,7 @@ void generateCode_ddR_ij(){
     out.close();
 }
 
-void generateCode_dddR(){
+void generateCode_dddR(CodeModule<double> &module){
     typedef RecType<double> Rt;
     typedef AutoDiff<Rt, Rt> AD;
     typedef AutoDiff<AD, AD> ADD;
@@ -151,7 +145,7 @@ void generateCode_dddR(){
         v[i] = Rt("v[" + std::to_string(i) + "]");
     }
 
-    CodeGenerator<double> generator;
+    module.addFunction("dddR", "const Vector3d &v, Tensor5d3 &dddR");
 
     // compute gradient and add to code gen
     {
@@ -165,22 +159,30 @@ void generateCode_dddR(){
                     for (int k = 0; k < 3; ++k)
                         for (int l = 0; l < 3; ++l){
                             dddR[h][i][j](k,l) = dR[j](k,l).deriv().deriv();
-                            dddR[h][i][j](k,l).addToGeneratorAsResult(generator, "dddR_["
-                                                                                   + std::to_string(h) + "]["
-                                                                                   + std::to_string(i) + "]["
-                                                                                   + std::to_string(j) + "]("
-                                                                                   + std::to_string(k) + ","
-                                                                                   + std::to_string(l) + ")");
+                            module.addOutput("dddR", "dddR["
+                                                     + std::to_string(h) + "]["
+                                                     + std::to_string(i) + "]["
+                                                     + std::to_string(j) + "]("
+                                                     + std::to_string(k) + ","
+                                                     + std::to_string(l) + ")", dddR[h][i][j](k,l));
                         }
                 v(i).value().deriv() = 1.0;
             }
             v(h).deriv().value() = 0.0;
         }
     }
+}
 
-    generator.sortNodes();
+// dR, ddR and dddR as one module, so the norm, sin, cos and R are shared by
+// all entry points.
+void generateCode_dR_ddR_dddR(){
+    CodeModule<double> module;
+    generateCode_dR(module);
+    generateCode_ddR(module);
+    generateCode_dddR(module);
 
-    std::cout << generator.generateCode() << std::endl;
+    module.writeModule(std::cout, "dR_ddR_dddR");
+    std::cout << std::endl;
 }
 
 void generateCode_dtheta(){
@@ -219,15 +221,15 @@ void generateCode_dtheta(){
 
     generator.sortNodes();
 
-    std::cout << generator.generateCode() << std::endl;
+    generator.generateCode(std::cout);
+    std::cout << std::endl;
 }
 
 
 int main(int argc, char *argv[])
 {
 
-//    generateCode_dR();
-//    generateCode_dddR();
+//    generateCode_dR_ddR_dddR();
     generateCode_ddR_ij();
 //    generateCode_dtheta();
 
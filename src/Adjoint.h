@@ -0,0 +1,387 @@
+#pragma once
+
+#include "RecType.h"
+#include "Tape.h"
+
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace AutoGen {
+
+/*
+ * Adjoint
+ * =======
+ *
+ * Reverse mode differentiation on the recorded graph. `gradient` takes a
+ * recorded scalar and the variables it depends on, and records the graph of
+ * the gradient in one reverse sweep over the nodes of the scalar:
+ * ```
+ * RecType<double> x("x[0]"), y("x[1]");
+ * RecType<double> E = x*x*y;
+ * std::vector<RecType<double>> grad = gradient(E, {x, y});
+ * // grad[0] = 2*x*y, grad[1] = x*x
+ * ```
+ *
+ * Every node adds a constant number of nodes to the gradient, so recording
+ * the gradient of n variables costs about as much as recording the scalar,
+ * instead of n recordings with forward mode `AutoDiff`.
+ *
+ * `tangents` is the forward sweep, it records the derivatives of many outputs
+ * in a few directions at once.
+ *
+ * `hessian` applies the reverse sweep to every entry of the gradient. Only
+ * the upper triangle is recorded, the lower triangle shares its nodes, so
+ * generated code computes every entry once and copies the mirrored one.
+ *
+ * Variables are identified by name, every `NodeVar` named like one of the
+ * inputs contributes to its derivative. `pow` is only differentiated in its
+ * base, an exponent that depends on an input is not supported.
+ */
+// The nodes of recorded values, children before their parents.
+template<class S>
+class SortedGraph
+{
+public:
+	explicit SortedGraph(const std::vector<RecType<S>> &roots) {
+		std::vector<std::pair<const Node<S>*, size_t>> stack; // node, next child
+		for (const RecType<S> &root : roots) {
+			if(findIndex(root.getNode()) >= 0)
+				continue;
+			stack.push_back(std::make_pair(root.getNode(), size_t(0)));
+			while(!stack.empty()) {
+				const Node<S>* node = stack.back().first;
+				if(stack.back().second < node->getNumChildren()) {
+					const Node<S>* child = node->getChild(stack.back().second++);
+					if(findIndex(child) < 0)
+						stack.push_back(std::make_pair(child, size_t(0)));
+				}
+				else {
+					if(findIndex(node) < 0) {
+						mVisited.insert(node, uint32_t(mNodes.size()));
+						mNodes.push_back(node);
+					}
+					stack.pop_back();
+				}
+			}
+		}
+	}
+
+	size_t size() const { return mNodes.size(); }
+
+	const Node<S>* getNode(size_t k) const { return mNodes[k]; }
+
+	// position of a node, or -1
+	int64_t findIndex(const Node<S>* node) const {
+		uint32_t index = mVisited.find(node);
+		return (index != NodeIndex<S>::none) ? int64_t(index) : -1;
+	}
+
+	// For every node, the index of the input it reads or -1. Inputs are
+	// matched by variable name.
+	std::vector<int64_t> findInputs(const std::vector<RecType<S>> &inputs) const {
+		std::unordered_map<std::string, size_t> inputIndices;
+		for (size_t i = 0; i < inputs.size(); ++i) {
+			const Node<S>* node = inputs[i].getNode();
+			if(node->getOp() != VAR_OP)
+				throw std::invalid_argument("Input " + std::to_string(i) + " is not a variable.");
+			inputIndices[static_cast<const NodeVar<S>*>(node)->getVarName()] = i;
+		}
+
+		std::vector<int64_t> indices(mNodes.size(), -1);
+		for (size_t k = 0; k < mNodes.size(); ++k) {
+			if(mNodes[k]->getOp() != VAR_OP)
+				continue;
+			auto input = inputIndices.find(static_cast<const NodeVar<S>*>(mNodes[k])->getVarName());
+			if(input != inputIndices.end())
+				indices[k] = input->second;
+		}
+		return indices;
+	}
+
+	// For every node, whether it depends on one of the inputs.
+	std::vector<bool> findActive(const std::vector<int64_t> &inputIndices) const {
+		std::vector<bool> isActive(mNodes.size(), false);
+		for (size_t k = 0; k < mNodes.size(); ++k) {
+			isActive[k] = inputIndices[k] >= 0;
+			for (size_t i = 0; i < mNodes[k]->getNumChildren() && !isActive[k]; ++i) {
+				isActive[k] = isActive[findIndex(mNodes[k]->getChild(i))];
+			}
+		}
+		return isActive;
+	}
+
+private:
+	std::vector<const Node<S>*> mNodes;
+	NodeIndex<S> mVisited;
+};
+
+// For a product node, the product of all children but child i, for every i,
+// from prefix and suffix products.
+template<class S>
+std::vector<RecType<S>> otherFactors(const Node<S>* node) {
+	size_t n = node->getNumChildren();
+	std::vector<RecType<S>> result(n);
+	RecType<S> prefix(S(1));
+	for (size_t i = 0; i < n; ++i) {
+		result[i] = prefix;
+		prefix = prefix*RecType<S>(*node->getChild(i));
+	}
+	RecType<S> suffix(S(1));
+	for (size_t i = n; i-- > 0; ) {
+		result[i] = result[i]*suffix;
+		suffix = suffix*RecType<S>(*node->getChild(i));
+	}
+	return result;
+}
+
+template<class S>
+std::vector<RecType<S>> gradient(const RecType<S> &output, const std::vector<RecType<S>> &inputs) {
+	typedef RecType<S> R;
+
+	SortedGraph<S> graph({output});
+	std::vector<int64_t> inputIndices = graph.findInputs(inputs);
+	std::vector<bool> isActive = graph.findActive(inputIndices);
+	auto findIndex = [&graph](const Node<S>* node) { return graph.findIndex(node); };
+	size_t numNodes = graph.size();
+
+	// reverse sweep, adjoints[k] is d output / d nodes[k]
+	std::vector<R> adjoints(numNodes);
+	std::vector<bool> hasAdjoint(numNodes, false);
+	auto accumulate = [&](const Node<S>* node, const R &value) {
+		int64_t k = findIndex(node);
+		if(!isActive[k])
+			return;
+		adjoints[k] = hasAdjoint[k] ? adjoints[k] + value : value;
+		hasAdjoint[k] = true;
+	};
+
+	std::vector<R> gradients(inputs.size(), R(S(0)));
+	if(numNodes > 0) {
+		adjoints.back() = R(S(1));
+		hasAdjoint.back() = true;
+	}
+	for (size_t k = numNodes; k-- > 0; ) {
+		if(!isActive[k] || !hasAdjoint[k])
+			continue;
+
+		const Node<S>* node = graph.getNode(k);
+		const R adjoint = adjoints[k];
+		switch (node->getOp()) {
+		case VAR_OP: {
+			size_t i = inputIndices[k];
+			gradients[i] = gradients[i] + adjoint;
+			break;
+		}
+		case CONST_OP:
+			break;
+		case RESULT_OP:
+			accumulate(node->getChild(0), adjoint);
+			break;
+		case NEG_OP:
+			accumulate(node->getChild(0), -adjoint);
+			break;
+		case ADD_OP:
+			accumulate(node->getChild(0), adjoint);
+			accumulate(node->getChild(1), adjoint);
+			break;
+		case SUB_OP:
+			accumulate(node->getChild(0), adjoint);
+			accumulate(node->getChild(1), -adjoint);
+			break;
+		case MUL_OP: {
+			R a(*node->getChild(0)), b(*node->getChild(1));
+			accumulate(node->getChild(0), adjoint*b);
+			accumulate(node->getChild(1), adjoint*a);
+			break;
+		}
+		case DIV_OP: {
+			// d(a/b) = da/b - (a/b)/b db
+			R b(*node->getChild(1)), self(*node);
+			accumulate(node->getChild(0), adjoint/b);
+			accumulate(node->getChild(1), -(adjoint*self/b));
+			break;
+		}
+		case POW_OP: {
+			S exponent;
+			if(isActive[findIndex(node->getChild(1))] || !node->getChild(1)->evaluate(exponent))
+				throw std::invalid_argument("gradient: pow with an exponent that depends on an input is not supported.");
+			// d(a^e) = e*a^(e-1) da
+			R a(*node->getChild(0));
+			accumulate(node->getChild(0), adjoint*(R(exponent)*pow(a, exponent - S(1))));
+			break;
+		}
+		case SQRT_OP: {
+			// d(sqrt(a)) = 0.5/sqrt(a) da
+			R self(*node);
+			accumulate(node->getChild(0), adjoint*S(0.5)/self);
+			break;
+		}
+		case COS_OP: {
+			R a(*node->getChild(0));
+			accumulate(node->getChild(0), -(adjoint*sin(a)));
+			break;
+		}
+		case SIN_OP: {
+			R a(*node->getChild(0));
+			accumulate(node->getChild(0), adjoint*cos(a));
+			break;
+		}
+		case ACOS_OP: {
+			// d(acos(a)) = -1/sqrt(1-a*a) da
+			R a(*node->getChild(0));
+			accumulate(node->getChild(0), -(adjoint/sqrt(S(1) - a*a)));
+			break;
+		}
+		case SUM_OP:
+			for (size_t i = 0; i < node->getNumChildren(); ++i) {
+				accumulate(node->getChild(i), adjoint);
+			}
+			break;
+		case PRODUCT_OP: {
+			std::vector<R> others = otherFactors(node);
+			for (size_t i = 0; i < node->getNumChildren(); ++i) {
+				accumulate(node->getChild(i), adjoint*others[i]);
+			}
+			break;
+		}
+		}
+	}
+
+	return gradients;
+}
+
+// Hessian from the gradient of a scalar, `hess[j][i]` is the same recorded
+// value as `hess[i][j]`.
+template<class S>
+std::vector<std::vector<RecType<S>>> hessian(const std::vector<RecType<S>> &gradients, const std::vector<RecType<S>> &inputs) {
+	std::vector<std::vector<RecType<S>>> hess(inputs.size(), std::vector<RecType<S>>(inputs.size()));
+	for (size_t i = 0; i < inputs.size(); ++i) {
+		// only the derivatives by inputs j >= i are used
+		std::vector<RecType<S>> row = gradient(gradients[i], std::vector<RecType<S>>(inputs.begin() + i, inputs.end()));
+		for (size_t j = i; j < inputs.size(); ++j) {
+			hess[i][j] = row[j - i];
+			hess[j][i] = row[j - i];
+		}
+	}
+	return hess;
+}
+
+template<class S>
+std::vector<std::vector<RecType<S>>> hessian(const RecType<S> &output, const std::vector<RecType<S>> &inputs) {
+	return hessian(gradient(output, inputs), inputs);
+}
+
+// Forward sweep: the derivatives of `outputs` in the directions `seeds`, where
+// `seeds[c][i]` is the derivative of input i in direction c. All directions
+// are recorded in one pass, `result[c][o]` is the derivative of output o.
+template<class S>
+std::vector<std::vector<RecType<S>>> tangents(const std::vector<RecType<S>> &outputs, const std::vector<RecType<S>> &inputs, const std::vector<std::vector<S>> &seeds) {
+	typedef RecType<S> R;
+
+	SortedGraph<S> graph(outputs);
+	std::vector<int64_t> inputIndices = graph.findInputs(inputs);
+	std::vector<bool> isActive = graph.findActive(inputIndices);
+	size_t numNodes = graph.size();
+	size_t numDirections = seeds.size();
+
+	// tangents of inactive nodes are zero and not recorded
+	std::vector<R> dots(numNodes*numDirections);
+	auto dot = [&](const Node<S>* node, size_t c) -> const R* {
+		int64_t k = graph.findIndex(node);
+		return isActive[k] ? &dots[k*numDirections + c] : nullptr;
+	};
+
+	const R zero(S(0));
+	std::vector<R> others;
+	for (size_t k = 0; k < numNodes; ++k) {
+		if(!isActive[k])
+			continue;
+
+		const Node<S>* node = graph.getNode(k);
+		R self(*node);
+		if(node->getOp() == PRODUCT_OP)
+			others = otherFactors(node);
+		for (size_t c = 0; c < numDirections; ++c) {
+			R &result = dots[k*numDirections + c];
+			if(node->getOp() == VAR_OP) {
+				result = R(seeds[c][inputIndices[k]]);
+				continue;
+			}
+			if(node->getOp() == SUM_OP || node->getOp() == PRODUCT_OP) {
+				// inactive children add nothing
+				result = zero;
+				for (size_t i = 0; i < node->getNumChildren(); ++i) {
+					if(const R *di = dot(node->getChild(i), c))
+						result = result + ((node->getOp() == SUM_OP) ? *di : *di*others[i]);
+				}
+				continue;
+			}
+
+			const R *da = dot(node->getChild(0), c);
+			const R *db = (node->getNumChildren() > 1) ? dot(node->getChild(1), c) : nullptr;
+			if(!da) da = &zero;
+			if(!db) db = &zero;
+			switch (node->getOp()) {
+			case VAR_OP: case CONST_OP:
+				break;
+			case RESULT_OP:
+				result = *da;
+				break;
+			case NEG_OP:
+				result = -*da;
+				break;
+			case ADD_OP:
+				result = *da + *db;
+				break;
+			case SUB_OP:
+				result = *da - *db;
+				break;
+			case MUL_OP:
+				result = *da*R(*node->getChild(1)) + R(*node->getChild(0))**db;
+				break;
+			case DIV_OP:
+				result = (*da - self**db)/R(*node->getChild(1));
+				break;
+			case POW_OP: {
+				S exponent;
+				if(isActive[graph.findIndex(node->getChild(1))] || !node->getChild(1)->evaluate(exponent))
+					throw std::invalid_argument("tangents: pow with an exponent that depends on an input is not supported.");
+				result = R(exponent)*pow(R(*node->getChild(0)), exponent - S(1))**da;
+				break;
+			}
+			case SQRT_OP:
+				result = *da*S(0.5)/self;
+				break;
+			case COS_OP:
+				result = -(sin(R(*node->getChild(0)))**da);
+				break;
+			case SIN_OP:
+				result = cos(R(*node->getChild(0)))**da;
+				break;
+			case ACOS_OP: {
+				R a(*node->getChild(0));
+				result = -(*da/sqrt(S(1) - a*a));
+				break;
+			}
+			case SUM_OP: case PRODUCT_OP:
+				break;
+			}
+		}
+	}
+
+	std::vector<std::vector<R>> result(numDirections, std::vector<R>(outputs.size(), R(S(0))));
+	for (size_t o = 0; o < outputs.size(); ++o) {
+		int64_t k = graph.findIndex(outputs[o].getNode());
+		if(!isActive[k])
+			continue;
+		for (size_t c = 0; c < numDirections; ++c) {
+			result[c][o] = dots[k*numDirections + c];
+		}
+	}
+	return result;
+}
+
+} // namespace AutoGen
@@ -4,6 +4,27 @@
 #include <cmath>
 #include <cassert>
 
+#include <Eigen/Core>
+
+// The zero derivative. `Deriv` can be a scalar, or a fixed size Eigen vector
+// to carry the derivatives in N directions through one pass:
+// ```
+// typedef AutoDiff<double, Eigen::Vector3d> AD3;
+// AD3 x(1.0, Eigen::Vector3d::Unit(0)), y(2.0, Eigen::Vector3d::Unit(1));
+// AD3 f = x*y; // f.deriv() = (2, 1, 0)
+// ```
+template <class Deriv>
+struct AutoDiffZero
+{
+	static Deriv get() { return Deriv(0); }
+};
+
+template <class S, int N, int Options, int MaxN>
+struct AutoDiffZero<Eigen::Matrix<S, N, 1, Options, MaxN, 1>>
+{
+	static Eigen::Matrix<S, N, 1, Options, MaxN, 1> get() { return Eigen::Matrix<S, N, 1, Options, MaxN, 1>::Zero(); }
+};
+
 template <class Value, class Deriv>
 class AutoDiff
 {
@@ -15,7 +36,7 @@ public:
 //	}
 
 	template<class T>
-	AutoDiff(const T &c) : m_x((Value)c), m_d((Deriv)0)	{
+	AutoDiff(const T &c) : m_x((Value)c), m_d(AutoDiffZero<Deriv>::get())	{
 	}
 
 	AutoDiff(const Value &x, const Deriv &d) : m_x(x), m_d(d) {
@@ -147,7 +168,7 @@ template<class S, class Value, class Deriv>
 AutoDiff<Value, Deriv> operator*(const S &a, const AutoDiff<Value, Deriv> &y)
 {
 	// d(a*y)/dx = a*dy/dx
-	return AutoDiff<Value, Deriv>(a * y.value(), a * y.deriv());
+	return AutoDiff<Value, Deriv>(a * y.value(), Value(a) * y.deriv());
 }
 
 template<class Value, class Deriv>
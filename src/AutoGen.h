@@ -3,7 +3,9 @@
 #include "VarDef.h"
 #include "RecType.h"
 #include "CodeGenerator.h"
+#include "Sparsity.h"
 
+#include <algorithm>
 #include <experimental/filesystem>
 
 namespace AutoGen {
@@ -27,6 +29,21 @@ const std::string hessName = "hess";
 const std::string jacobianName = "J";
 #define getJacobianType(type, size1, size2)	("Eigen::Matrix<" + type + ", " + std::to_string(size1) + ", " + std::to_string(size2) + ">")
 
+// Can values of `type` be copied from and to arrays of doubles?
+inline bool isBatchType(const std::string &type) {
+	return type == "double" || type.compare(0, 21, "Eigen::Matrix<double,") == 0;
+}
+
+// Writes the header `GeneratedCode/<fileName>_AutoGen_<functionName>.h` with
+//  - the typed function `<functionName>(const Arg &arg..., Ret &ret...)`,
+//  - the batched function `<functionName>_batch(n, in, in_stride, out, out_stride)`,
+//    which evaluates `n` points, point k reads its arguments one after the
+//    other from `in + k*in_stride` and writes its results to `out + k*out_stride`.
+// Both are `static inline`, so the compiler can inline and vectorize them.
+// The batched function is only written if all arguments and results are
+// doubles or fixed size Eigen types of doubles. Define AUTOGEN_EXPORT_BATCH before including the header to also get the
+// batched function as `extern "C" <fileName>_<functionName>_batch`, e.g. to
+// build a library loaded with `compute_batch_extern`.
 template<typename... A>
 void writeCodeToFile(const std::string &fileName, const std::string &functionName, const std::vector<std::string> &returnTypes, const std::vector<std::string> &returnNames, const std::string &code, A&&... a)
 {
@@ -44,10 +61,12 @@ void writeCodeToFile(const std::string &fileName, const std::string &functionNam
 	std::vector<std::string> typeList;
 	auto tmptype = { (addTypeToList(typeList, a),0)... };
 
+	file << "#pragma once\n\n#include <cstddef>\n#include <cstring>\n#include <vector>\n\n";
+
 	// Namespace
 	file << "namespace " << fileName << "_AutoGen{\n";
 	// Write function name
-	file << "void " << functionName << "(";
+	file << "static inline void " << functionName << "(";
 	// Write function arguments
 	for (size_t i = 0; i < nameList.size(); i++)
 	{
@@ -58,7 +77,7 @@ void writeCodeToFile(const std::string &fileName, const std::string &functionNam
 	// Write function return type and name
 	for (size_t i = 0; i < returnTypes.size(); i++)
 	{
-		if (i == 0)
+		if (i == 0 && !nameList.empty())
 			file << ", ";
 		file << returnTypes[i] << " &" << returnNames[i];
 		if (i< returnTypes.size() - 1)
@@ -68,9 +87,48 @@ void writeCodeToFile(const std::string &fileName, const std::string &functionNam
 	file << ")\n{\n";
 	file << code;
 	file << "}\n";
+
+	bool isBatchable = std::all_of(typeList.begin(), typeList.end(), isBatchType) && std::all_of(returnTypes.begin(), returnTypes.end(), isBatchType);
+	if(!isBatchable)
+	{
+		file << "}\n";
+		file.close();
+		return;
+	}
+	file << "\n";
+
+	// Batched function: copy arguments in, call the typed function, copy results out.
+	// Arguments and results are plain arrays of doubles (fixed size Eigen types or double).
+	const std::string batchArgs = "(size_t n, const double* __restrict in, size_t in_stride, double* __restrict out, size_t out_stride)";
+	file << "static inline void " << functionName << "_batch" << batchArgs << "\n{\n";
+	file << "\tfor (size_t k = 0; k < n; ++k) {\n";
+	file << "\t\tconst double *pin = in + k*in_stride;\n";
+	file << "\t\tdouble *pout = out + k*out_stride;\n";
+	for (size_t i = 0; i < nameList.size(); i++)
+	{
+		file << "\t\t" << typeList[i] << " " << nameList[i] << ";\n";
+		file << "\t\tstd::memcpy(static_cast<void*>(&" << nameList[i] << "), pin, sizeof(" << nameList[i] << ")); pin += sizeof(" << nameList[i] << ")/sizeof(double);\n";
+	}
+	for (size_t i = 0; i < returnTypes.size(); i++)
+		file << "\t\t" << returnTypes[i] << " " << returnNames[i] << ";\n";
+	file << "\t\t" << functionName << "(";
+	for (size_t i = 0; i < nameList.size() + returnNames.size(); i++)
+		file << ((i > 0) ? ", " : "") << ((i < nameList.size()) ? nameList[i] : returnNames[i - nameList.size()]);
+	file << ");\n";
+	for (size_t i = 0; i < returnNames.size(); i++)
+		file << "\t\tstd::memcpy(pout, &" << returnNames[i] << ", sizeof(" << returnNames[i] << ")); pout += sizeof(" << returnNames[i] << ")/sizeof(double);\n";
+	file << "\t}\n";
+	file << "}\n";
 	// close namespace
 	file << "}\n";
 
+	// C entry point of the batched function
+	file << "\n#ifdef AUTOGEN_EXPORT_BATCH\n";
+	file << "extern \"C\" void " << fileName << "_" << functionName << "_batch" << batchArgs << "\n{\n";
+	file << "\t" << fileName << "_AutoGen::" << functionName << "_batch(n, in, in_stride, out, out_stride);\n";
+	file << "}\n";
+	file << "#endif\n";
+
 	// Close file
 	file.close();
 }
@@ -84,9 +142,29 @@ void writeCodeToFile(const std::string &fileName, const std::string &functionNam
 	writeCodeToFile(fileName, functionName, returnTypes, returnNames, code, a...);
 }
 
+// While in scope, `RecType` records into a tape of its own with
+// hash-consing enabled. The code generators below return strings, so all
+// nodes they record are freed on return.
+struct GeneratorRecording
+{
+	Tape<double> tape;
+	Tape<double>::Scope scope{tape};
+	Tape<double>::HashConsing hashConsing{tape};
+};
+
+// The generated type of the result of `f`, recorded into a tape of its own.
+template<typename F, typename... A>
+std::string getResultType(F &&f, A&&... a)
+{
+	GeneratorRecording recording;
+	return std::forward<F>(f)(std::forward<A>(a)...).getGeneratedType();
+}
+
 template<typename F, typename... A>
 std::string generateEnergyCodeADR(F &&f, A&&... a)
 {
+	GeneratorRecording recording;
+
 	ADR energy = std::forward<F>(f)(std::forward<A>(a)...);
 	RecType<double> E = energy.value();
 	CodeGenerator<double> generator;
@@ -99,6 +177,8 @@ std::string generateEnergyCodeADR(F &&f, A&&... a)
 template<typename F, typename... A>
 std::string generateEnergyCodeADDR(F &&f, A&&... a)
 {
+	GeneratorRecording recording;
+
 	ADDR energy = std::forward<F>(f)(std::forward<A>(a)...);
 	RecType<double> E = energy.value().value();
 	CodeGenerator<double> generator;
@@ -110,15 +190,18 @@ std::string generateEnergyCodeADDR(F &&f, A&&... a)
 template<typename F, typename... A>
 std::string generateGradientCode(const VarListX<ADR> &variables, F &&f, A&&... a)
 {
+	GeneratorRecording recording;
+
+	// record f once and differentiate it in one reverse sweep
+	ADR energy = std::forward<F>(f)(std::forward<A>(a)...);
+	std::vector<RecType<double>> inputs;
+	for (int i = 0; i < variables.size(); i++)
+		inputs.push_back((*variables[i]).value());
+	std::vector<RecType<double>> grad = gradient(energy.value(), inputs);
+
 	CodeGenerator<double> generator;
 	for (int i = 0; i < variables.size(); i++)
-	{
-		(*variables[i]).deriv() = 1;
-		ADR energy = std::forward<F>(f)(std::forward<A>(a)...);
-		RecType<double> grad = energy.deriv();
-		grad.addToGeneratorAsResult(generator, "grad[" + std::to_string(i) + "]");
-		(*variables[i]).deriv() = 0;
-	}
+		grad[i].addToGeneratorAsResult(generator, gradName + "[" + std::to_string(i) + "]");
 
 	generator.sortNodes();
 	return generator.generateCode();
@@ -127,43 +210,106 @@ std::string generateGradientCode(const VarListX<ADR> &variables, F &&f, A&&... a
 template<typename F, typename... A>
 std::string generateGradientCode(const VarListX<ADDR> &variables, F &&f, A&&... a)
 {
+	GeneratorRecording recording;
+
+	// record f once and differentiate it in one reverse sweep
+	ADDR energy = std::forward<F>(f)(std::forward<A>(a)...);
+	std::vector<RecType<double>> inputs;
+	for (int i = 0; i < variables.size(); i++)
+		inputs.push_back((*variables[i]).value().value());
+	std::vector<RecType<double>> grad = gradient(energy.value().value(), inputs);
+
 	CodeGenerator<double> generator;
 	for (int i = 0; i < variables.size(); i++)
-	{
-		(*variables[i]).deriv() = 1;
-		ADDR energy = std::forward<F>(f)(std::forward<A>(a)...);
-		RecType<double> grad = energy.deriv().value();
-		grad.addToGeneratorAsResult(generator, gradName + "[" + std::to_string(i) + "]");
-		(*variables[i]).deriv() = 0;
-	}
+		grad[i].addToGeneratorAsResult(generator, gradName + "[" + std::to_string(i) + "]");
 
 	generator.sortNodes();
 	return generator.generateCode();
 }
 
+// Add the matrix with the nonzero entries `values` in `pattern` to the
+// generator, as `name(i, j)` for every entry.
+inline void addMatrixToGenerator(CodeGenerator<double> &generator, const std::string &name, const SparsityPattern &pattern, std::vector<RecType<double>> &values)
+{
+	RecType<double> zero(0.0);
+	for (size_t i = 0; i < pattern.getNumRows(); i++)
+		for (size_t j = 0; j < pattern.getNumCols(); j++)
+		{
+			int64_t k = pattern.find(i, j);
+			RecType<double> &value = (k >= 0) ? values[k] : zero;
+			value.addToGeneratorAsResult(generator, name + "(" + std::to_string(i) + ", " + std::to_string(j) + ")");
+		}
+}
+
+// Add the nonzero entries `values` as `name_values[k]`, followed by code that
+// writes them as triplets to the std::vector `name`.
+inline std::string addTripletsToGenerator(CodeGenerator<double> &generator, const std::string &name, const SparsityPattern &pattern, std::vector<RecType<double>> &values)
+{
+	for (size_t k = 0; k < values.size(); k++)
+		values[k].addToGeneratorAsResult(generator, name + "_values[" + std::to_string(k) + "]");
+
+	size_t numNonZeros = pattern.getNumNonZeros();
+	std::string rows, cols;
+	for (size_t k = 0; k < numNonZeros; k++)
+	{
+		rows += ((k > 0) ? ", " : "") + std::to_string(pattern.getRow(k));
+		cols += ((k > 0) ? ", " : "") + std::to_string(pattern.getCol(k));
+	}
+	std::string size = std::to_string(std::max(numNonZeros, size_t(1)));
+	std::string code;
+	code += "static const int " + name + "_rows[" + size + "] = {" + rows + "};\n";
+	code += "static const int " + name + "_cols[" + size + "] = {" + cols + "};\n";
+	code += name + ".resize(" + std::to_string(numNonZeros) + ");\n";
+	code += "for (int k = 0; k < " + std::to_string(numNonZeros) + "; k++)\n";
+	code += "\t" + name + "[k] = Eigen::Triplet<double>(" + name + "_rows[k], " + name + "_cols[k], " + name + "_values[k]);\n";
+	return code;
+}
+
 template<typename F, typename... A>
 std::string generateGradientAndHessianCode(const VarListX<ADDR> &variables, F &&f, A&&... a)
 {
-	CodeGenerator<double> generator;
+	GeneratorRecording recording;
 
+	// record f once, the Hessian is the Jacobian of the gradient
+	ADDR energy = std::forward<F>(f)(std::forward<A>(a)...);
+	std::vector<RecType<double>> inputs;
 	for (int i = 0; i < variables.size(); i++)
-	{
-		(*variables[i]).deriv() = 1;
+		inputs.push_back((*variables[i]).value().value());
+	std::vector<RecType<double>> grad = gradient(energy.value().value(), inputs);
+	SparsityPattern pattern;
+	std::vector<RecType<double>> hess = symmetricJacobian(grad, inputs, pattern);
 
-		ADDR energy = std::forward<F>(f)(std::forward<A>(a)...);
-		RecType<double> grad = energy.deriv().value();
-		grad.addToGeneratorAsResult(generator, gradName + "[" + std::to_string(i) + "]");
+	CodeGenerator<double> generator;
+	for (int i = 0; i < variables.size(); i++)
+		grad[i].addToGeneratorAsResult(generator, gradName + "[" + std::to_string(i) + "]");
+	addMatrixToGenerator(generator, hessName, pattern, hess);
 
-		for (int j = 0; j < 3; j++)
-		{
-			(*variables[j]).value().deriv() = 1;
-			ADDR energy = std::forward<F>(f)(std::forward<A>(a)...);
-			RecType<double> hess = energy.deriv().deriv();
-			hess.addToGeneratorAsResult(generator, hessName + "(" + std::to_string(i) + ", " + std::to_string(j) + ")");
-			(*variables[j]).value().deriv() = 0;
-		}
-		(*variables[i]).deriv() = 0;
-	}
+	generator.sortNodes();
+	return generator.generateCode();
+}
+
+// Energy, gradient and Hessian in one generator, so all three share every
+// intermediate value.
+template<typename F, typename... A>
+std::string generateEnergyGradientAndHessianCode(const VarListX<ADDR> &variables, F &&f, A&&... a)
+{
+	GeneratorRecording recording;
+
+	// record f once, the Hessian is the Jacobian of the gradient
+	ADDR energy = std::forward<F>(f)(std::forward<A>(a)...);
+	RecType<double> E = energy.value().value();
+	std::vector<RecType<double>> inputs;
+	for (int i = 0; i < variables.size(); i++)
+		inputs.push_back((*variables[i]).value().value());
+	std::vector<RecType<double>> grad = gradient(E, inputs);
+	SparsityPattern pattern;
+	std::vector<RecType<double>> hess = symmetricJacobian(grad, inputs, pattern);
+
+	CodeGenerator<double> generator;
+	E.addToGeneratorAsResult(generator, energyName);
+	for (int i = 0; i < variables.size(); i++)
+		grad[i].addToGeneratorAsResult(generator, gradName + "[" + std::to_string(i) + "]");
+	addMatrixToGenerator(generator, hessName, pattern, hess);
 
 	generator.sortNodes();
 	return generator.generateCode();
@@ -172,44 +318,65 @@ std::string generateGradientAndHessianCode(const VarListX<ADDR> &variables, F &&
 template<typename F, typename... A>
 std::string generateHessianCode(const VarListX<ADDR> &variables, F &&f, A&&... a)
 {
-	CodeGenerator<double> generator;
+	GeneratorRecording recording;
 
+	// record f once, the Hessian is the Jacobian of the gradient
+	ADDR energy = std::forward<F>(f)(std::forward<A>(a)...);
+	std::vector<RecType<double>> inputs;
 	for (int i = 0; i < variables.size(); i++)
-	{
-		(*variables[i]).deriv() = 1;
-		for (int j = 0; j < variables.size(); j++)
-		{
-			(*variables[j]).value().deriv() = 1;
-			ADDR energy = std::forward<F>(f)(std::forward<A>(a)...);
-			RecType<double> hess = energy.deriv().deriv();
-			hess.addToGeneratorAsResult(generator, hessName + "(" + std::to_string(i) + ", " + std::to_string(j) + ")");
-			(*variables[j]).value().deriv() = 0;
-		}
-		(*variables[i]).deriv() = 0;
-	}
+		inputs.push_back((*variables[i]).value().value());
+	std::vector<RecType<double>> grad = gradient(energy.value().value(), inputs);
+	SparsityPattern pattern;
+	std::vector<RecType<double>> hess = symmetricJacobian(grad, inputs, pattern);
+
+	CodeGenerator<double> generator;
+	addMatrixToGenerator(generator, hessName, pattern, hess);
 
 	generator.sortNodes();
 	return generator.generateCode();
 }
 
+// The Hessian as `std::vector<Eigen::Triplet<double>> hess`, only the
+// structurally nonzero entries are computed.
 template<typename F, typename... A>
-std::string generateJacobianCode(const VarListX<ADDR> &firstVariables, const VarListX<ADDR> &secondVariables, F &&f, A&&... a)
+std::string generateSparseHessianCode(const VarListX<ADDR> &variables, F &&f, A&&... a)
 {
+	GeneratorRecording recording;
+
+	ADDR energy = std::forward<F>(f)(std::forward<A>(a)...);
+	std::vector<RecType<double>> inputs;
+	for (int i = 0; i < variables.size(); i++)
+		inputs.push_back((*variables[i]).value().value());
+	std::vector<RecType<double>> grad = gradient(energy.value().value(), inputs);
+	SparsityPattern pattern;
+	std::vector<RecType<double>> hess = symmetricJacobian(grad, inputs, pattern);
+
 	CodeGenerator<double> generator;
+	std::string tripletCode = addTripletsToGenerator(generator, hessName, pattern, hess);
 
+	generator.sortNodes();
+	std::string code = "double " + hessName + "_values[" + std::to_string(std::max(hess.size(), size_t(1))) + "];\n";
+	return code + generator.generateCode() + tripletCode;
+}
+
+template<typename F, typename... A>
+std::string generateJacobianCode(const VarListX<ADDR> &firstVariables, const VarListX<ADDR> &secondVariables, F &&f, A&&... a)
+{
+	GeneratorRecording recording;
+
+	// record f once, J is the Jacobian of the gradient by the first variables
+	ADDR energy = std::forward<F>(f)(std::forward<A>(a)...);
+	std::vector<RecType<double>> firstInputs, secondInputs;
 	for (int i = 0; i < firstVariables.size(); i++)
-	{
-		(*firstVariables[i]).deriv() = 1;
-		for (int j = 0; j < secondVariables.size(); j++)
-		{
-			(*secondVariables[j]).value().deriv() = 1;
-			ADDR energy = std::forward<F>(f)(std::forward<A>(a)...);
-			RecType<double> J = energy.deriv().deriv();
-			J.addToGeneratorAsResult(generator, jacobianName + "(" + std::to_string(i) + ", " + std::to_string(j) + ")");
-			(*secondVariables[j]).value().deriv() = 0;
-		}
-		(*firstVariables[i]).deriv() = 0;
-	}
+		firstInputs.push_back((*firstVariables[i]).value().value());
+	for (int j = 0; j < secondVariables.size(); j++)
+		secondInputs.push_back((*secondVariables[j]).value().value());
+	std::vector<RecType<double>> grad = gradient(energy.value().value(), firstInputs);
+	SparsityPattern pattern;
+	std::vector<RecType<double>> J = jacobian(grad, secondInputs, pattern);
+
+	CodeGenerator<double> generator;
+	addMatrixToGenerator(generator, jacobianName, pattern, J);
 
 	generator.sortNodes();
 	return generator.generateCode();
@@ -220,7 +387,7 @@ void printEnergyCodeADR(const std::string &fileName, F &&f, A&&... a)
 {
 	std::string code = generateEnergyCodeADR(f, std::forward<A>(a)...);
 
-	std::string type = std::forward<F>(f)(std::forward<A>(a)...).getGeneratedType();
+	std::string type = getResultType(f, std::forward<A>(a)...);
 
 	writeCodeToFile(fileName, "compute_E", type, energyName, code, std::forward<A>(a)...);
 }
@@ -230,7 +397,7 @@ void printEnergyCodeADR_customName(const std::string &fileName, const std::strin
 {
 	std::string code = generateEnergyCodeADR(f, std::forward<A>(a)...);
 
-	std::string type = std::forward<F>(f)(std::forward<A>(a)...).getGeneratedType();
+	std::string type = getResultType(f, std::forward<A>(a)...);
 
 	writeCodeToFile(fileName, "compute_" + customEnergyName, type, energyName, code, std::forward<A>(a)...);
 }
@@ -264,7 +431,7 @@ void printEnergyCodeADDR(const std::string &fileName, F &&f, A&&... a)
 {
 	std::string code = generateEnergyCodeADDR(f, std::forward<A>(a)...);
 
-	std::string type = std::forward<F>(f)(std::forward<A>(a)...).getGeneratedType();
+	std::string type = getResultType(f, std::forward<A>(a)...);
 
 	writeCodeToFile(fileName, "compute_E", type, energyName, code, std::forward<A>(a)...);
 }
@@ -293,6 +460,16 @@ void printHessianCode(const std::string &fileName, VarListX<ADDR> &variables, F
 	writeCodeToFile(fileName, "compute_ddE_dxdx", hessType, hessName, code, std::forward<A>(a)...);
 }
 
+template<typename F, typename... A>
+void printSparseHessianCode(const std::string &fileName, VarListX<ADDR> &variables, F &&f, A&&... a)
+{
+	std::string code = generateSparseHessianCode(variables, f, std::forward<A>(a)...);
+
+	std::string hessType = "std::vector<Eigen::Triplet<double>>";
+
+	writeCodeToFile(fileName, "compute_ddE_dxdx_sparse", hessType, hessName, code, std::forward<A>(a)...);
+}
+
 template<typename F, typename... A>
 void printJacobianCode(const std::string &fileName, VarListX<ADDR> &firstVariables, VarListX<ADDR> &secondVariables, const std::string &secondVariablesName, F &&f, A&&... a)
 {
@@ -325,4 +502,20 @@ void printGradientAndHessianCode(const std::string &fileName, VarListX<ADDR> &va
 	writeCodeToFile(fileName, "compute_dE_dx_and_ddE_dxdx", outputTypes, outputNames, code, std::forward<A>(a)...);
 }
 
+template<typename F, typename... A>
+void printEnergyGradientAndHessianCode(const std::string &fileName, VarListX<ADDR> &variables, F &&f, A&&... a)
+{
+	std::string code = generateEnergyGradientAndHessianCode(variables, f, std::forward<A>(a)...);
+
+	std::string type = variables.getInnerType();
+
+	std::string gradType = getGradType(type, variables.size());
+	std::string hessType = getHessType(type, variables.size());
+
+	std::vector<std::string> outputTypes = { type, gradType, hessType };
+	std::vector<std::string> outputNames = { energyName, gradName, hessName };
+
+	writeCodeToFile(fileName, "compute_E_dE_dx_and_ddE_dxdx", outputTypes, outputNames, code, std::forward<A>(a)...);
+}
+
 }
@@ -15,15 +15,125 @@
  * Currently this only works with g++ and on Linux. However, this should also
  * be possible on Windows and with the Visual compiler.
  *
+ * Kernel cache
+ * ------------
+ * `buildAndLoad` keeps the compiled libraries in a cache directory, keyed by a
+ * hash of the code, the compiler and the flags. Building the same code again,
+ * also from another process or after a restart, only loads the library. The
+ * directory is `$AUTOGEN_CACHE_DIR`, `$XDG_CACHE_HOME/autogen` or
+ * `~/.cache/autogen`, or set with `KernelCache::instance().setDirectory(dir)`.
+ * When the cache grows larger than `setMaxSize`, the least recently used
+ * libraries are removed. The source is kept next to every library, a library
+ * is only used if its source is the code being built, so two codes with the
+ * same key never load each other's library.
+ *
+ * With an empty cache directory, `buildAndLoad` builds in memory instead
+ * (`buildAndLoadInMemory`): the code is piped to the compiler, which writes
+ * the library into a memfd that is then loaded. Nothing is written to the
+ * working directory or the cache.
+ *
+ * Changes to headers included by the code are not detected, clear the cache
+ * (`KernelCache::instance().clear()`) after changing them.
+ *
+ * Compile profiles
+ * ----------------
+ * Kernels are compiled with a named `CompileProfile` (compiler and
+ * optimization flags), by default "default" with `-O2`. Other profiles are
+ * "debug" (`-O0`), "native" (`-O3 -march=native`), "fast" (additionally
+ * `-ffp-contract=fast`) and "clang" if clang++ is installed. Choose one with
+ * `CompileProfiles::instance().setDefault(name)` or add your own.
+ *
+ * `autotune` builds a kernel with every profile, times it on sample inputs and
+ * keeps the fastest profile whose results match the default profile. The
+ * choice is remembered in the cache, and later `buildAndLoad` calls for the
+ * same code use it.
+ *
+ * Parallel builds
+ * ---------------
+ * `buildAndLoadAsync` builds on a pool of threads, one per core, and returns
+ * a future of the function. If the build fails, the future throws an
+ * exception with the error. `buildAndLoadAll` starts many builds at once:
+ * ```
+ * std::vector<std::future<compute_extern*>> fncs = buildAndLoadAll<compute_extern>(codes);
+ * for (auto &fnc : fncs) {
+ *		fnc.get()(x, y); // throws if this build failed
+ * }
+ * ```
+ *
+ * Unloading
+ * ---------
+ * Functions loaded into a plain function pointer stay loaded until the
+ * process ends. To unload them, load into a `KernelHandle` instead, which
+ * closes the library when destroyed. `KernelRegistry` shares kernels between
+ * threads and replaces or removes them while other threads still call them:
+ * ```
+ * KernelHandle kernel;
+ * if(buildAndLoad(code, kernel, "energy", error))
+ *		KernelRegistry::instance().set("energy", std::move(kernel));
+ * ```
+ *
+ * Batched kernels
+ * ---------------
+ * `wrapComputeCode(code)` wraps generated code into a library with two
+ * entry points: `compute_extern` for one point and `compute_batch_extern`
+ * for many points with strided inputs and outputs:
+ * ```
+ * KernelHandle kernel;
+ * if(buildAndLoad(wrapComputeCode(code), kernel, error)) {
+ *		auto batch = reinterpret_cast<compute_batch_extern*>(kernel.getSymbol("compute_batch_extern"));
+ *		batch(n, in, numInputs, out, numOutputs);
+ * }
+ * ```
+ * The headers written by `writeCodeToFile` (AutoGen.h) contain the same
+ * batched function next to the typed one.
+ *
+ * Split kernels
+ * -------------
+ * The compile time of a function grows faster than its size. Huge kernels
+ * can be split into parts (`CodeGenerator::generateSplitCode`), which
+ * `buildAndLoad` compiles as separate translation units in parallel and links
+ * into one library:
+ * ```
+ * SplitCode code = generator.generateSplitCode("extern \"C\" void compute_extern(double* x, double* y)", 2000);
+ * KernelHandle kernel;
+ * if(buildAndLoad(code.getUnits(), kernel, "ddR", error))
+ *		kernel.get()(x, y);
+ * ```
+ *
  * Some online references:
  * http://tldp.org/HOWTO/Program-Library-HOWTO/dl-libraries.html
  *
  */
 
+#pragma once
+
 #include <dlfcn.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "execCmd.h"
 
@@ -33,6 +143,29 @@ namespace AutoGen {
 //                            in     out
 typedef void compute_extern(double*,double*);
 
+// batched function: evaluates `n` points, point k reads from `in + k*in_stride`
+// and writes to `out + k*out_stride`
+typedef void compute_batch_extern(size_t n, const double* in, size_t in_stride, double* out, size_t out_stride);
+
+// Wrap generated code, reading `x` and writing `y`, into library code with
+// the functions `compute_extern` and `compute_batch_extern`. The batched
+// function calls the inlined code in a loop, so only one call per batch goes
+// through the function pointer.
+inline std::string wrapComputeCode(const std::string &code, const std::string &includes = "#include <cmath>\n") {
+	std::string libCode = includes + "#include <cstddef>\n";
+	libCode += "static inline void compute(const double* __restrict x, double* __restrict y) {\n";
+	libCode += code;
+	libCode += "}\n";
+	libCode += "extern \"C\" void compute_extern(double* x, double* y) {\n"
+			   "\tcompute(x, y);\n"
+			   "}\n";
+	libCode += "extern \"C\" void compute_batch_extern(size_t n, const double* __restrict in, size_t in_stride, double* __restrict out, size_t out_stride) {\n"
+			   "\tfor (size_t k = 0; k < n; ++k)\n"
+			   "\t\tcompute(in + k*in_stride, out + k*out_stride);\n"
+			   "}\n";
+	return libCode;
+}
+
 bool buildLibrary(const std::string &code, const std::string &libName, std::string &error) {
 
 	// make dir
@@ -49,10 +182,10 @@ bool buildLibrary(const std::string &code, const std::string &libName, std::stri
 
 #if defined(__clang__)
 	std::cout << "Using `clang++` to compile '" << libName << "'." << std::endl;
-	std::string compile_cmd = "clang++ -fPIC -shared -o "+libName+"/lib"+libName+".so "+libName+"/"+libName+".cpp";
+	std::string compile_cmd = "clang++ -O2 -fPIC -shared -o "+libName+"/lib"+libName+".so "+libName+"/"+libName+".cpp";
 #elif defined(__GNUC__) || defined(__GNUG__)
 	std::cout << "Using `g++` to compile '" << libName << "'." << std::endl;
-	std::string compile_cmd = "g++ -fPIC -I" AUTOGEN_SRC_DIR " -shared -o "+libName+"/lib"+libName+".so "+libName+"/"+libName+".cpp";
+	std::string compile_cmd = "g++ -O2 -fPIC -I" AUTOGEN_SRC_DIR " -shared -o "+libName+"/lib"+libName+".so "+libName+"/"+libName+".cpp";
 #else
 	std::cout << "Using `cmake --build` to compile '" << libName << "'." << std::endl;
 	// create CMakeLists.txt
@@ -98,6 +231,115 @@ bool loadLibrary(std::string libName, F* (&fncPtr), std::string fncName = "compu
 	return true;
 }
 
+// Owns a loaded library, which is closed (`dlclose`) when the handle is
+// destroyed. Functions of the library must not be called after that, so share
+// the handle (e.g. in a `std::shared_ptr`) with everyone calling them.
+class KernelHandle
+{
+public:
+	KernelHandle() {
+	}
+
+	// Take ownership of `library` (from `dlopen`) and the file descriptor `fd`
+	// the library was loaded from (or -1).
+	KernelHandle(void *library, void *function, int fd = -1)
+		: mLibrary(library), mFunction(function), mFd(fd) {
+	}
+
+	KernelHandle(KernelHandle &&other)
+		: mLibrary(other.mLibrary), mFunction(other.mFunction), mFd(other.mFd) {
+		other.mLibrary = nullptr;
+		other.mFunction = nullptr;
+		other.mFd = -1;
+	}
+
+	KernelHandle &operator=(KernelHandle &&other) {
+		std::swap(mLibrary, other.mLibrary);
+		std::swap(mFunction, other.mFunction);
+		std::swap(mFd, other.mFd);
+		return *this;
+	}
+
+	KernelHandle(const KernelHandle &) = delete;
+	KernelHandle &operator=(const KernelHandle &) = delete;
+
+	~KernelHandle() {
+		reset();
+	}
+
+	void reset() {
+		if(mLibrary)
+			dlclose(mLibrary);
+		if(mFd >= 0)
+			close(mFd);
+		mLibrary = nullptr;
+		mFunction = nullptr;
+		mFd = -1;
+	}
+
+	template<class F = compute_extern>
+	F* get() const { return (F*) mFunction; }
+
+	// Another symbol of the library, or nullptr.
+	void *getSymbol(const std::string &name) const {
+		return mLibrary ? dlsym(mLibrary, name.c_str()) : nullptr;
+	}
+
+	// Give up ownership, the library stays loaded until the process ends.
+	template<class F = compute_extern>
+	F* release() {
+		F* function = get<F>();
+		mLibrary = nullptr;
+		mFunction = nullptr;
+		mFd = -1;
+		return function;
+	}
+
+	explicit operator bool() const { return mFunction != nullptr; }
+
+private:
+	void *mLibrary = nullptr;
+	void *mFunction = nullptr;
+	int mFd = -1;
+};
+
+// Load the function `fncName` of the library at `libPath`. `fd` (if not -1)
+// is closed together with the library.
+inline bool loadKernel(const std::string &libPath, KernelHandle &kernel, const std::string &fncName, std::string &error, int fd = -1) {
+	void* libCompute = dlopen(libPath.c_str(), RTLD_LAZY);
+	if (!libCompute) {
+		error += std::string("Cannot load library: ") + dlerror();
+		if(fd >= 0)
+			close(fd);
+		return false;
+	}
+	KernelHandle library(libCompute, nullptr, fd);
+
+	// reset errors
+	dlerror();
+
+	void *function = dlsym(libCompute, fncName.c_str());
+	const char* dlsym_error = dlerror();
+	if (dlsym_error) {
+		error += std::string("Cannot load symbol: ") + dlsym_error;
+		return false;
+	}
+
+	library.release();
+	kernel = KernelHandle(libCompute, function, fd);
+	return true;
+}
+
+// Like `loadKernel`, but the library is never closed.
+template<class F>
+bool loadLibraryFile(const std::string &libPath, F* (&fncPtr), const std::string &fncName, std::string &error) {
+	KernelHandle kernel;
+	if(!loadKernel(libPath, kernel, fncName, error))
+		return false;
+	fncPtr = kernel.release<F>();
+	return true;
+}
+
 std::string getPseudoUniqueLibName(std::string name = "") {
 	std::chrono::milliseconds ms = std::chrono::duration_cast<std::chrono::milliseconds >(std::chrono::system_clock::now().time_since_epoch());
 	std::srand(ms.count()); // use current time as seed for random generator
@@ -105,17 +347,636 @@ std::string getPseudoUniqueLibName(std::string name = "") {
 	return "lib_"+name+"_"+std::to_string(random_variable);
 }
 
+// 64 bit FNV-1a hash
+inline uint64_t hashString(const std::string &str, uint64_t hash = 14695981039346656037ull) {
+	for (unsigned char c : str) {
+		hash ^= c;
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+class KernelCache
+{
+public:
+	static KernelCache &instance() {
+		static KernelCache cache;
+		return cache;
+	}
+
+	void setDirectory(const std::string &directory) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		mDirectory = directory;
+	}
+
+	std::string getDirectory() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mDirectory;
+	}
+
+	// maximum size of all libraries and sources in the cache in bytes
+	void setMaxSize(size_t bytes) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		mMaxSize = bytes;
+	}
+
+	size_t getMaxSize() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mMaxSize;
+	}
+
+	// number of libraries this process compiled, i.e. cache misses
+	size_t getNumBuilds() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mNumBuilds;
+	}
+
+	// The cache key of `code` compiled with `compiler` and `flags`.
+	static std::string getKey(const std::string &code, const std::string &compiler, const std::string &flags) {
+		return getKey(std::vector<std::string>(1, code), compiler, flags);
+	}
+
+	// The cache key of the library linked from the translation units `units`.
+	static std::string getKey(const std::vector<std::string> &units, const std::string &compiler, const std::string &flags) {
+		uint64_t hash = hashString(compiler + '\n' + flags + '\n');
+		for (size_t i = 0; i < units.size(); ++i) {
+			if(i > 0)
+				hash = hashString(std::string(1, '\0'), hash);
+			hash = hashString(units[i], hash);
+		}
+		char key[17];
+		snprintf(key, sizeof(key), "%016llx", (unsigned long long)hash);
+		return key;
+	}
+
+	// The source stored next to the library of `units`, with the compiler and
+	// flags in its first line.
+	static std::string getSource(const std::vector<std::string> &units, const std::string &compiler, const std::string &flags) {
+		std::string command = compiler + " " + flags;
+		std::replace(command.begin(), command.end(), '\n', ' ');
+		std::string source = "// " + command + "\n";
+		for (size_t i = 0; i < units.size(); ++i) {
+			if(units.size() > 1)
+				source += "// translation unit " + std::to_string(i) + "\n";
+			source += units[i];
+		}
+		return source;
+	}
+
+	// Load the function `fncName` from the library of `code`, compile the
+	// library first if it is not in the cache. `name` is only used in messages.
+	bool load(const std::string &name, const std::string &code, const std::string &compiler, const std::string &flags, KernelHandle &kernel, const std::string &fncName, std::string &error) {
+		return load(name, std::vector<std::string>(1, code), compiler, flags, kernel, fncName, error);
+	}
+
+	// Like `load`, for a library linked from several translation units,
+	// which are compiled in parallel.
+	bool load(const std::string &name, const std::vector<std::string> &units, const std::string &compiler, const std::string &flags, KernelHandle &kernel, const std::string &fncName, std::string &error) {
+		std::string directory = getDirectory();
+		if(!makeDirectories(directory)) {
+			error = "Could not create directory: '" + directory + "'.";
+			return false;
+		}
+
+		std::string key = getKey(units, compiler, flags);
+		std::string base = directory + "/" + key;
+		std::string libPath = directory + "/lib" + key + ".so";
+
+		// other threads and processes wait while we build or load this library
+		int lockFd = lockEntry(base + ".lock", false);
+		if(lockFd < 0) {
+			error = "Could not lock '" + base + ".lock'.";
+			return false;
+		}
+
+		// a library with another source is a collision of keys, and rebuilt
+		bool success = true;
+		struct stat info;
+		std::string source = getSource(units, compiler, flags);
+		if(stat(libPath.c_str(), &info) == 0 && info.st_size > 0 && isSource(base + ".cpp", source)) {
+			// hit, mark as recently used
+			utimensat(AT_FDCWD, libPath.c_str(), nullptr, 0);
+		}
+		else {
+			std::cout << "Using `" << compiler << "` to compile '" << name << "' (" << key << ")." << std::endl;
+			success = build(units, compiler, flags, source, base, libPath, error);
+		}
+
+		if(success)
+			success = loadKernel(libPath, kernel, fncName, error);
+
+		unlockEntry(lockFd);
+
+		if(success)
+			evict(key);
+		return success;
+	}
+
+	// Remove least recently used libraries until the cache is not larger than
+	// the maximum size. Libraries in use by a build or load, and the library
+	// with key `keep`, are not removed.
+	void evict(const std::string &keep = "") {
+		std::string directory = getDirectory();
+		std::vector<Entry> entries = getEntries(directory);
+
+		size_t size = 0;
+		for (const Entry &entry : entries) {
+			size += entry.size;
+		}
+
+		size_t maxSize = getMaxSize();
+		std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+			return a.lastUsed < b.lastUsed;
+		});
+		for (const Entry &entry : entries) {
+			if(size <= maxSize)
+				break;
+			if(entry.key == keep)
+				continue;
+			if(remove(directory, entry.key))
+				size -= entry.size;
+		}
+	}
+
+	// Remove all libraries that are not in use, and all remembered profiles.
+	void clear() {
+		std::string directory = getDirectory();
+		for (const Entry &entry : getEntries(directory)) {
+			remove(directory, entry.key);
+		}
+
+		DIR *dir = opendir(directory.c_str());
+		if(!dir)
+			return;
+		const std::string suffix = ".profile";
+		while(struct dirent *file = readdir(dir)) {
+			std::string name = file->d_name;
+			if(name.size() > suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0)
+				unlink((directory + "/" + name).c_str());
+		}
+		closedir(dir);
+	}
+
+	// Remember `profile` as the best compile profile for `code`.
+	bool setTunedProfile(const std::string &code, const std::string &profile) {
+		std::string directory = getDirectory();
+		if(directory.empty() || !makeDirectories(directory))
+			return false;
+
+		std::string path = directory + "/" + getKey(code, "", "") + ".profile";
+		std::string tmpPath = path + "." + std::to_string(getpid()) + ".tmp";
+		std::ofstream file(tmpPath);
+		file << profile;
+		file.close();
+		return file && std::rename(tmpPath.c_str(), path.c_str()) == 0;
+	}
+
+	bool getTunedProfile(const std::string &code, std::string &profile) const {
+		std::string directory = getDirectory();
+		if(directory.empty())
+			return false;
+		std::ifstream file(directory + "/" + getKey(code, "", "") + ".profile");
+		return bool(std::getline(file, profile));
+	}
+
+private:
+	KernelCache() {
+		const char *dir = std::getenv("AUTOGEN_CACHE_DIR");
+		const char *xdg = std::getenv("XDG_CACHE_HOME");
+		const char *home = std::getenv("HOME");
+		if(dir && *dir)
+			mDirectory = dir;
+		else if(xdg && *xdg)
+			mDirectory = std::string(xdg) + "/autogen";
+		else if(home && *home)
+			mDirectory = std::string(home) + "/.cache/autogen";
+		else
+			mDirectory = "autogen-cache";
+	}
+
+	struct Entry
+	{
+		std::string key;
+		size_t size;
+		int64_t lastUsed;
+	};
+
+	bool build(const std::vector<std::string> &units, const std::string &compiler, const std::string &flags, const std::string &source, const std::string &base, const std::string &libPath, std::string &error) {
+		// compile to temporary files, so a library is either complete or missing
+		std::hash<std::thread::id> hashId;
+		std::string tmpPath = libPath + "." + std::to_string(getpid()) + "-" + std::to_string(hashId(std::this_thread::get_id())) + ".tmp";
+
+		// a library is only used next to its source: remove the library of
+		// another source first, and replace the source at once
+		unlink(libPath.c_str());
+		std::string tmpCppPath = tmpPath + ".cpp";
+		std::ofstream cppFile(tmpCppPath, std::ios::binary);
+		cppFile << source;
+		cppFile.close();
+		if(!cppFile || std::rename(tmpCppPath.c_str(), (base + ".cpp").c_str()) != 0) {
+			unlink(tmpCppPath.c_str());
+			error = "Could not write '" + base + ".cpp'.";
+			return false;
+		}
+
+		std::string out;
+		if(units.size() == 1) {
+			if(runCompiler(compiler, flags, {"-o", tmpPath, base + ".cpp"}, out) != 0 || std::rename(tmpPath.c_str(), libPath.c_str()) != 0) {
+				unlink(tmpPath.c_str());
+				error += "Failed to compile '" + base + ".cpp':\n" + out;
+				return false;
+			}
+		}
+		else if(!buildUnits(units, compiler, flags, tmpPath, error) || std::rename(tmpPath.c_str(), libPath.c_str()) != 0) {
+			unlink(tmpPath.c_str());
+			error = "Failed to compile '" + base + ".cpp':\n" + error;
+			return false;
+		}
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		mNumBuilds++;
+		return true;
+	}
+
+	// Compile every unit to an object file, one compiler per core, and link
+	// them into the library `libPath`.
+	static bool buildUnits(const std::vector<std::string> &units, const std::string &compiler, const std::string &flags, const std::string &libPath, std::string &error) {
+		std::vector<std::string> paths(units.size()), outs(units.size());
+		std::vector<int> results(units.size(), -1);
+		for (size_t i = 0; i < units.size(); ++i) {
+			paths[i] = libPath + "." + std::to_string(i);
+			std::ofstream unitFile(paths[i] + ".cpp");
+			unitFile << units[i];
+		}
+
+		std::atomic<size_t> next(0);
+		auto compile = [&]() {
+			for (size_t i = next++; i < units.size(); i = next++) {
+				results[i] = runCompiler(compiler, flags, {"-c", "-o", paths[i] + ".o", paths[i] + ".cpp"}, outs[i]);
+			}
+		};
+		std::vector<std::thread> threads(std::min<size_t>(units.size(), std::max(1u, std::thread::hardware_concurrency())) - 1);
+		for (std::thread &thread : threads) {
+			thread = std::thread(compile);
+		}
+		compile();
+		for (std::thread &thread : threads) {
+			thread.join();
+		}
+
+		bool success = true;
+		std::vector<std::string> linkArgs = {"-o", libPath};
+		for (size_t i = 0; i < units.size(); ++i) {
+			if(results[i] != 0) {
+				error += "translation unit " + std::to_string(i) + ":\n" + outs[i];
+				success = false;
+			}
+			linkArgs.push_back(paths[i] + ".o");
+		}
+
+		if(success) {
+			std::string out;
+			if(runCompiler(compiler, flags, linkArgs, out) != 0) {
+				error += out;
+				success = false;
+			}
+		}
+
+		for (const std::string &path : paths) {
+			unlink((path + ".cpp").c_str());
+			unlink((path + ".o").c_str());
+		}
+		return success;
+	}
+
+	// Run `compiler` with `flags` and `args` and collect its output in `out`.
+	// The compiler is run without a shell, so paths are passed as they are.
+	// Returns the exit status.
+	static int runCompiler(const std::string &compiler, const std::string &flags, const std::vector<std::string> &args, std::string &out) {
+		std::vector<std::string> argv = {compiler};
+		std::istringstream flagStream(flags);
+		for (std::string flag; flagStream >> flag; )
+			argv.push_back(flag);
+		argv.insert(argv.end(), args.begin(), args.end());
+#ifdef __linux__
+		return execWithInput(argv, "", out);
+#else
+		std::string cmd;
+		for (const std::string &arg : argv) {
+			std::string quoted;
+			for (char c : arg)
+				quoted += (c == '\'') ? std::string("'\\''") : std::string(1, c);
+			cmd += "'" + quoted + "' ";
+		}
+		return exec(cmd + "2>&1", out);
+#endif
+	}
+
+	// is the content of the file `path` `source`?
+	static bool isSource(const std::string &path, const std::string &source) {
+		std::ifstream file(path, std::ios::binary);
+		if(!file)
+			return false;
+		std::ostringstream content;
+		content << file.rdbuf();
+		return content.str() == source;
+	}
+
+	// Remove an entry, unless another thread or process is using it. Threads
+	// waiting for its lock retry with a new lock file, see `lockEntry`.
+	bool remove(const std::string &directory, const std::string &key) {
+		std::string base = directory + "/" + key;
+		int lockFd = lockEntry(base + ".lock", true);
+		if(lockFd < 0)
+			return false;
+		unlink((directory + "/lib" + key + ".so").c_str());
+		unlink((base + ".cpp").c_str());
+		unlink((base + ".lock").c_str());
+		unlockEntry(lockFd);
+		return true;
+	}
+
+	static std::vector<Entry> getEntries(const std::string &directory) {
+		std::vector<Entry> entries;
+		DIR *dir = opendir(directory.c_str());
+		if(!dir)
+			return entries;
+
+		while(struct dirent *file = readdir(dir)) {
+			std::string name = file->d_name;
+			if(name.size() != 3 + 16 + 3 || name.compare(0, 3, "lib") != 0 || name.compare(19, 3, ".so") != 0)
+				continue;
+
+			Entry entry;
+			entry.key = name.substr(3, 16);
+			struct stat info;
+			if(stat((directory + "/" + name).c_str(), &info) != 0)
+				continue;
+			entry.size = info.st_size;
+			entry.lastUsed = int64_t(info.st_mtim.tv_sec)*1000000000 + info.st_mtim.tv_nsec;
+			if(stat((directory + "/" + entry.key + ".cpp").c_str(), &info) == 0)
+				entry.size += info.st_size;
+			entries.push_back(entry);
+		}
+		closedir(dir);
+		return entries;
+	}
+
+	// Open and lock a lock file, returns the file descriptor or -1. If the
+	// file was removed while we waited for the lock, the lock protects
+	// nothing anymore, so we lock the file that is at `path` now.
+	static int lockEntry(const std::string &path, bool tryOnly) {
+		while(true) {
+			int fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+			if(fd < 0)
+				return -1;
+			struct stat locked, current;
+			if(flock(fd, tryOnly ? (LOCK_EX | LOCK_NB) : LOCK_EX) != 0 || fstat(fd, &locked) != 0) {
+				close(fd);
+				return -1;
+			}
+			if(stat(path.c_str(), &current) == 0 && current.st_dev == locked.st_dev && current.st_ino == locked.st_ino)
+				return fd;
+			unlockEntry(fd);
+		}
+	}
+
+	static void unlockEntry(int fd) {
+		flock(fd, LOCK_UN);
+		close(fd);
+	}
+
+	static bool makeDirectories(const std::string &path) {
+		for (size_t pos = path.find('/', 1); ; pos = path.find('/', pos + 1)) {
+			std::string dir = path.substr(0, pos);
+			if(mkdir(dir.c_str(), 0755) != 0 && errno != EEXIST)
+				return false;
+			if(pos == std::string::npos)
+				return true;
+		}
+	}
+
+private:
+	mutable std::mutex mMutex;
+	std::string mDirectory;
+	size_t mMaxSize = size_t(1) << 30;
+	size_t mNumBuilds = 0;
+};
+
+// Compiler used by profiles that do not name one.
+inline std::string getCompiler() {
+#if defined(__clang__)
+	return "clang++";
+#else
+	return "g++";
+#endif
+}
+
+// Flags every kernel is compiled with, independent of the profile.
+inline std::string getCompileFlags() {
+	return "-fPIC -I" AUTOGEN_SRC_DIR " -shared";
+}
+
+struct CompileProfile
+{
+	std::string name;
+	std::string compiler;	// empty for `getCompiler()`
+	std::string flags;		// added to `getCompileFlags()`
+
+	std::string getCompiler() const {
+		return compiler.empty() ? AutoGen::getCompiler() : compiler;
+	}
+
+	std::string getFlags() const {
+		return getCompileFlags() + " " + flags;
+	}
+};
+
+// The named compile profiles, and the profile used by default.
+class CompileProfiles
+{
+public:
+	static CompileProfiles &instance() {
+		static CompileProfiles profiles;
+		return profiles;
+	}
+
+	// Add a profile, or replace the profile with the same name.
+	void add(const CompileProfile &profile) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		for (CompileProfile &p : mProfiles) {
+			if(p.name == profile.name) {
+				p = profile;
+				return;
+			}
+		}
+		mProfiles.push_back(profile);
+	}
+
+	void remove(const std::string &name) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		mProfiles.erase(std::remove_if(mProfiles.begin(), mProfiles.end(), [&name](const CompileProfile &p) {
+			return p.name == name;
+		}), mProfiles.end());
+	}
+
+	bool get(const std::string &name, CompileProfile &profile) const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		for (const CompileProfile &p : mProfiles) {
+			if(p.name == name) {
+				profile = p;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	std::vector<CompileProfile> getAll() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mProfiles;
+	}
+
+	void setDefault(const std::string &name) {
+		std::lock_guard<std::mutex> lock(mMutex);
+		mDefault = name;
+	}
+
+	CompileProfile getDefault() const {
+		CompileProfile profile;
+		std::string name;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			name = mDefault;
+		}
+		if(!get(name, profile))
+			throw std::invalid_argument("AutoLoad: unknown compile profile '" + name + "'");
+		return profile;
+	}
+
+private:
+	CompileProfiles() {
+		mProfiles.push_back({"debug", "", "-O0"});
+		mProfiles.push_back({"default", "", "-O2"});
+		mProfiles.push_back({"native", "", "-O3 -march=native"});
+		mProfiles.push_back({"fast", "", "-O3 -march=native -ffp-contract=fast"});
+		std::string out;
+		if(exec("command -v clang++", out) == 0)
+			mProfiles.push_back({"clang", "clang++", "-O3 -march=native"});
+	}
+
+private:
+	mutable std::mutex mMutex;
+	std::vector<CompileProfile> mProfiles;
+	std::string mDefault = "default";
+};
+
+// Build the library of `code` with `profile` without files: the code is piped
+// to the compiler, the library is written to an anonymous memory file (memfd)
+// and loaded from there. The compiler keeps its object file in `$TMPDIR`,
+// which is set to /dev/shm if that exists.
+//
+// The memfd is owned by `kernel` and stays open as long as the library is
+// loaded.
+inline bool buildAndLoadInMemory(const std::string &code, KernelHandle &kernel, const std::string &name, const CompileProfile &profile, std::string &error) {
+#ifndef __linux__
+	error = "Building in memory is only supported on Linux.";
+	return false;
+#else
+	std::cout << "Using `" << profile.getCompiler() << "` to compile '" << name << "' in memory." << std::endl;
+
+	int libFd = memfd_create("autogen-kernel", MFD_CLOEXEC);
+	if(libFd < 0) {
+		error = "Could not create memfd.";
+		return false;
+	}
+
+	// the compiler writes the library to its fd 3, our memfd
+	std::vector<std::string> args = {profile.getCompiler()};
+	std::istringstream flags(profile.getFlags());
+	for (std::string flag; flags >> flag; )
+		args.push_back(flag);
+	for (const char *arg : {"-pipe", "-x", "c++", "-", "-o", "/proc/self/fd/3"})
+		args.push_back(arg);
+
+	// keep the object file of the compiler in memory too
+	std::vector<std::string> env;
+	if(access("/dev/shm", W_OK) == 0)
+		env.push_back("TMPDIR=/dev/shm");
+
+	std::string out;
+	int status = execWithInput(args, code, out, libFd, env);
+	if(status != 0) {
+		close(libFd);
+		error += "Failed to compile '" + name + "':\n" + out;
+		return false;
+	}
+
+	return loadKernel("/proc/self/fd/" + std::to_string(libFd), kernel, "compute_extern", error, libFd);
+#endif
+}
+
 template<class F>
-bool buildAndLoad(const std::string &code, F* (&fnc), const std::string &name, std::string &error) {
+bool buildAndLoadInMemory(const std::string &code, F* (&fnc), const std::string &name, const CompileProfile &profile, std::string &error) {
+	KernelHandle kernel;
+	if(!buildAndLoadInMemory(code, kernel, name, profile, error))
+		return false;
+	fnc = kernel.release<F>();
+	return true;
+}
+
+// Build (or get from the cache) and load the library of `code` with `profile`.
+// `name` is only used in messages.
+inline bool buildAndLoad(const std::string &code, KernelHandle &kernel, const std::string &name, const CompileProfile &profile, std::string &error) {
+	if(KernelCache::instance().getDirectory().empty())
+		return buildAndLoadInMemory(code, kernel, name, profile, error);
+	return KernelCache::instance().load(name, code, profile.getCompiler(), profile.getFlags(), kernel, "compute_extern", error);
+}
+
+// Build (or get from the cache) and load the library of `code`, with the
+// profile `autotune` chose for it or else the default profile.
+inline bool buildAndLoad(const std::string &code, KernelHandle &kernel, const std::string &name, std::string &error) {
+	CompileProfile profile;
+	std::string tuned;
+	if(!KernelCache::instance().getTunedProfile(code, tuned) || !CompileProfiles::instance().get(tuned, profile))
+		profile = CompileProfiles::instance().getDefault();
+	return buildAndLoad(code, kernel, name, profile, error);
+}
 
-	std::string libName = getPseudoUniqueLibName(name);
+inline bool buildAndLoad(const std::string &code, KernelHandle &kernel, std::string &error) {
+	return buildAndLoad(code, kernel, "", error);
+}
 
-	if(!buildLibrary(code, libName, error))
+// Build (or get from the cache) and load the library linked from the
+// translation units `units`, e.g. of `SplitCode::getUnits` (CodeGenerator.h).
+// The units are compiled in parallel, this needs a cache directory.
+inline bool buildAndLoad(const std::vector<std::string> &units, KernelHandle &kernel, const std::string &name, const CompileProfile &profile, std::string &error) {
+	if(KernelCache::instance().getDirectory().empty()) {
+		error = "Building '" + name + "' from several translation units needs a cache directory.";
 		return false;
+	}
+	return KernelCache::instance().load(name, units, profile.getCompiler(), profile.getFlags(), kernel, "compute_extern", error);
+}
 
-	if(!loadLibrary(libName, fnc))
+inline bool buildAndLoad(const std::vector<std::string> &units, KernelHandle &kernel, const std::string &name, std::string &error) {
+	return buildAndLoad(units, kernel, name, CompileProfiles::instance().getDefault(), error);
+}
+
+// The same, but the library is never closed.
+template<class F>
+bool buildAndLoad(const std::string &code, F* (&fnc), const std::string &name, const CompileProfile &profile, std::string &error) {
+	KernelHandle kernel;
+	if(!buildAndLoad(code, kernel, name, profile, error))
 		return false;
+	fnc = kernel.release<F>();
+	return true;
+}
 
+template<class F>
+bool buildAndLoad(const std::string &code, F* (&fnc), const std::string &name, std::string &error) {
+	KernelHandle kernel;
+	if(!buildAndLoad(code, kernel, name, error))
+		return false;
+	fnc = kernel.release<F>();
 	return true;
 }
 
@@ -124,5 +985,280 @@ bool buildAndLoad(const std::string &code, F* (&fnc), std::string &error) {
 	return buildAndLoad(code, fnc, "", error);
 }
 
+// Seconds per call of `fnc` over all samples, best of three runs.
+inline double timeKernel(compute_extern* fnc, std::vector<double> &inputs, size_t numInputs, size_t numOutputs) {
+	size_t numSamples = inputs.size() / numInputs;
+	std::vector<double> outputs(numOutputs);
+	auto run = [&](size_t repetitions) {
+		auto t0 = std::chrono::steady_clock::now();
+		for (size_t r = 0; r < repetitions; ++r)
+			for (size_t i = 0; i < numSamples; ++i)
+				fnc(&inputs[i*numInputs], outputs.data());
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+	};
+
+	// repeat to run at least a few milliseconds
+	size_t repetitions = 1;
+	while(run(repetitions) < 0.005 && repetitions < (size_t(1) << 20))
+		repetitions *= 4;
+
+	double best = run(repetitions);
+	for (int i = 0; i < 2; ++i)
+		best = std::min(best, run(repetitions));
+	return best / (repetitions*numSamples);
+}
+
+// Build `code` with every compile profile and load the fastest one on the
+// sample `inputs` (`numInputs` values per sample) whose outputs are within
+// `tolerance` (relative) of the default profile. Profiles that fail to build
+// are skipped. The choice is remembered for `code`: if it was tuned before,
+// the remembered profile is loaded without tuning again.
+inline bool autotune(const std::string &code, const std::vector<double> &inputs, size_t numInputs, size_t numOutputs, KernelHandle &kernel, std::string &profileName, std::string &error, double tolerance = 1e-9) {
+	KernelCache &cache = KernelCache::instance();
+	CompileProfile profile;
+	if(cache.getTunedProfile(code, profileName) && CompileProfiles::instance().get(profileName, profile))
+		return buildAndLoad(code, kernel, "autotune " + profileName, profile, error);
+
+	if(numInputs == 0 || inputs.size() < numInputs) {
+		error = "Autotune needs at least one sample.";
+		return false;
+	}
+	std::vector<double> samples(inputs.begin(), inputs.begin() + inputs.size() / numInputs * numInputs);
+	size_t numSamples = samples.size() / numInputs;
+
+	// results of the default profile
+	CompileProfile reference = CompileProfiles::instance().getDefault();
+	KernelHandle best;
+	if(!buildAndLoad(code, best, "autotune " + reference.name, reference, error))
+		return false;
+	std::vector<double> expected(numSamples*numOutputs);
+	for (size_t i = 0; i < numSamples; ++i)
+		best.get()(&samples[i*numInputs], &expected[i*numOutputs]);
+
+	double bestTime = timeKernel(best.get(), samples, numInputs, numOutputs);
+	profileName = reference.name;
+
+	// the libraries of all but the best profile are closed again
+	for (const CompileProfile &candidate : CompileProfiles::instance().getAll()) {
+		KernelHandle candidateKernel;
+		std::string candidateError;
+		if(candidate.name == reference.name || !buildAndLoad(code, candidateKernel, "autotune " + candidate.name, candidate, candidateError))
+			continue;
+		compute_extern* candidateFnc = candidateKernel.get();
+
+		bool valid = true;
+		std::vector<double> outputs(numOutputs);
+		for (size_t i = 0; i < numSamples && valid; ++i) {
+			candidateFnc(&samples[i*numInputs], outputs.data());
+			for (size_t j = 0; j < numOutputs && valid; ++j) {
+				double e = expected[i*numOutputs + j];
+				valid = std::abs(outputs[j] - e) <= tolerance*std::max(1.0, std::abs(e));
+			}
+		}
+		if(!valid)
+			continue;
+
+		double time = timeKernel(candidateFnc, samples, numInputs, numOutputs);
+		if(time < bestTime) {
+			bestTime = time;
+			best = std::move(candidateKernel);
+			profileName = candidate.name;
+		}
+	}
+
+	cache.setTunedProfile(code, profileName);
+	kernel = std::move(best);
+	return true;
+}
+
+// The same, but the library is never closed.
+inline bool autotune(const std::string &code, const std::vector<double> &inputs, size_t numInputs, size_t numOutputs, compute_extern* (&fnc), std::string &profileName, std::string &error, double tolerance = 1e-9) {
+	KernelHandle kernel;
+	if(!autotune(code, inputs, numInputs, numOutputs, kernel, profileName, error, tolerance))
+		return false;
+	fnc = kernel.release();
+	return true;
+}
+
+// Runs jobs on a fixed number of threads, so that at most that many compilers
+// run at the same time.
+class BuildPool
+{
+public:
+	static BuildPool &instance() {
+		static BuildPool pool(std::max(1u, std::thread::hardware_concurrency()));
+		return pool;
+	}
+
+	explicit BuildPool(size_t numThreads) {
+		for (size_t i = 0; i < numThreads; ++i) {
+			mThreads.push_back(std::thread([this]() { work(); }));
+		}
+	}
+
+	~BuildPool() {
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mStop = true;
+		}
+		mCondition.notify_all();
+		for (std::thread &thread : mThreads) {
+			thread.join();
+		}
+	}
+
+	BuildPool(const BuildPool &) = delete;
+	BuildPool &operator=(const BuildPool &) = delete;
+
+	// Run `job` on one of the threads, the future gets its result or exception.
+	template<class R>
+	std::future<R> submit(std::function<R()> job) {
+		std::shared_ptr<std::packaged_task<R()>> task = std::make_shared<std::packaged_task<R()>>(job);
+		std::future<R> result = task->get_future();
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mJobs.push_back([task]() { (*task)(); });
+		}
+		mCondition.notify_one();
+		return result;
+	}
+
+	size_t getNumThreads() const { return mThreads.size(); }
+
+private:
+	void work() {
+		while(true) {
+			std::function<void()> job;
+			{
+				std::unique_lock<std::mutex> lock(mMutex);
+				mCondition.wait(lock, [this]() { return mStop || !mJobs.empty(); });
+				if(mJobs.empty())
+					return;
+				job = std::move(mJobs.front());
+				mJobs.pop_front();
+			}
+			job();
+		}
+	}
+
+private:
+	std::vector<std::thread> mThreads;
+	std::deque<std::function<void()>> mJobs;
+	std::mutex mMutex;
+	std::condition_variable mCondition;
+	bool mStop = false;
+};
+
+// Build and load the library of `code` on the build pool. The future throws a
+// `std::runtime_error` with the error message if this fails.
+template<class F>
+std::future<F*> buildAndLoadAsync(const std::string &code, const std::string &name = "") {
+	return BuildPool::instance().submit<F*>([code, name]() {
+		F* fnc = nullptr;
+		std::string error;
+		if(!buildAndLoad(code, fnc, name, error))
+			throw std::runtime_error(error);
+		return fnc;
+	});
+}
+
+// Build and load many libraries in parallel, `names[i]` (if given) is the name
+// of `codes[i]` in messages.
+template<class F>
+std::vector<std::future<F*>> buildAndLoadAll(const std::vector<std::string> &codes, const std::vector<std::string> &names = {}) {
+	std::vector<std::future<F*>> fncs;
+	fncs.reserve(codes.size());
+	for (size_t i = 0; i < codes.size(); ++i) {
+		fncs.push_back(buildAndLoadAsync<F>(codes[i], (i < names.size()) ? names[i] : ""));
+	}
+	return fncs;
 }
 
+// Thread-safe map from names (or cache keys) to loaded kernels. The map is an
+// immutable snapshot that writers replace as a whole: finding a kernel only
+// locks to copy the pointer to the current snapshot, the lookup runs without
+// the lock and never waits for a writer copying the map. Snapshots are not
+// cached per thread, that would keep removed kernels loaded. A kernel found
+// stays loaded as long as the caller holds it, also if it is removed or
+// replaced meanwhile:
+// ```
+// KernelRegistry::Kernel kernel = registry.find("energy");
+// if(kernel)
+//		kernel->get()(x, y);
+// ```
+class KernelRegistry
+{
+public:
+	typedef std::shared_ptr<const KernelHandle> Kernel;
+
+	static KernelRegistry &instance() {
+		static KernelRegistry registry;
+		return registry;
+	}
+
+	KernelRegistry()
+		: mKernels(std::make_shared<const Map>()) {
+	}
+
+	// The kernel registered as `name`, or nullptr.
+	Kernel find(const std::string &name) const {
+		std::shared_ptr<const Map> kernels = getKernels();
+		Map::const_iterator it = kernels->find(name);
+		return (it == kernels->end()) ? nullptr : it->second;
+	}
+
+	// Register `kernel` as `name`, replacing and returning the previous kernel.
+	Kernel set(const std::string &name, Kernel kernel) {
+		return update(name, &kernel);
+	}
+
+	Kernel set(const std::string &name, KernelHandle &&kernel) {
+		return set(name, std::make_shared<const KernelHandle>(std::move(kernel)));
+	}
+
+	// Unregister `name`, returning the removed kernel. It is unloaded once no
+	// one holds it anymore.
+	Kernel remove(const std::string &name) {
+		return update(name, nullptr);
+	}
+
+	size_t size() const {
+		return getKernels()->size();
+	}
+
+private:
+	typedef std::unordered_map<std::string, Kernel> Map;
+
+	std::shared_ptr<const Map> getKernels() const {
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mKernels;
+	}
+
+	// copy, modify and publish the map, `kernel` nullptr removes `name`
+	Kernel update(const std::string &name, const Kernel *kernel) {
+		std::lock_guard<std::mutex> lock(mWriteMutex);
+		std::shared_ptr<Map> kernels = std::make_shared<Map>(*getKernels());
+		Kernel previous;
+		Map::iterator it = kernels->find(name);
+		if(it != kernels->end()) {
+			previous = it->second;
+			kernels->erase(it);
+		}
+		if(kernel)
+			kernels->insert(std::make_pair(name, *kernel));
+		std::shared_ptr<const Map> published = kernels;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mKernels.swap(published);
+		}
+		// the previous snapshot is released outside the lock
+		return previous;
+	}
+
+private:
+	std::shared_ptr<const Map> mKernels;
+	mutable std::mutex mMutex;	// guards mKernels, only while copying it
+	std::mutex mWriteMutex;	// serializes updates
+};
+
+}
@@ -0,0 +1,448 @@
+#pragma once
+
+#include "CodeGenerator.h"
+#include "NodeTypes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define AUTOGEN_SIMD_X86
+#define AUTOGEN_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define AUTOGEN_ALWAYS_INLINE inline
+#endif
+
+namespace AutoGen {
+
+// instruction set used by `Bytecode::evaluateBatch`
+enum SimdLevel { SIMD_AUTO, SIMD_SCALAR, SIMD_AVX2, SIMD_AVX512 };
+
+/*
+ * Bytecode
+ * ========
+ *
+ * Evaluates an expression graph without generating and compiling code. The
+ * sorted graph of a `CodeGenerator` is lowered to a flat list of register
+ * instructions, which a small interpreter loop runs on plain arrays:
+ * ```
+ * RecType<double> x("x[0]"), y("x[1]");
+ * CodeGenerator<double> generator;
+ * (x*y + sin(x)).addToGeneratorAsResult(generator, "y[0]");
+ * generator.sortNodes();
+ *
+ * Bytecode<double> bytecode = Bytecode<double>::compile(generator);
+ * double in[2] = {1.0, 2.0}, out[1];
+ * bytecode.evaluate(in, out);
+ * ```
+ *
+ * Every variable (`NodeVar`) is read from an input slot `in[i]` and every
+ * result (`NodeResult`) is written to an output slot `out[i]`. The slots are
+ * either given explicitly by name, or derived from the names: if all names end
+ * with distinct indices like `x[3]` or `grad(3)`, the index is the slot,
+ * otherwise the slots are numbered in the order the nodes appear in the sorted
+ * graph.
+ *
+ * Registers are reused once a value is not needed anymore, so the register
+ * file stays small even for large graphs.
+ *
+ * Batches
+ * -------
+ * `evaluateBatch` runs the graph for many points at once. Inputs and outputs
+ * are in structure-of-arrays layout: input i of point k is `in[i*n + k]`.
+ * The points are processed in chunks of `batchLanes`, every instruction works
+ * on a whole chunk. For `double`, add, sub, mul, div and neg use AVX-512 or
+ * AVX2 vectors if the CPU supports them, the other ops run lane by lane.
+ */
+template<class S>
+class Bytecode
+{
+public:
+	enum OpCode : uint8_t {
+		LOAD,	// r[dst] = in[a]
+		CONST,	// r[dst] = constants[a]
+		STORE,	// out[dst] = r[a]
+		NEG, ADD, SUB, MUL, DIV, POW, SQRT, COS, SIN, ACOS
+	};
+
+	struct Instruction
+	{
+		OpCode op;
+		uint32_t dst;
+		uint32_t a;
+		uint32_t b;
+	};
+
+	// Compile the sorted graph of `generator`. The variable named `inputs[i]` is
+	// read from `in[i]`, the result named `outputs[i]` is written to `out[i]`.
+	static Bytecode<S> compile(const CodeGenerator<S> &generator, const std::vector<std::string> &inputs, const std::vector<std::string> &outputs) {
+		return Bytecode<S>(generator, makeSlots(inputs), makeSlots(outputs));
+	}
+
+	// Compile the sorted graph of `generator`, with slots derived from the names
+	// of the variables and results.
+	static Bytecode<S> compile(const CodeGenerator<S> &generator) {
+		std::vector<std::string> inputs, outputs;
+		for (size_t i = 0; i < generator.getNumNodes(); ++i) {
+			const Node<S>* node = generator.getNode(i);
+			if(node->getOp() == VAR_OP)
+				inputs.push_back(static_cast<const NodeVar<S>*>(node)->getVarName());
+			else if(node->getOp() == RESULT_OP)
+				outputs.push_back(static_cast<const NodeResult<S>*>(node)->getResVarName());
+		}
+		return Bytecode<S>(generator, deriveSlots(inputs), deriveSlots(outputs));
+	}
+
+	// Evaluate with `in` holding `getNumInputs()` and `out` `getNumOutputs()`
+	// values. Uses a thread local register file.
+	void evaluate(const S *in, S *out) const {
+		static thread_local std::vector<S> registers;
+		if(registers.size() < mNumRegisters)
+			registers.resize(mNumRegisters);
+		evaluate(in, out, registers.data());
+	}
+
+	// Evaluate using `registers`, which has to hold `getNumRegisters()` values.
+	void evaluate(const S *in, S *out, S *registers) const {
+		using std::pow; using std::sqrt; using std::cos; using std::sin; using std::acos;
+
+		S *r = registers;
+		const S *constants = mConstants.data();
+		const Instruction *end = mInstructions.data() + mInstructions.size();
+		for (const Instruction *i = mInstructions.data(); i != end; ++i) {
+			switch (i->op) {
+			case LOAD:	r[i->dst] = in[i->a]; break;
+			case CONST:	r[i->dst] = constants[i->a]; break;
+			case STORE:	out[i->dst] = r[i->a]; break;
+			case NEG:	r[i->dst] = -r[i->a]; break;
+			case ADD:	r[i->dst] = r[i->a] + r[i->b]; break;
+			case SUB:	r[i->dst] = r[i->a] - r[i->b]; break;
+			case MUL:	r[i->dst] = r[i->a] * r[i->b]; break;
+			case DIV:	r[i->dst] = r[i->a] / r[i->b]; break;
+			case POW:	r[i->dst] = pow(r[i->a], r[i->b]); break;
+			case SQRT:	r[i->dst] = sqrt(r[i->a]); break;
+			case COS:	r[i->dst] = cos(r[i->a]); break;
+			case SIN:	r[i->dst] = sin(r[i->a]); break;
+			case ACOS:	r[i->dst] = acos(r[i->a]); break;
+			}
+		}
+	}
+
+	// Evaluate `n` points, with `in` holding `getNumInputs()` and `out`
+	// `getNumOutputs()` arrays of `n` values each.
+	void evaluateBatch(size_t n, const S *in, S *out, SimdLevel simd = SIMD_AUTO) const {
+		ChunkFunction evaluateChunk = getChunkFunction(simd, (const S*)nullptr);
+		if(!evaluateChunk)
+			throw std::invalid_argument("Bytecode: instruction set not supported");
+
+		static thread_local std::vector<S> registers;
+		if(registers.size() < mNumRegisters*batchLanes)
+			registers.resize(mNumRegisters*batchLanes);
+
+		for (size_t base = 0; base < n; base += batchLanes) {
+			evaluateChunk(*this, n, in, out, base, std::min(batchLanes, n - base), registers.data());
+		}
+	}
+
+	// Whether `evaluateBatch` can run with `simd` on this CPU.
+	static bool isSupported(SimdLevel simd) {
+		return getChunkFunction(simd, (const S*)nullptr) != nullptr;
+	}
+
+	// number of points every instruction of a batch works on
+	static const size_t batchLanes = 32;
+
+	size_t getNumInputs() const { return mNumInputs; }
+	size_t getNumOutputs() const { return mNumOutputs; }
+	size_t getNumRegisters() const { return mNumRegisters; }
+
+	const std::vector<Instruction> &getInstructions() const { return mInstructions; }
+	const std::vector<S> &getConstants() const { return mConstants; }
+
+private:
+	typedef void (*ChunkFunction)(const Bytecode<S> &, size_t, const S *, S *, size_t, size_t, S *);
+
+	template<class T>
+	static ChunkFunction getChunkFunction(SimdLevel simd, const T *) {
+		return (simd == SIMD_AUTO || simd == SIMD_SCALAR) ? &evaluateChunk<S> : nullptr;
+	}
+
+	static ChunkFunction getChunkFunction(SimdLevel simd, const double *) {
+#ifdef AUTOGEN_SIMD_X86
+		bool avx512 = __builtin_cpu_supports("avx512f");
+		bool avx2 = __builtin_cpu_supports("avx2");
+		if((simd == SIMD_AUTO || simd == SIMD_AVX512) && avx512)
+			return &evaluateChunkAvx512;
+		if((simd == SIMD_AUTO || simd == SIMD_AVX2) && avx2)
+			return &evaluateChunkAvx2;
+#endif
+		return (simd == SIMD_AUTO || simd == SIMD_SCALAR) ? &evaluateChunk<S> : nullptr;
+	}
+
+#ifdef AUTOGEN_SIMD_X86
+	typedef double Vec4d __attribute__((vector_size(32)));
+	typedef double Vec8d __attribute__((vector_size(64)));
+
+	__attribute__((target("avx2")))
+	static void evaluateChunkAvx2(const Bytecode<S> &code, size_t n, const S *in, S *out, size_t base, size_t count, S *registers) {
+		evaluateChunk<Vec4d>(code, n, in, out, base, count, registers);
+	}
+
+	__attribute__((target("avx512f")))
+	static void evaluateChunkAvx512(const Bytecode<S> &code, size_t n, const S *in, S *out, size_t base, size_t count, S *registers) {
+		evaluateChunk<Vec8d>(code, n, in, out, base, count, registers);
+	}
+#endif
+
+	// Evaluate the points [base, base + count) of a batch of `n` points, with
+	// vectors of type V for the basic arithmetic. Every register holds a row of
+	// `batchLanes` values, unused lanes are zero.
+	template<class V>
+	AUTOGEN_ALWAYS_INLINE static void evaluateChunk(const Bytecode<S> &code, size_t n, const S *in, S *out, size_t base, size_t count, S *registers) {
+		using std::pow; using std::sqrt; using std::cos; using std::sin; using std::acos;
+
+		const size_t L = batchLanes;
+		const size_t W = sizeof(V) / sizeof(S);
+
+// r[dst] = expression of the vectors x and y for all lanes
+#define AUTOGEN_LANES(expression) \
+		for (size_t k = 0; k < L; k += W) { \
+			V x, y; \
+			std::memcpy(&x, a + k, sizeof(V)); \
+			std::memcpy(&y, b + k, sizeof(V)); \
+			x = expression; \
+			std::memcpy(d + k, &x, sizeof(V)); \
+		}
+
+		const S *constants = code.mConstants.data();
+		const Instruction *end = code.mInstructions.data() + code.mInstructions.size();
+		for (const Instruction *i = code.mInstructions.data(); i != end; ++i) {
+			S *d = registers + i->dst*L;
+			const S *a = registers + i->a*L;
+			const S *b = registers + i->b*L;
+			switch (i->op) {
+			case LOAD:
+				a = in + i->a*n + base;
+				std::copy(a, a + count, d);
+				std::fill(d + count, d + L, S(0));
+				break;
+			case CONST:
+				std::fill(d, d + L, constants[i->a]);
+				break;
+			case STORE:
+				std::copy(a, a + count, out + i->dst*n + base);
+				break;
+			case NEG:	AUTOGEN_LANES(-x); break;
+			case ADD:	AUTOGEN_LANES(x + y); break;
+			case SUB:	AUTOGEN_LANES(x - y); break;
+			case MUL:	AUTOGEN_LANES(x * y); break;
+			case DIV:	AUTOGEN_LANES(x / y); break;
+			case POW:	for (size_t k = 0; k < L; ++k) d[k] = pow(a[k], b[k]); break;
+			case SQRT:	for (size_t k = 0; k < L; ++k) d[k] = sqrt(a[k]); break;
+			case COS:	for (size_t k = 0; k < L; ++k) d[k] = cos(a[k]); break;
+			case SIN:	for (size_t k = 0; k < L; ++k) d[k] = sin(a[k]); break;
+			case ACOS:	for (size_t k = 0; k < L; ++k) d[k] = acos(a[k]); break;
+			}
+		}
+
+#undef AUTOGEN_LANES
+	}
+
+	typedef std::unordered_map<std::string, uint32_t> Slots;
+
+	static Slots makeSlots(const std::vector<std::string> &names) {
+		Slots slots;
+		for (size_t i = 0; i < names.size(); ++i) {
+			slots[names[i]] = i;
+		}
+		return slots;
+	}
+
+	static Slots deriveSlots(const std::vector<std::string> &names) {
+		Slots slots;
+		std::vector<bool> used;
+		for (const std::string &name : names) {
+			long index = parseIndex(name);
+			if(index < 0 || (index < (long)used.size() && used[index]))
+				return makeSlots(names);
+			if(index >= (long)used.size())
+				used.resize(index + 1, false);
+			used[index] = true;
+			slots[name] = index;
+		}
+		return slots;
+	}
+
+	// the index of a name like `x[3]` or `grad(3)`, or -1
+	static long parseIndex(const std::string &name) {
+		if(name.size() < 3)
+			return -1;
+		char close = name.back();
+		char open = (close == ']') ? '[' : (close == ')') ? '(' : 0;
+		size_t pos = name.rfind(open);
+		if(open == 0 || pos == std::string::npos || pos + 2 >= name.size())
+			return -1;
+		for (size_t i = pos + 1; i + 1 < name.size(); ++i) {
+			if(name[i] < '0' || name[i] > '9')
+				return -1;
+		}
+		return std::strtol(name.c_str() + pos + 1, nullptr, 10);
+	}
+
+	static uint32_t getSlot(const Slots &slots, const std::string &name, size_t &numSlots) {
+		typename Slots::const_iterator it = slots.find(name);
+		if(it == slots.end())
+			throw std::invalid_argument("Bytecode: no slot for '" + name + "'");
+		numSlots = std::max<size_t>(numSlots, it->second + 1);
+		return it->second;
+	}
+
+	static OpCode getOpCode(NodeOp op) {
+		switch (op) {
+		case NEG_OP: return NEG;
+		case ADD_OP: return ADD;
+		case SUB_OP: return SUB;
+		case MUL_OP: return MUL;
+		case DIV_OP: return DIV;
+		case POW_OP: return POW;
+		case SQRT_OP: return SQRT;
+		case COS_OP: return COS;
+		case SIN_OP: return SIN;
+		case ACOS_OP: return ACOS;
+		default: throw std::logic_error("Bytecode: unsupported node");
+		}
+	}
+
+	// Emit `op` over the registers `operands[begin, end)` as a balanced tree
+	// and return the register of the result. Registers of intermediate
+	// results are added to `temporaries` and only reused after the node.
+	uint32_t reduce(OpCode op, const std::vector<uint32_t> &operands, size_t begin, size_t end, std::vector<uint32_t> &freeRegs, std::vector<uint32_t> &temporaries) {
+		if(end - begin == 1)
+			return operands[begin];
+		size_t middle = (begin + end + 1) / 2;
+		Instruction instruction;
+		instruction.op = op;
+		instruction.a = reduce(op, operands, begin, middle, freeRegs, temporaries);
+		instruction.b = reduce(op, operands, middle, end, freeRegs, temporaries);
+		if(freeRegs.empty()) {
+			instruction.dst = mNumRegisters++;
+		}
+		else {
+			instruction.dst = freeRegs.back();
+			freeRegs.pop_back();
+		}
+		mInstructions.push_back(instruction);
+		temporaries.push_back(instruction.dst);
+		return instruction.dst;
+	}
+
+	Bytecode(const CodeGenerator<S> &generator, const Slots &inputs, const Slots &outputs) {
+		const size_t numNodes = generator.getNumNodes();
+		const uint32_t none = uint32_t(-1);
+
+		// position of the last node using the value of a node
+		std::vector<uint32_t> lastUse(numNodes, none);
+		for (size_t i = 0; i < numNodes; ++i) {
+			const Node<S>* node = generator.getNode(i);
+			for (size_t c = 0; c < node->getNumChildren(); ++c) {
+				lastUse[generator.getVar(node->getChild(c)).getIndex()] = i;
+			}
+		}
+
+		// assign a register to every value, reusing registers of dead values
+		std::vector<uint32_t> reg(numNodes, none);
+		std::vector<uint32_t> freeRegs;
+		mInstructions.reserve(numNodes);
+		for (size_t i = 0; i < numNodes; ++i) {
+			const Node<S>* node = generator.getNode(i);
+			Instruction instruction;
+			instruction.a = instruction.b = 0;
+			if(node->getOp() == SUM_OP || node->getOp() == PRODUCT_OP) {
+				// balanced tree of binary instructions like the generated code,
+				// the last one is the instruction of this node
+				std::vector<uint32_t> operands;
+				for (size_t c = 0; c < node->getNumChildren(); ++c) {
+					operands.push_back(reg[generator.getVar(node->getChild(c)).getIndex()]);
+				}
+				OpCode op = (node->getOp() == SUM_OP) ? ADD : MUL;
+				size_t middle = (operands.size() + 1) / 2;
+				std::vector<uint32_t> temporaries;
+				instruction.a = reduce(op, operands, 0, middle, freeRegs, temporaries);
+				instruction.b = reduce(op, operands, middle, operands.size(), freeRegs, temporaries);
+				freeRegs.insert(freeRegs.end(), temporaries.begin(), temporaries.end());
+			}
+			else {
+				for (size_t c = 0; c < node->getNumChildren() && c < 2; ++c) {
+					uint32_t child = generator.getVar(node->getChild(c)).getIndex();
+					(c == 0 ? instruction.a : instruction.b) = reg[child];
+				}
+			}
+			for (size_t c = 0; c < node->getNumChildren(); ++c) {
+				uint32_t child = generator.getVar(node->getChild(c)).getIndex();
+				if(lastUse[child] == i && reg[child] != none) {
+					freeRegs.push_back(reg[child]);
+					reg[child] = none;
+				}
+			}
+
+			switch (node->getOp()) {
+			case RESULT_OP:
+				instruction.op = STORE;
+				instruction.dst = getSlot(outputs, static_cast<const NodeResult<S>*>(node)->getResVarName(), mNumOutputs);
+				mInstructions.push_back(instruction);
+				continue;
+			case VAR_OP:
+				instruction.op = LOAD;
+				instruction.a = getSlot(inputs, static_cast<const NodeVar<S>*>(node)->getVarName(), mNumInputs);
+				break;
+			case CONST_OP:
+				instruction.op = CONST;
+				instruction.a = mConstants.size();
+				mConstants.push_back(static_cast<const NodeConst<S>*>(node)->getValue());
+				break;
+			case SUM_OP:
+				instruction.op = ADD;
+				break;
+			case PRODUCT_OP:
+				instruction.op = MUL;
+				break;
+			default:
+				instruction.op = getOpCode(node->getOp());
+				break;
+			}
+
+			if(freeRegs.empty()) {
+				instruction.dst = mNumRegisters++;
+			}
+			else {
+				instruction.dst = freeRegs.back();
+				freeRegs.pop_back();
+			}
+			mInstructions.push_back(instruction);
+
+			if(lastUse[i] == none)
+				freeRegs.push_back(instruction.dst);
+			else
+				reg[i] = instruction.dst;
+		}
+	}
+
+private:
+	std::vector<Instruction> mInstructions;
+	std::vector<S> mConstants;
+	size_t mNumInputs = 0;
+	size_t mNumOutputs = 0;
+	size_t mNumRegisters = 0;
+};
+
+template<class S>
+const size_t Bytecode<S>::batchLanes;
+
+} // namespace AutoGen
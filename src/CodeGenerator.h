@@ -1,23 +1,27 @@
 #pragma once
 
 #include "Node.h"
+#include "Tape.h"
+#include "FlatHashTable.h"
 
 #include <iostream>
 #include <memory>
-#include <map>
 #include <string>
 #include <vector>
 
 #include <ostream>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <typeinfo>
 #include <experimental/filesystem>
 #include <cmath>
 #include <math.h>
 #include <cassert>
+#include <cctype>
 
 #include <algorithm>
+#include <functional>
 
 #include <Eigen/Eigen>
 
@@ -40,156 +44,639 @@ public:
 
 	void setIndex(int index) {mVarIndex = index; }
 
+	int getIndex() const { return mVarIndex; }
+
 private:
 	int mVarIndex;
 };
 
+inline std::ostream &operator<<(std::ostream &os, const VarDef &var) {
+	return os << 'v' << var.getIndex();
+}
+
+// A function split into parts, written by `CodeGenerator::generateSplitCode`.
+// Every part and the function itself can be compiled as its own translation
+// unit, all of them need `header`.
+struct SplitCode
+{
+	std::string header;				// state struct and declarations of the parts
+	std::vector<std::string> parts;	// definitions of the parts
+	std::string function;			// definition of the function, calls the parts
+
+	// one translation unit per part, the function is the last one
+	std::vector<std::string> getUnits(const std::string &includes = "#include <cmath>\n") const {
+		std::vector<std::string> units;
+		for (const std::string &part : parts) {
+			units.push_back(includes + "\n" + header + "\n" + part);
+		}
+		units.push_back(includes + "\n" + header + "\n" + function);
+		return units;
+	}
+
+	// everything as one translation unit
+	std::string getCode(const std::string &includes = "#include <cmath>\n") const {
+		std::string code = includes + "\n" + header;
+		for (const std::string &part : parts) {
+			code += "\n" + part;
+		}
+		return code + "\n" + function;
+	}
+
+	// Write `<name>.h` with the header, `<name>_part<i>.cpp` for every part
+	// and `<name>.cpp` with the function to `directory`.
+	void writeFiles(const std::string &directory, const std::string &name, const std::string &includes = "#include <cmath>\n") const {
+		std::ofstream headerFile(directory + "/" + name + ".h");
+		headerFile << "#pragma once\n\n" << includes << "\n" << header;
+		for (size_t i = 0; i < parts.size(); ++i) {
+			std::ofstream partFile(directory + "/" + name + "_part" + std::to_string(i) + ".cpp");
+			partFile << "#include \"" << name << ".h\"\n\n" << parts[i];
+		}
+		std::ofstream functionFile(directory + "/" + name + ".cpp");
+		functionFile << "#include \"" << name << ".h\"\n\n" << function;
+	}
+};
+
+// Orders of `CodeGenerator::sortNodes`
+enum NodeOrder {
+	// depth first from every node in the current order, inputs first and
+	// results last
+	DEPTH_FIRST_ORDER,
+	// keeps few values live at a time: depth first from every result, the
+	// child needing more variables first (Sethi-Ullman), inputs are read
+	// where needed and results are written as soon as they are known
+	MIN_LIVE_ORDER
+};
+
 template<class S>
 class CodeGenerator
 {
 public:
 	CodeGenerator() {}
 
-	void addNode(const Node<S>* node) {
-
-		// check if we have the same hashed node already
-		uint64_t hash = node->getHash();
-		assert(mHashedNodes.find(hash) == mHashedNodes.end());
-
-		mNodes.push_back(hash);
-		mHashedNodes[hash] = std::make_pair(node, VarDef());
-	}
-
 	const VarDef& getVar(const Node<S>* node) const {
 		assert(node);
 
-		uint64_t h = node->getHash();
-		auto it = mHashedNodes.find(h);
-		assert(it != mHashedNodes.end());
-		return it->second.second;
+		const Entry *entry = findEntry(node);
+		assert(entry);
+		return entry->var;
 	}
 
 	const std::string &getVarTypeName() const { return mVarTypeName; }
 
-	const Node<S>* getHashedNode(uint64_t nodeHash) const {
-		auto it = mHashedNodes.find(nodeHash);
-		if(it != mHashedNodes.end())
-			return it->second.first;
+	// Return the collected node that computes the same value as `node`, or
+	// nullptr if `node` was not collected.
+	const Node<S>* getHashedNode(const Node<S>* node) const {
+		const Entry *entry = findEntry(node);
+		if(entry)
+			return entry->node;
 		else
 			return nullptr;
 	}
 
-	const Node<S>* getHashedNode(const Node<S>* node) const {
-		return getHashedNode(node->getHash());
+	void collectNodes(const Node<S>* rootNode) {
+		if(findIndex(rootNode) >= 0)
+			return;
+
+		// depth first, a node is added once all its children are added
+		std::vector<std::pair<const Node<S>*, size_t>> stack; // node, next child
+		stack.push_back(std::make_pair(rootNode, size_t(0)));
+		while(!stack.empty()) {
+			const Node<S>* node = stack.back().first;
+			if(stack.back().second < node->getNumChildren()) {
+				const Node<S>* child = node->getChild(stack.back().second++);
+				if(findIndex(child) < 0)
+					stack.push_back(std::make_pair(child, size_t(0)));
+			}
+			else {
+				addNode(node);
+				stack.pop_back();
+			}
+		}
 	}
 
-	void collectNodes(const Node<S>* rootNode) {
+	size_t getNumNodes() const { return mNodes.size(); }
+
+	// The i-th collected node, in sorted order after `sortNodes`.
+	const Node<S>* getNode(size_t i) const { return mEntries[mNodes[i]].node; }
+
+	// Order the nodes such that every node comes after its children, see
+	// `NodeOrder`. The variable of a node is numbered by its position.
+	void sortNodes(NodeOrder order = DEPTH_FIRST_ORDER){
+
+		if(order == MIN_LIVE_ORDER) {
+			sortNodesMinLive();
+			return;
+		}
 
-		// this is where we store all nodes that we still need to visit
-		std::vector<const Node<S>*> nodesToVisit;
+		// topological sort, depth first from every node in the current order
+		std::vector<uint32_t> nodesNew;
+		nodesNew.reserve(mNodes.size());
+		std::vector<bool> visited(mEntries.size(), false);
+		for (size_t i = 0; i < mNodes.size(); ++i) {
+			addDepthFirst(mNodes[i], visited, nodesNew);
+		}
 
-		// node we are currently visiting
-		const Node<S>* nodeVisiting = rootNode;
+		// move input/output nodes to front/back, keeping their order
+		std::vector<uint32_t> nodesIn, nodesOut;
+		mNodes.clear();
+		for (uint32_t index : nodesNew) {
+			NodeType type = mEntries[index].node->getNodeType();
+			if(type == INPUT_NODE) nodesIn.push_back(index);
+			else if(type == OUTPUT_NODE) nodesOut.push_back(index);
+			else mNodes.push_back(index);
+		}
+		mNodes.insert(mNodes.begin(), nodesIn.begin(), nodesIn.end());
+		mNodes.insert(mNodes.end(), nodesOut.begin(), nodesOut.end());
 
-		// go through graph and visit nodes
-		while (true) {
-			// does the generator already have a same-hashed node?
-			const Node<S>* hashedNode = getHashedNode(nodeVisiting);
-			// if not, let's add it and remember to visit children
-			if(hashedNode == nullptr) {
+		updateVarIndices();
+	}
 
-				addNode(nodeVisiting);
-				for (size_t i = 0; i < nodeVisiting->getNumChildren(); ++i) {
-					nodesToVisit.push_back(nodeVisiting->getChild(i).get());
+	// The largest number of values that are live at the same time in the
+	// current order, i.e. the number of variables with `setReuseVariables`.
+	// A value can take the variable of a child used for the last time.
+	size_t getMaxLive() const {
+		const uint32_t none = uint32_t(-1);
+		std::vector<uint32_t> lastUse = getLastUses();
+		size_t live = 0, maxLive = 0;
+		for (size_t i = 0; i < mNodes.size(); ++i) {
+			const Entry &entry = mEntries[mNodes[i]];
+			for (uint32_t k = 0; k < entry.numChildren; ++k) {
+				uint32_t child = mChildren[entry.firstChild + k];
+				if(lastUse[child] == i) {
+					live--;
+					lastUse[child] = none;
 				}
 			}
-			else {
-//				std::cout << "node already in!\n";
-			}
-
-			// let's go to next node
-			if(nodesToVisit.size() == 0) break;
-			nodeVisiting = nodesToVisit.front();
-			nodesToVisit.erase(nodesToVisit.begin());
+			if(entry.node->getNodeType() == OUTPUT_NODE)
+				continue;
+			maxLive = std::max(maxLive, ++live);
+			if(lastUse[mNodes[i]] == none)
+				live--;
 		}
+		return maxLive;
 	}
 
-	void sortNodes(){
+	// Let `generateCode` reuse the variables of values that are not used
+	// anymore, e.g. `v3 = v7 * v2;` after `double v3 = ...` was last used.
+	// Code for some of the nodes (`generateCode(os, roots)`,
+	// `generateSplitCode`) always has one variable per node.
+	void setReuseVariables(bool reuse) { mReuseVariables = reuse; }
+
+	bool isReuseVariables() const { return mReuseVariables; }
+
+	// Write the code of all nodes to `os`, line by line.
+	void generateCode(std::ostream &os, const std::string &beforeEveryLine = "") {
+
+		if(mReuseVariables)
+			assignReusedVariables();
+		else
+			updateVarIndices();
 
-		// topological sort
-		std::vector<uint64_t> nodesNew;
-//		for (auto h : mNodes) {
+		// write code
 		for (size_t i = 0; i < mNodes.size(); ++i) {
-			uint64_t h = mNodes[i];
-			const Node<S>* node = mHashedNodes[h].first;
-			assert(node != nullptr);
-			addChildrenTo(node, nodesNew);
+			os << beforeEveryLine;
+			mEntries[mNodes[i]].node->generateCode(os, *this);
+			os << ";\n";
 		}
 
-		// move input/output nodes to front/back
-		std::vector<int> nodesIn, nodesOut;
-		for (size_t i = 0; i < nodesNew.size(); ++i) {
-			uint64_t h = nodesNew[i];
-			const Node<S>* node = mHashedNodes[h].first;
-			if(node->getNodeType() == INPUT_NODE) nodesIn.push_back(i);
-			else if(node->getNodeType() == OUTPUT_NODE) nodesOut.push_back(i);
-		}
+		// the variable of a node is its position again
+		updateVarIndices();
+	}
 
-		std::vector<uint64_t> nodesNew2;
-		for (int i : nodesIn) {
-			nodesNew2.push_back(nodesNew[i]);
+	std::string generateCode(const std::string &beforeEveryLine = "") {
+		std::ostringstream os;
+		generateCode(os, beforeEveryLine);
+		return os.str();
+	}
+
+	// Write only the code needed for the collected nodes `roots`, in the
+	// current order.
+	void generateCode(std::ostream &os, const std::vector<const Node<S>*> &roots, const std::string &beforeEveryLine = "") {
+
+		updateVarIndices();
+
+		// mark the entries the roots depend on
+		std::vector<bool> isNeeded(mEntries.size(), false);
+		std::vector<uint32_t> stack;
+		for (const Node<S>* root : roots) {
+			int64_t index = findIndex(root);
+			assert(index >= 0);
+			if(!isNeeded[index]) {
+				isNeeded[index] = true;
+				stack.push_back(index);
+			}
+		}
+		while(!stack.empty()) {
+			const Entry &entry = mEntries[stack.back()];
+			stack.pop_back();
+			for (uint32_t i = 0; i < entry.numChildren; ++i) {
+				uint32_t child = mChildren[entry.firstChild + i];
+				if(!isNeeded[child]) {
+					isNeeded[child] = true;
+					stack.push_back(child);
+				}
+			}
 		}
 
-		for (size_t i = 0; i < nodesNew.size(); ++i) {
-			if(std::find(nodesIn.begin(), nodesIn.end(), i) != nodesIn.end())
-				continue;
-			if(std::find(nodesOut.begin(), nodesOut.end(), i) != nodesOut.end())
+		// write code
+		for (size_t i = 0; i < mNodes.size(); ++i) {
+			if(!isNeeded[mNodes[i]])
 				continue;
-			nodesNew2.push_back(nodesNew[i]);
+			os << beforeEveryLine;
+			mEntries[mNodes[i]].node->generateCode(os, *this);
+			os << ";\n";
+		}
+	}
+
+	// Write the code of all nodes as the function `signature`, e.g.
+	// `extern "C" void compute_extern(double* x, double* y)`, split into parts
+	// of at most `maxNodesPerPart` nodes in the current order. Compilers take
+	// superlinear time and memory in the size of a function, the parts can be
+	// compiled separately and in parallel. Values used across a cut are
+	// passed through the struct `<name>_State`.
+	SplitCode generateSplitCode(const std::string &signature, size_t maxNodesPerPart) {
+		assert(maxNodesPerPart > 0);
+		updateVarIndices();
+
+		// name and arguments of the function
+		size_t open = signature.find('(');
+		size_t close = signature.rfind(')');
+		assert(open != std::string::npos && close != std::string::npos && open < close);
+		size_t nameEnd = signature.find_last_not_of(" \t", open - 1) + 1;
+		size_t nameBegin = nameEnd;
+		while(nameBegin > 0 && isIdentifier(signature[nameBegin-1]))
+			nameBegin--;
+		std::string name = signature.substr(nameBegin, nameEnd - nameBegin);
+		std::string arguments = signature.substr(open + 1, close - open - 1);
+		std::string callArguments = getArgumentNames(arguments);
+		if(arguments.find_first_not_of(" \t") != std::string::npos) {
+			arguments += ", ";
+			callArguments += ", ";
+		}
+
+		// the values every part uses from earlier parts
+		const size_t numParts = (mNodes.size() + maxNodesPerPart - 1) / maxNodesPerPart;
+		std::vector<size_t> partOf(mEntries.size());
+		for (size_t i = 0; i < mNodes.size(); ++i) {
+			partOf[mNodes[i]] = i / maxNodesPerPart;
+		}
+		std::vector<std::vector<uint32_t>> imports(numParts);
+		std::vector<bool> isExported(mEntries.size(), false);
+		std::vector<size_t> importedBy(mEntries.size(), size_t(-1));
+		for (size_t i = 0; i < mNodes.size(); ++i) {
+			const Entry &entry = mEntries[mNodes[i]];
+			const size_t part = i / maxNodesPerPart;
+			for (uint32_t k = 0; k < entry.numChildren; ++k) {
+				uint32_t child = mChildren[entry.firstChild + k];
+				if(partOf[child] == part || importedBy[child] == part)
+					continue;
+				importedBy[child] = part;
+				isExported[child] = true;
+				imports[part].push_back(child);
+			}
 		}
 
-		for (int i : nodesOut) {
-			nodesNew2.push_back(nodesNew[i]);
+		SplitCode code;
+		std::ostringstream header;
+		header << "struct " << name << "_State {\n";
+		for (size_t i = 0; i < mNodes.size(); ++i) {
+			if(isExported[mNodes[i]])
+				header << "\t" << mVarTypeName << " " << mEntries[mNodes[i]].var << ";\n";
+		}
+		header << "};\n\n";
+
+		std::ostringstream function;
+		function << signature << " {\n";
+		function << "\t" << name << "_State state;\n";
+
+		for (size_t part = 0; part < numParts; ++part) {
+			std::string partSignature = "void " + name + "_part" + std::to_string(part) + "(" + arguments + name + "_State &state)";
+			header << partSignature << ";\n";
+			function << "\t" << name << "_part" << part << "(" << callArguments << "state);\n";
+
+			std::ostringstream os;
+			os << partSignature << " {\n";
+			std::sort(imports[part].begin(), imports[part].end(), [this](uint32_t a, uint32_t b) {
+				return mEntries[a].var.getIndex() < mEntries[b].var.getIndex();
+			});
+			for (uint32_t index : imports[part]) {
+				const VarDef &var = mEntries[index].var;
+				os << "\tconst " << mVarTypeName << " " << var << " = state." << var << ";\n";
+			}
+			const size_t end = std::min(mNodes.size(), (part + 1)*maxNodesPerPart);
+			for (size_t i = part*maxNodesPerPart; i < end; ++i) {
+				os << "\t";
+				mEntries[mNodes[i]].node->generateCode(os, *this);
+				os << ";\n";
+			}
+			for (size_t i = part*maxNodesPerPart; i < end; ++i) {
+				if(isExported[mNodes[i]])
+					os << "\tstate." << mEntries[mNodes[i]].var << " = " << mEntries[mNodes[i]].var << ";\n";
+			}
+			os << "}\n";
+			code.parts.push_back(os.str());
 		}
+		function << "}\n";
 
-		mNodes = nodesNew2;
+		code.header = header.str();
+		code.function = function.str();
+		return code;
+	}
+
+	// Write the left hand side of the definition of `node`, e.g. `double v3 = `
+	void writeDefinition(std::ostream &os, const Node<S>* node) const {
+		const Entry *entry = findEntry(node);
+		assert(entry);
+		if(!entry->isReused)
+			os << mVarTypeName << " ";
+		os << entry->var << " = ";
 	}
 
-    std::string generateCode(std::string beforeEveryLine = "") {
+private:
+	static bool isIdentifier(char c) {
+		return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+	}
 
-		// update variable index
-		int counter = 0;
+	// "const double *x, double y[3]" -> "x, y"
+	static std::string getArgumentNames(const std::string &arguments) {
+		std::string names;
+		std::istringstream is(arguments);
+		std::string argument;
+		while(std::getline(is, argument, ',')) {
+			size_t end = argument.find('[');
+			end = argument.find_last_not_of(" \t\n", end == std::string::npos ? end : end - 1);
+			if(end == std::string::npos)
+				continue;
+			size_t begin = end + 1;
+			while(begin > 0 && isIdentifier(argument[begin-1]))
+				begin--;
+			names += (names.empty() ? "" : ", ") + argument.substr(begin, end + 1 - begin);
+		}
+		return names;
+	}
+
+	// the variable of a node is numbered by its position in the current order
+	void updateVarIndices() {
 		for (size_t i = 0; i < mNodes.size(); ++i) {
-			mHashedNodes[mNodes[i]].second.setIndex(counter++);
+			mEntries[mNodes[i]].var.setIndex(i);
+			mEntries[mNodes[i]].isReused = false;
 		}
+	}
 
-		// write code
-		std::string code;
+	// position of the last node using the value of every entry, or -1
+	std::vector<uint32_t> getLastUses() const {
+		std::vector<uint32_t> lastUse(mEntries.size(), uint32_t(-1));
 		for (size_t i = 0; i < mNodes.size(); ++i) {
-            code += beforeEveryLine + mHashedNodes[mNodes[i]].first->generateCode(*this) + ";\n";
+			const Entry &entry = mEntries[mNodes[i]];
+			for (uint32_t k = 0; k < entry.numChildren; ++k) {
+				lastUse[mChildren[entry.firstChild + k]] = i;
+			}
 		}
+		return lastUse;
+	}
 
-		return code;
+	// number the variables such that a value takes the variable of a value
+	// that was used for the last time, like registers
+	void assignReusedVariables() {
+		const uint32_t none = uint32_t(-1);
+		std::vector<uint32_t> lastUse = getLastUses();
+		std::vector<int> freeVars;
+		int numVars = 0;
+		for (size_t i = 0; i < mNodes.size(); ++i) {
+			Entry &entry = mEntries[mNodes[i]];
+			for (uint32_t k = 0; k < entry.numChildren; ++k) {
+				uint32_t child = mChildren[entry.firstChild + k];
+				if(lastUse[child] == i) {
+					freeVars.push_back(mEntries[child].var.getIndex());
+					lastUse[child] = none; // free a child used twice only once
+				}
+			}
+			if(entry.node->getNodeType() == OUTPUT_NODE)
+				continue;
+
+			entry.isReused = !freeVars.empty();
+			if(freeVars.empty()) {
+				entry.var.setIndex(numVars++);
+			}
+			else {
+				entry.var.setIndex(freeVars.back());
+				freeVars.pop_back();
+			}
+			if(lastUse[mNodes[i]] == none)
+				freeVars.push_back(entry.var.getIndex());
+		}
 	}
 
-private:
-	void addChildrenTo(const Node<S>* node, std::vector<uint64_t> &nodesNew) const {
-		// is this node already in the new list?
-		uint64_t h = node->getHash();
-		if(std::find(nodesNew.begin(), nodesNew.end(), h) == nodesNew.end()) {
-			// first make sure children are added
-			for (size_t i = 0; i < node->getNumChildren(); ++i) {
-				addChildrenTo(node->getChild(i).get(), nodesNew);
+	// add `index` and the entries it depends on that are not visited yet to
+	// `nodes`, children first
+	void addDepthFirst(uint32_t index, std::vector<bool> &visited, std::vector<uint32_t> &nodes) const {
+		if(visited[index])
+			return;
+		visited[index] = true;
+		std::vector<std::pair<uint32_t, uint32_t>> stack; // entry, next child
+		stack.push_back(std::make_pair(index, 0u));
+		while(!stack.empty()) {
+			const Entry &entry = mEntries[stack.back().first];
+			if(stack.back().second < entry.numChildren) {
+				// first make sure children are added
+				uint32_t child = mChildren[entry.firstChild + stack.back().second++];
+				if(!visited[child]) {
+					visited[child] = true;
+					stack.push_back(std::make_pair(child, 0u));
+				}
+			}
+			else {
+				// and then add this node
+				nodes.push_back(stack.back().first);
+				stack.pop_back();
+			}
+		}
+	}
+
+	void sortNodesMinLive() {
+		// Sethi-Ullman number of every entry: the variables needed to compute
+		// it, if children are computed in the order of decreasing numbers.
+		// Entries are added after their children, so children come first.
+		std::vector<uint32_t> need(mEntries.size());
+		std::vector<uint32_t> childNeeds;
+		for (size_t e = 0; e < mEntries.size(); ++e) {
+			const Entry &entry = mEntries[e];
+			childNeeds.clear();
+			for (uint32_t k = 0; k < entry.numChildren; ++k) {
+				childNeeds.push_back(need[mChildren[entry.firstChild + k]]);
 			}
-			// and then add this node
-			nodesNew.push_back(node->getHash());
+			std::sort(childNeeds.begin(), childNeeds.end(), std::greater<uint32_t>());
+			need[e] = 1;
+			for (size_t k = 0; k < childNeeds.size(); ++k) {
+				need[e] = std::max<uint32_t>(need[e], childNeeds[k] + k);
+			}
+		}
+
+		// depth first from every result, children with larger numbers first,
+		// then from all other nodes
+		struct Frame
+		{
+			uint32_t entry;
+			size_t begin, next; // children of the entry in `children`
+		};
+		std::vector<Frame> stack;
+		std::vector<uint32_t> children;
+		auto push = [&](uint32_t index) {
+			const Entry &entry = mEntries[index];
+			Frame frame;
+			frame.entry = index;
+			frame.begin = frame.next = children.size();
+			children.insert(children.end(), mChildren.begin() + entry.firstChild, mChildren.begin() + entry.firstChild + entry.numChildren);
+			std::stable_sort(children.begin() + frame.begin, children.end(), [&need](uint32_t a, uint32_t b) {
+				return need[a] > need[b];
+			});
+			stack.push_back(frame);
+		};
+
+		std::vector<uint32_t> nodesNew;
+		nodesNew.reserve(mNodes.size());
+		std::vector<bool> visited(mEntries.size(), false);
+		auto visit = [&](uint32_t root) {
+			if(visited[root])
+				return;
+			visited[root] = true;
+			push(root);
+			while(!stack.empty()) {
+				Frame &frame = stack.back();
+				if(frame.next < children.size()) {
+					uint32_t child = children[frame.next++];
+					if(!visited[child]) {
+						visited[child] = true;
+						push(child);
+					}
+				}
+				else {
+					nodesNew.push_back(frame.entry);
+					children.resize(frame.begin);
+					stack.pop_back();
+				}
+			}
+		};
+		for (uint32_t index : mNodes) {
+			if(mEntries[index].node->getNodeType() == OUTPUT_NODE)
+				visit(index);
 		}
+		for (uint32_t index : mNodes) {
+			visit(index);
+		}
+
+		mNodes.swap(nodesNew);
+		updateVarIndices();
+	}
+
+	// A unique node of the graph. Structurally equal nodes share one entry,
+	// which is identified by its op, its payload and the entries of its
+	// children.
+	struct Entry
+	{
+		const Node<S>* node;
+		VarDef var;
+		uint32_t firstChild;
+		uint32_t numChildren;
+		bool isReused;	// the variable was defined by an earlier node
+	};
+
+	// index of the entry of a visited node, or -1
+	int64_t findIndex(const Node<S>* node) const {
+		uint32_t index = mVisited.find(node);
+		if(index != NodeIndex<S>::none)
+			return index;
+		return -1;
+	}
+
+	const Entry* findEntry(const Node<S>* node) const {
+		int64_t index = findIndex(node);
+		if(index >= 0)
+			return &mEntries[index];
+		return nullptr;
+	}
+
+	// hash of a node given the entries of its children, the order of the
+	// children does not matter for commutative nodes
+	uint64_t hashEntry(const Node<S>* node, uint32_t firstChild, uint32_t numChildren) const {
+		uint64_t hash = Node<S>::mix(node->getOp() ^ node->getPayloadHash());
+		uint64_t hashChildren = 0;
+		for (uint32_t i = 0; i < numChildren; ++i) {
+			uint64_t child = mChildren[firstChild + i];
+			if(node->isCommutative())
+				hashChildren += Node<S>::mix(child);
+			else
+				hashChildren = Node<S>::mix(hashChildren ^ child) + i;
+		}
+		return Node<S>::mix(hash ^ hashChildren);
+	}
+
+	bool isChildrenEqual(const Node<S>* node, uint32_t firstA, uint32_t firstB, uint32_t numChildren) const {
+		const uint32_t *childrenA = mChildren.data() + firstA;
+		const uint32_t *childrenB = mChildren.data() + firstB;
+		if(std::equal(childrenA, childrenA + numChildren, childrenB))
+			return true;
+		if(!node->isCommutative())
+			return false;
+		std::vector<uint32_t> a(childrenA, childrenA + numChildren);
+		std::vector<uint32_t> b(childrenB, childrenB + numChildren);
+		std::sort(a.begin(), a.end());
+		std::sort(b.begin(), b.end());
+		return a == b;
+	}
+
+	// Add a node whose children were all added already. Returns the index of
+	// its entry.
+	uint32_t addNode(const Node<S>* node) {
+		uint32_t firstChild = mChildren.size();
+		uint32_t numChildren = node->getNumChildren();
+		for (uint32_t i = 0; i < numChildren; ++i) {
+			mChildren.push_back(findIndex(node->getChild(i)));
+		}
+		uint64_t hash = hashEntry(node, firstChild, numChildren);
+
+		// does the generator already have a structurally equal node?
+		const uint32_t *same = mUnique.find(hash, [this, node, firstChild, numChildren](uint32_t e) {
+			const Entry &entry = mEntries[e];
+			if(entry.node->getOp() != node->getOp() || entry.numChildren != numChildren)
+				return false;
+			if(!isChildrenEqual(node, entry.firstChild, firstChild, numChildren))
+				return false;
+			return entry.node->isPayloadEqual(*node);
+		});
+
+		uint32_t index;
+		if(same) {
+			index = *same;
+			mChildren.resize(firstChild);
+		}
+		else {
+			// if not, let's add it
+			index = mEntries.size();
+			Entry entry;
+			entry.node = node;
+			entry.firstChild = firstChild;
+			entry.numChildren = node->getNumChildren();
+			entry.isReused = false;
+			mEntries.push_back(entry);
+			mUnique.insert(hash, index);
+			mNodes.push_back(index);
+		}
+
+		mVisited.insert(node, index);
+		return index;
 	}
 
 private:
+	// the collected nodes stay valid, see Tape.h
+	typename Tape<S>::Reference mTapeReference;
 	std::string mVarTypeName = "double";
-	std::vector<uint64_t> mNodes;
-	std::map<uint64_t, std::pair<const Node<S>*, VarDef>> mHashedNodes;
+	bool mReuseVariables = false;
+	std::vector<uint32_t> mNodes;
+	std::vector<Entry> mEntries;
+	std::vector<uint32_t> mChildren;
+	NodeIndex<S> mVisited;
+	FlatHashTable<uint32_t> mUnique;
 };
 
 }  // namespace AutoGen
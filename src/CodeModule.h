@@ -0,0 +1,162 @@
+#pragma once
+
+#include "CodeGenerator.h"
+#include "RecType.h"
+#include "Tape.h"
+
+#include <algorithm>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace AutoGen {
+
+/*
+ * CodeModule
+ * ==========
+ *
+ * Several named functions over the same inputs, recorded into one
+ * `CodeGenerator`. Subexpressions shared by the functions are deduplicated,
+ * every function is written as its own entry point with only the code it
+ * needs, and an additional entry point computes all outputs at once, each
+ * shared intermediate value only once:
+ * ```
+ * CodeModule<double> module;
+ * module.addFunction("R", "const double *v, double *R");
+ * module.addFunction("dR", "const double *v, double *dR");
+ * module.addOutput("R", "R[0]", R(0,0));
+ * module.addOutput("dR", "dR[0]", dR[0](0,0));
+ * module.writeModule(file, "R_and_dR"); // writes R, dR and R_and_dR
+ * ```
+ *
+ * The arguments of the "all outputs" entry point are the arguments of all
+ * functions, without duplicates. Output names have to be unique over all
+ * functions.
+ *
+ * The module records the result nodes of its outputs into a tape of its own.
+ * The values passed to `addOutput` are not copied: the tape they were
+ * recorded into has to outlive the module.
+ */
+template<class S>
+class CodeModule
+{
+public:
+	CodeModule() {
+	}
+
+	// Add an entry point `void name(arguments)`.
+	void addFunction(const std::string &name, const std::string &arguments) {
+		if(findFunction(name))
+			throw std::invalid_argument("CodeModule: function '" + name + "' already exists.");
+		Function function;
+		function.name = name;
+		function.arguments = arguments;
+		mFunctions.push_back(function);
+	}
+
+	// Let function `function` write `value` to `resultName`.
+	void addOutput(const std::string &function, const std::string &resultName, const RecType<S> &value) {
+		Function *f = findFunction(function);
+		if(!f)
+			throw std::invalid_argument("CodeModule: unknown function '" + function + "'.");
+
+		const Node<S>* result = mTape.template create<NodeResult<S>>(resultName, value.getNode());
+		mGenerator.collectNodes(result);
+		f->results.push_back(result);
+		mIsSorted = false;
+	}
+
+	size_t getNumFunctions() const { return mFunctions.size(); }
+
+	const std::string &getFunctionName(size_t i) const { return mFunctions[i].name; }
+
+	// The body of function `function`.
+	std::string generateCode(const std::string &function) {
+		Function *f = findFunction(function);
+		if(!f)
+			throw std::invalid_argument("CodeModule: unknown function '" + function + "'.");
+
+		sort();
+		std::ostringstream os;
+		mGenerator.generateCode(os, f->results);
+		return os.str();
+	}
+
+	// The body computing the outputs of all functions.
+	std::string generateCode() {
+		sort();
+		return mGenerator.generateCode();
+	}
+
+	// Write every function and the entry point `allName` for all outputs.
+	void writeModule(std::ostream &os, const std::string &allName) {
+		for (const Function &function : mFunctions) {
+			os << "void " << function.name << "(" << function.arguments << ") {\n";
+			os << generateCode(function.name);
+			os << "}\n\n";
+		}
+
+		os << "void " << allName << "(" << getAllArguments() << ") {\n";
+		os << generateCode();
+		os << "}\n";
+	}
+
+	// Arguments of all functions, without duplicates.
+	std::string getAllArguments() const {
+		std::vector<std::string> arguments;
+		for (const Function &function : mFunctions) {
+			std::istringstream is(function.arguments);
+			std::string argument;
+			while(std::getline(is, argument, ',')) {
+				// trim
+				size_t begin = argument.find_first_not_of(" \t\n");
+				size_t end = argument.find_last_not_of(" \t\n");
+				if(begin == std::string::npos)
+					continue;
+				argument = argument.substr(begin, end - begin + 1);
+				if(std::find(arguments.begin(), arguments.end(), argument) == arguments.end())
+					arguments.push_back(argument);
+			}
+		}
+
+		std::string result;
+		for (size_t i = 0; i < arguments.size(); ++i) {
+			result += ((i > 0) ? ", " : "") + arguments[i];
+		}
+		return result;
+	}
+
+	CodeGenerator<S> &getGenerator() { return mGenerator; }
+
+private:
+	struct Function
+	{
+		std::string name;
+		std::string arguments;
+		std::vector<const Node<S>*> results;
+	};
+
+	Function *findFunction(const std::string &name) {
+		for (Function &function : mFunctions) {
+			if(function.name == name)
+				return &function;
+		}
+		return nullptr;
+	}
+
+	void sort() {
+		if(!mIsSorted)
+			mGenerator.sortNodes();
+		mIsSorted = true;
+	}
+
+private:
+	Tape<S> mTape;	// the result nodes
+	CodeGenerator<S> mGenerator;
+	std::vector<Function> mFunctions;
+	bool mIsSorted = false;
+};
+
+} // namespace AutoGen
@@ -0,0 +1,590 @@
+#pragma once
+
+#include "RecType.h"
+#include "Adjoint.h"
+#include "CodeGenerator.h"
+#include "FlatHashTable.h"
+#include "Flatten.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace AutoGen {
+
+/*
+ * EGraph
+ * ======
+ *
+ * The operators of `RecType` only simplify locally while recording (x+0, x*1,
+ * constant folding). `simplify` rewrites recorded values globally: the graph
+ * is put into an e-graph, where every class holds equivalent expressions,
+ * rewrite rules add equivalent expressions until nothing changes (equality
+ * saturation), and the cheapest expression of every value is recorded again:
+ * ```
+ * std::vector<RecType<double>> values = ...;
+ * values = simplify(values);
+ * for (size_t i = 0; i < values.size(); ++i)
+ *		values[i].addToGeneratorAsResult(generator, "y[" + std::to_string(i) + "]");
+ * ```
+ *
+ * The rules are
+ * - --a = a, -(a-b) = b-a, a + -b = a-b, a - -b = a+b, -a*b = -(a*b), -a/b = -(a/b)
+ * - a*b + a*c = a*(b+c), a*b - a*c = a*(b-c)
+ * - sin(a)^2 + cos(a)^2 = 1, with squares as a*a or pow(a, 2)
+ * - a-a = 0, a+0 = a, a*1 = a, a*0 = 0, a*-1 = -a, a/1 = a
+ * - constant folding
+ * Sums and products are commutative, children are matched in both orders.
+ *
+ * The cost of an expression is the number of flops with `getCost` per
+ * operation. Extraction picks the cheapest expression of every class, counting
+ * shared subexpressions once per use. As that can be wrong for graphs with
+ * much sharing, `simplify` keeps the original values if the generated code
+ * (with common subexpressions merged) would not get cheaper.
+ */
+template<class S>
+class EGraph
+{
+public:
+	EGraph() {
+	}
+
+	// Approximate cost of an operation in flops.
+	static double getCost(NodeOp op) {
+		switch (op) {
+		case CONST_OP: case VAR_OP: case RESULT_OP: return 0;
+		case NEG_OP: case ADD_OP: case SUB_OP: case MUL_OP: return 1;
+		case SUM_OP: case PRODUCT_OP: return 1; // per child after the first
+		case DIV_OP: return 4;
+		case SQRT_OP: return 8;
+		case POW_OP: return 20;
+		case COS_OP: case SIN_OP: case ACOS_OP: return 20;
+		}
+		return 1;
+	}
+
+	// Cost of the code generated for `values`, common subexpressions counted
+	// once.
+	static double getCost(const std::vector<RecType<S>> &values) {
+		CodeGenerator<S> generator;
+		for (const RecType<S> &value : values) {
+			generator.collectNodes(value.getNode());
+		}
+		double cost = 0;
+		for (size_t i = 0; i < generator.getNumNodes(); ++i) {
+			const Node<S>* node = generator.getNode(i);
+			if(node->getOp() == SUM_OP || node->getOp() == PRODUCT_OP)
+				cost += getCost(node->getOp())*(node->getNumChildren() - 1);
+			else
+				cost += getCost(node->getOp());
+		}
+		return cost;
+	}
+
+	// Add recorded values, returns the class of every value. N-ary sums and
+	// products are added as binary ones, see `lower`.
+	std::vector<uint32_t> add(const std::vector<RecType<S>> &values) {
+		const std::vector<RecType<S>> lowered = lower(values);
+		SortedGraph<S> graph(lowered);
+		std::vector<uint32_t> classes(graph.size());
+		for (size_t k = 0; k < graph.size(); ++k) {
+			const Node<S>* node = graph.getNode(k);
+			if(node->getOp() == RESULT_OP)
+				throw std::invalid_argument("EGraph: results can not be simplified, simplify their values.");
+
+			ENode enode;
+			enode.op = node->getOp();
+			enode.numChildren = node->getNumChildren();
+			enode.leaf = (enode.numChildren == 0) ? node : nullptr;
+			for (uint32_t i = 0; i < enode.numChildren; ++i) {
+				enode.children[i] = classes[graph.findIndex(node->getChild(i))];
+			}
+			classes[k] = add(enode);
+		}
+
+		mCosts.clear();
+		mExtracted.clear();
+		std::vector<uint32_t> result;
+		for (const RecType<S> &value : lowered) {
+			result.push_back(classes[graph.findIndex(value.getNode())]);
+		}
+		return result;
+	}
+
+	// Apply the rules until no rule adds anything new, at most `maxIterations`
+	// times and until there are `maxNodes` nodes. Returns the number of
+	// iterations.
+	size_t saturate(size_t maxIterations = 8, size_t maxNodes = 100000) {
+		rebuild();
+		for (size_t iteration = 0; iteration < maxIterations; ++iteration) {
+			size_t numNodes = mNodes.size();
+			size_t numClasses = getNumClasses();
+			for (size_t n = 0; n < numNodes && mNodes.size() < maxNodes; ++n) {
+				if(!mNodes[n].isDuplicate)
+					applyRules(n);
+			}
+			rebuild();
+			if(mNodes.size() == numNodes && getNumClasses() == numClasses)
+				return iteration + 1;
+			if(mNodes.size() >= maxNodes)
+				return iteration + 1;
+		}
+		return maxIterations;
+	}
+
+	// Record the cheapest expression of a class.
+	RecType<S> extract(uint32_t c) {
+		if(mCosts.empty())
+			computeCosts();
+		if(mExtracted.empty())
+			mExtracted.resize(mParents.size());
+
+		// depth first, a class is recorded after the classes of its best node
+		std::vector<std::pair<uint32_t, uint32_t>> stack; // class, next child
+		stack.push_back(std::make_pair(find(c), 0u));
+		while(!stack.empty()) {
+			uint32_t cls = stack.back().first;
+			const ENode &node = mNodes[mBest[cls]];
+			if(mExtracted[cls].isRecorded) {
+				stack.pop_back();
+			}
+			else if(stack.back().second < node.numChildren) {
+				uint32_t child = find(node.children[stack.back().second++]);
+				if(!mExtracted[child].isRecorded)
+					stack.push_back(std::make_pair(child, 0u));
+			}
+			else {
+				mExtracted[cls].value = record(node);
+				mExtracted[cls].isRecorded = true;
+				stack.pop_back();
+			}
+		}
+		return mExtracted[find(c)].value;
+	}
+
+	size_t getNumNodes() const { return mNodes.size(); }
+
+	size_t getNumClasses() const {
+		size_t numClasses = 0;
+		for (size_t c = 0; c < mParents.size(); ++c) {
+			if(mParents[c] == c)
+				numClasses++;
+		}
+		return numClasses;
+	}
+
+	// The class a class was merged into.
+	uint32_t find(uint32_t c) const {
+		while(mParents[c] != c)
+			c = mParents[c];
+		return c;
+	}
+
+private:
+	// An operation on classes, or a constant or variable.
+	struct ENode
+	{
+		NodeOp op;
+		uint32_t numChildren;
+		uint32_t children[2];
+		const Node<S>* leaf;	// the recorded constant or variable
+		uint32_t cls;
+		bool isDuplicate;		// the same as another node after a merge
+	};
+
+	struct Constant
+	{
+		bool isKnown;
+		S value;
+	};
+
+	struct Extracted
+	{
+		bool isRecorded = false;
+		RecType<S> value;
+	};
+
+	static bool isCommutative(NodeOp op) {
+		return op == ADD_OP || op == MUL_OP;
+	}
+
+	// children by their classes, sorted for commutative operations
+	void canonicalize(ENode &node) const {
+		for (uint32_t i = 0; i < node.numChildren; ++i) {
+			node.children[i] = find(node.children[i]);
+		}
+		if(isCommutative(node.op) && node.children[0] > node.children[1])
+			std::swap(node.children[0], node.children[1]);
+	}
+
+	static uint64_t hashNode(const ENode &node) {
+		uint64_t hash = Node<S>::mix(node.op + 1);
+		if(node.leaf)
+			hash = Node<S>::mix(hash ^ node.leaf->getPayloadHash());
+		for (uint32_t i = 0; i < node.numChildren; ++i) {
+			hash = Node<S>::mix(hash ^ node.children[i]) + i;
+		}
+		return hash;
+	}
+
+	static bool isEqual(const ENode &a, const ENode &b) {
+		if(a.op != b.op || a.numChildren != b.numChildren)
+			return false;
+		for (uint32_t i = 0; i < a.numChildren; ++i) {
+			if(a.children[i] != b.children[i])
+				return false;
+		}
+		if(a.leaf && b.leaf)
+			return a.leaf->isPayloadEqual(*b.leaf);
+		return a.leaf == b.leaf;
+	}
+
+	const uint32_t *findNode(const ENode &node) const {
+		return mTable.find(hashNode(node), [this, &node](uint32_t n) {
+			return isEqual(mNodes[n], node);
+		});
+	}
+
+	// value of an operation on constants
+	static bool fold(NodeOp op, S a, S b, S &value) {
+		using std::pow; using std::sqrt; using std::cos; using std::sin; using std::acos;
+		switch (op) {
+		case NEG_OP: value = -a; return true;
+		case ADD_OP: value = a + b; return true;
+		case SUB_OP: value = a - b; return true;
+		case MUL_OP: value = a * b; return true;
+		case DIV_OP: value = a / b; return true;
+		case POW_OP: value = pow(a, b); return true;
+		case SQRT_OP: value = sqrt(a); return true;
+		case COS_OP: value = cos(a); return true;
+		case SIN_OP: value = sin(a); return true;
+		case ACOS_OP: value = acos(a); return true;
+		default: return false;
+		}
+	}
+
+	// Add a node, returns its class. Operations on constants are folded.
+	uint32_t add(ENode node) {
+		canonicalize(node);
+
+		if(node.numChildren > 0) {
+			const Constant &a = mConstants[node.children[0]];
+			const Constant &b = mConstants[node.children[node.numChildren - 1]];
+			S value;
+			if(a.isKnown && b.isKnown && fold(node.op, a.value, b.value, value))
+				return addConstant(value);
+		}
+
+		const uint32_t *same = findNode(node);
+		if(same)
+			return find(mNodes[*same].cls);
+
+		uint32_t c = mParents.size();
+		mParents.push_back(c);
+		mClassNodes.push_back(std::vector<uint32_t>(1, uint32_t(mNodes.size())));
+		Constant constant;
+		constant.isKnown = (node.op == CONST_OP) && node.leaf->evaluate(constant.value);
+		mConstants.push_back(constant);
+
+		node.cls = c;
+		node.isDuplicate = false;
+		mTable.insert(hashNode(node), mNodes.size());
+		mNodes.push_back(node);
+		return c;
+	}
+
+	uint32_t addConstant(S value) {
+		ENode node;
+		node.op = CONST_OP;
+		node.numChildren = 0;
+		node.leaf = RecType<S>(value).getNode();
+		return add(node);
+	}
+
+	uint32_t add(NodeOp op, uint32_t a, uint32_t b = 0) {
+		ENode node;
+		node.op = op;
+		node.numChildren = (op == NEG_OP || op == SQRT_OP || op == COS_OP || op == SIN_OP || op == ACOS_OP) ? 1 : 2;
+		node.children[0] = a;
+		node.children[1] = b;
+		node.leaf = nullptr;
+		return add(node);
+	}
+
+	void merge(uint32_t a, uint32_t b) {
+		a = find(a);
+		b = find(b);
+		if(a == b)
+			return;
+		if(mClassNodes[a].size() < mClassNodes[b].size())
+			std::swap(a, b);
+		mParents[b] = a;
+		mClassNodes[a].insert(mClassNodes[a].end(), mClassNodes[b].begin(), mClassNodes[b].end());
+		mClassNodes[b].clear();
+		if(!mConstants[a].isKnown)
+			mConstants[a] = mConstants[b];
+	}
+
+	// Restore that equal nodes are in the same class (congruence): merging
+	// classes can make nodes with different children equal.
+	void rebuild() {
+		mCosts.clear();
+		mExtracted.clear();
+
+		bool isChanged = true;
+		while(isChanged) {
+			isChanged = false;
+			mTable.clear();
+			for (size_t n = 0; n < mNodes.size(); ++n) {
+				ENode &node = mNodes[n];
+				if(node.isDuplicate)
+					continue;
+				canonicalize(node);
+				const uint32_t *same = findNode(node);
+				if(same) {
+					node.isDuplicate = true;
+					if(find(mNodes[*same].cls) != find(node.cls)) {
+						merge(mNodes[*same].cls, node.cls);
+						isChanged = true;
+					}
+				}
+				else {
+					mTable.insert(hashNode(node), n);
+				}
+			}
+
+			// every class with a known value has its constant
+			for (uint32_t c = 0; c < mParents.size(); ++c) {
+				if(mParents[c] != c || !mConstants[c].isKnown)
+					continue;
+				uint32_t constant = addConstant(mConstants[c].value);
+				if(find(constant) != c) {
+					merge(c, constant);
+					isChanged = true;
+				}
+			}
+		}
+
+		for (std::vector<uint32_t> &nodes : mClassNodes) {
+			nodes.clear();
+		}
+		for (size_t n = 0; n < mNodes.size(); ++n) {
+			if(!mNodes[n].isDuplicate)
+				mClassNodes[find(mNodes[n].cls)].push_back(n);
+		}
+	}
+
+	// nodes of class `c` with operation `op`
+	std::vector<ENode> getNodes(uint32_t c, NodeOp op) const {
+		std::vector<ENode> nodes;
+		for (uint32_t n : mClassNodes[find(c)]) {
+			if(mNodes[n].op == op && !mNodes[n].isDuplicate)
+				nodes.push_back(mNodes[n]);
+		}
+		return nodes;
+	}
+
+	bool isConstant(uint32_t c, S value) const {
+		const Constant &constant = mConstants[find(c)];
+		return constant.isKnown && constant.value == value;
+	}
+
+	// whether class `c` is a square of class `a` with operation `op`
+	bool isSquareOf(uint32_t c, NodeOp op, uint32_t &a) const {
+		std::vector<ENode> bases;
+		for (const ENode &mul : getNodes(c, MUL_OP)) {
+			if(find(mul.children[0]) == find(mul.children[1]))
+				bases.push_back(mul);
+		}
+		for (const ENode &pow : getNodes(c, POW_OP)) {
+			if(isConstant(pow.children[1], S(2)))
+				bases.push_back(pow);
+		}
+		for (const ENode &base : bases) {
+			for (const ENode &f : getNodes(base.children[0], op)) {
+				a = find(f.children[0]);
+				return true;
+			}
+		}
+		return false;
+	}
+
+	void applyRules(size_t n) {
+		const ENode node = mNodes[n];
+		const uint32_t c = node.cls;
+		const uint32_t a = node.children[0];
+		const uint32_t b = node.children[1];
+
+		switch (node.op) {
+		case NEG_OP:
+			// --a = a
+			for (const ENode &neg : getNodes(a, NEG_OP))
+				merge(c, neg.children[0]);
+			// -(a-b) = b-a
+			for (const ENode &sub : getNodes(a, SUB_OP))
+				merge(c, add(SUB_OP, sub.children[1], sub.children[0]));
+			break;
+
+		case ADD_OP:
+			for (int order = 0; order < 2; ++order) {
+				uint32_t x = order ? b : a, y = order ? a : b;
+				// x + -y = x-y
+				for (const ENode &neg : getNodes(y, NEG_OP))
+					merge(c, add(SUB_OP, x, neg.children[0]));
+				// x+0 = x
+				if(isConstant(y, S(0)))
+					merge(c, x);
+			}
+			// a*b + a*c = a*(b+c)
+			factor(c, a, b, ADD_OP);
+			// sin(x)^2 + cos(x)^2 = 1
+			{
+				uint32_t s, co;
+				if((isSquareOf(a, SIN_OP, s) && isSquareOf(b, COS_OP, co) && s == co)
+						|| (isSquareOf(a, COS_OP, co) && isSquareOf(b, SIN_OP, s) && s == co))
+					merge(c, addConstant(S(1)));
+			}
+			break;
+
+		case SUB_OP:
+			// a - -b = a+b
+			for (const ENode &neg : getNodes(b, NEG_OP))
+				merge(c, add(ADD_OP, a, neg.children[0]));
+			// a-a = 0
+			if(find(a) == find(b))
+				merge(c, addConstant(S(0)));
+			// a-0 = a
+			if(isConstant(b, S(0)))
+				merge(c, a);
+			// a*b - a*c = a*(b-c)
+			factor(c, a, b, SUB_OP);
+			break;
+
+		case MUL_OP:
+			for (int order = 0; order < 2; ++order) {
+				uint32_t x = order ? b : a, y = order ? a : b;
+				// -x*y = -(x*y)
+				for (const ENode &neg : getNodes(x, NEG_OP))
+					merge(c, add(NEG_OP, add(MUL_OP, neg.children[0], y)));
+				// x*1 = x, x*0 = 0, x*-1 = -x
+				if(isConstant(y, S(1)))
+					merge(c, x);
+				else if(isConstant(y, S(0)))
+					merge(c, addConstant(S(0)));
+				else if(isConstant(y, S(-1)))
+					merge(c, add(NEG_OP, x));
+			}
+			break;
+
+		case DIV_OP:
+			// -a/b = -(a/b)
+			for (const ENode &neg : getNodes(a, NEG_OP))
+				merge(c, add(NEG_OP, add(DIV_OP, neg.children[0], b)));
+			// a/1 = a
+			if(isConstant(b, S(1)))
+				merge(c, a);
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	// x*y op x*z = x*(y op z)
+	void factor(uint32_t c, uint32_t a, uint32_t b, NodeOp op) {
+		std::vector<ENode> productsB = getNodes(b, MUL_OP);
+		for (const ENode &p : getNodes(a, MUL_OP)) {
+			for (const ENode &q : productsB) {
+				for (int i = 0; i < 2; ++i) {
+					for (int j = 0; j < 2; ++j) {
+						if(find(p.children[i]) == find(q.children[j]))
+							merge(c, add(MUL_OP, p.children[i], add(op, p.children[1-i], q.children[1-j])));
+					}
+				}
+			}
+		}
+	}
+
+	// cheapest node of every class, as a tree
+	void computeCosts() {
+		const double infinity = std::numeric_limits<double>::infinity();
+		mCosts.assign(mParents.size(), infinity);
+		mBest.assign(mParents.size(), 0);
+		bool isChanged = true;
+		while(isChanged) {
+			isChanged = false;
+			for (size_t n = 0; n < mNodes.size(); ++n) {
+				const ENode &node = mNodes[n];
+				if(node.isDuplicate)
+					continue;
+				double cost = getCost(node.op);
+				for (uint32_t i = 0; i < node.numChildren; ++i) {
+					cost += mCosts[find(node.children[i])];
+				}
+				uint32_t c = find(node.cls);
+				if(cost < mCosts[c]) {
+					mCosts[c] = cost;
+					mBest[c] = n;
+					isChanged = true;
+				}
+			}
+		}
+	}
+
+	RecType<S> record(const ENode &node) const {
+		typedef RecType<S> R;
+		if(node.leaf)
+			return R(*node.leaf);
+
+		const R &a = mExtracted[find(node.children[0])].value;
+		const R &b = mExtracted[find(node.children[node.numChildren - 1])].value;
+		switch (node.op) {
+		case NEG_OP: return -a;
+		case ADD_OP: return a + b;
+		case SUB_OP: return a - b;
+		case MUL_OP: return a * b;
+		case DIV_OP: return a / b;
+		case POW_OP: return pow(a, b);
+		case SQRT_OP: return sqrt(a);
+		case COS_OP: return cos(a);
+		case SIN_OP: return sin(a);
+		case ACOS_OP: return acos(a);
+		default: throw std::logic_error("EGraph: unsupported node");
+		}
+	}
+
+private:
+	// the leaves stay valid, see Tape.h
+	typename Tape<S>::Reference mTapeReference;
+	std::vector<ENode> mNodes;
+	std::vector<uint32_t> mParents;
+	std::vector<std::vector<uint32_t>> mClassNodes;
+	std::vector<Constant> mConstants;
+	FlatHashTable<uint32_t> mTable;
+
+	std::vector<double> mCosts;
+	std::vector<uint32_t> mBest;
+	std::vector<Extracted> mExtracted;
+};
+
+// Simplify recorded values with an `EGraph`. Returns `values` if this does
+// not make the code cheaper.
+template<class S>
+std::vector<RecType<S>> simplify(const std::vector<RecType<S>> &values, size_t maxIterations = 8, size_t maxNodes = 100000) {
+	EGraph<S> egraph;
+	std::vector<uint32_t> classes = egraph.add(values);
+	egraph.saturate(maxIterations, maxNodes);
+
+	std::vector<RecType<S>> simplified;
+	for (uint32_t c : classes) {
+		simplified.push_back(egraph.extract(c));
+	}
+	if(EGraph<S>::getCost(simplified) < EGraph<S>::getCost(values))
+		return simplified;
+	return values;
+}
+
+} // namespace AutoGen
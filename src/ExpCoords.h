@@ -80,26 +80,22 @@ struct ExpCoords
 
         Tensor4<T, 3,3,3,3> ddR;
 
-        // compute gradient and add to code gen
+        // all three derivatives of dR in one pass
         {
-            typedef AutoDiff<T, T> AD;
+            typedef AutoDiff<T, Vector3<T>> AD;
 
-            // record computation
             Vector3<AD> v;
             for (int i = 0; i < 3; ++i) {
-                v[i] = theta[i];
+                v[i] = AD(theta[i], Vector3<T>::Unit(i));
             }
 
-            for (int i = 0; i < 3; ++i) {
-                v(i).deriv() = 1.0;
-                Tensor3<AD,3,3,3> dR = ExpCoords::dR<AD>(v);
+            Tensor3<AD,3,3,3> dR = ExpCoords::dR<AD>(v);
+            for (int i = 0; i < 3; ++i)
                 for (int j = 0; j < 3; ++j)
                     for (int k = 0; k < 3; ++k)
                         for (int l = 0; l < 3; ++l){
-                            ddR[i][j](k,l) = dR[j](k,l).deriv();
+                            ddR[i][j](k,l) = dR[j](k,l).deriv()[i];
                         }
-                v(i).deriv() = 0.0;
-            }
         }
 
         return ddR;
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+namespace AutoGen {
+
+/*
+ * FlatHashTable
+ * =============
+ *
+ * Open addressing hash table with linear probing. Values are stored together
+ * with their 64 bit hash in one contiguous array.
+ *
+ * The table does not hash or compare values itself: the caller passes the hash
+ * of a value and, for lookups, a predicate that decides whether a stored value
+ * is the one searched for. Only values with exactly the same hash are passed
+ * to the predicate. The hash is used to pick the slot, so it has to be well
+ * mixed (e.g. by `Node<S>::mix`).
+ */
+template<class V>
+class FlatHashTable
+{
+public:
+	FlatHashTable() {
+	}
+
+	// Return the stored value with hash `hash` for which `isEqual(value)` is
+	// true, or nullptr.
+	template<class Pred>
+	V* find(uint64_t hash, Pred isEqual) {
+		if(mSize == 0)
+			return nullptr;
+
+		hash = nonEmpty(hash);
+		size_t mask = mSlots.size() - 1;
+		for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+			Slot &slot = mSlots[i];
+			if(slot.hash == emptyHash)
+				return nullptr;
+			if(slot.hash == hash && isEqual(slot.value))
+				return &slot.value;
+		}
+	}
+
+	template<class Pred>
+	const V* find(uint64_t hash, Pred isEqual) const {
+		return const_cast<FlatHashTable<V>*>(this)->find(hash, isEqual);
+	}
+
+	// Insert a value. The value must not be in the table yet.
+	V &insert(uint64_t hash, const V &value) {
+		if(2*(mSize + 1) > mSlots.size())
+			rehash(mSlots.empty() ? 16 : 2*mSlots.size());
+
+		mSize++;
+		return insertSlot(nonEmpty(hash), value);
+	}
+
+	void reserve(size_t size) {
+		size_t capacity = 16;
+		while(capacity < 2*size)
+			capacity *= 2;
+		if(capacity > mSlots.size())
+			rehash(capacity);
+	}
+
+	void clear() {
+		mSlots.clear();
+		mSize = 0;
+	}
+
+	size_t size() const { return mSize; }
+
+private:
+	struct Slot
+	{
+		uint64_t hash;
+		V value;
+	};
+
+	static const uint64_t emptyHash = 0;
+
+	static uint64_t nonEmpty(uint64_t hash) {
+		return (hash == emptyHash) ? 1 : hash;
+	}
+
+	V &insertSlot(uint64_t hash, const V &value) {
+		size_t mask = mSlots.size() - 1;
+		size_t i = hash & mask;
+		while(mSlots[i].hash != emptyHash)
+			i = (i + 1) & mask;
+
+		mSlots[i].hash = hash;
+		mSlots[i].value = value;
+		return mSlots[i].value;
+	}
+
+	void rehash(size_t capacity) {
+		std::vector<Slot> slots(capacity, Slot{emptyHash, V()});
+		slots.swap(mSlots);
+		for (const Slot &slot : slots) {
+			if(slot.hash != emptyHash)
+				insertSlot(slot.hash, slot.value);
+		}
+	}
+
+private:
+	std::vector<Slot> mSlots;
+	size_t mSize = 0;
+};
+
+template<class V>
+const uint64_t FlatHashTable<V>::emptyHash;
+
+} // namespace AutoGen
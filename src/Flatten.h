@@ -0,0 +1,200 @@
+#pragma once
+
+#include "RecType.h"
+#include "Adjoint.h"
+#include "CodeGenerator.h"
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace AutoGen {
+
+/*
+ * Flatten
+ * =======
+ *
+ * Binary sums and products depend on how they were grouped: `(a+b)+c` and
+ * `a+(b+c)` are different nodes, so common subexpression elimination misses
+ * them. `flatten` turns trees of sums and products into n-ary `NodeSum` and
+ * `NodeProduct` nodes with their children sorted by hash, so equal sums are
+ * equal nodes in any grouping and order:
+ * ```
+ * std::vector<RecType<double>> values = flatten(hessianEntries);
+ * ```
+ * Only sums (products) used once are merged into the sum (product) using
+ * them, a shared one stays a node of its own. Constants are folded into one.
+ *
+ * The code of n-ary nodes adds (multiplies) the children as a balanced tree,
+ * which can differ from the original grouping in the last bits. Bytecode,
+ * `gradient` and `tangents` (Adjoint.h) support n-ary nodes directly, `lower`
+ * turns them back into balanced binary nodes for everything else.
+ */
+
+// Record `op` on `children`, like a node with that op.
+template<class S>
+RecType<S> recordOp(NodeOp op, const std::vector<RecType<S>> &children) {
+	typedef RecType<S> R;
+	switch (op) {
+	case NEG_OP: return -children[0];
+	case ADD_OP: return children[0] + children[1];
+	case SUB_OP: return children[0] - children[1];
+	case MUL_OP: return children[0] * children[1];
+	case DIV_OP: return children[0] / children[1];
+	case POW_OP: return pow(children[0], children[1]);
+	case SQRT_OP: return sqrt(children[0]);
+	case COS_OP: return cos(children[0]);
+	case SIN_OP: return sin(children[0]);
+	case ACOS_OP: return acos(children[0]);
+	case SUM_OP: case PRODUCT_OP: {
+		// constants are folded into one
+		std::vector<const Node<S>*> nodes;
+		S constant = (op == SUM_OP) ? S(0) : S(1);
+		bool hasConstant = false;
+		for (const R &child : children) {
+			S value;
+			if(child.getNode()->evaluate(value)) {
+				constant = (op == SUM_OP) ? constant + value : constant * value;
+				hasConstant = true;
+			}
+			else {
+				nodes.push_back(child.getNode());
+			}
+		}
+		if(hasConstant && (nodes.empty() || constant != ((op == SUM_OP) ? S(0) : S(1))))
+			nodes.push_back(R(constant).getNode());
+		if(nodes.empty())
+			return R(constant);
+		if(nodes.size() == 1)
+			return R(*nodes[0]);
+		if(nodes.size() == 2)
+			return (op == SUM_OP) ? R(*nodes[0]) + R(*nodes[1]) : R(*nodes[0]) * R(*nodes[1]);
+		if(op == SUM_OP)
+			return R::template record<NodeSum<S>>(std::move(nodes));
+		return R::template record<NodeProduct<S>>(std::move(nodes));
+	}
+	default:
+		throw std::logic_error("recordOp: unsupported op");
+	}
+}
+
+// Balanced binary sum or product of `children[begin, end)`.
+template<class S>
+RecType<S> recordBalanced(NodeOp op, const std::vector<RecType<S>> &children, size_t begin, size_t end) {
+	if(end - begin == 1)
+		return children[begin];
+	size_t middle = (begin + end + 1) / 2;
+	RecType<S> a = recordBalanced(op, children, begin, middle);
+	RecType<S> b = recordBalanced(op, children, middle, end);
+	return (op == SUM_OP) ? a + b : a * b;
+}
+
+// Record `values` again with every node replaced by `record(node, children)`,
+// where the children are already replaced.
+template<class S, class F>
+std::vector<RecType<S>> rewrite(const std::vector<RecType<S>> &values, F record) {
+	SortedGraph<S> graph(values);
+	std::vector<RecType<S>> replaced(graph.size());
+	std::vector<RecType<S>> children;
+	for (size_t k = 0; k < graph.size(); ++k) {
+		const Node<S>* node = graph.getNode(k);
+		if(node->getOp() == RESULT_OP)
+			throw std::invalid_argument("rewrite: results can not be rewritten, rewrite their values.");
+		children.clear();
+		for (size_t i = 0; i < node->getNumChildren(); ++i) {
+			children.push_back(replaced[graph.findIndex(node->getChild(i))]);
+		}
+		replaced[k] = record(node, k, children);
+	}
+
+	std::vector<RecType<S>> result;
+	for (const RecType<S> &value : values) {
+		result.push_back(replaced[graph.findIndex(value.getNode())]);
+	}
+	return result;
+}
+
+// Merge sums and products into n-ary nodes.
+template<class S>
+std::vector<RecType<S>> flatten(const std::vector<RecType<S>> &values) {
+	typedef RecType<S> R;
+	SortedGraph<S> graph(values);
+
+	// nodes computing the same value are counted as one, by the index of the
+	// node the code generator keeps for them
+	CodeGenerator<S> generator;
+	for (const R &value : values) {
+		generator.collectNodes(value.getNode());
+	}
+	auto key = [&](const Node<S>* node) {
+		return size_t(graph.findIndex(generator.getHashedNode(node)));
+	};
+
+	// a sum (product) is merged into its parent if that is the only use and
+	// a sum (product) too
+	auto flatOp = [](const Node<S>* node) {
+		NodeOp op = node->getOp();
+		return (op == ADD_OP || op == SUM_OP) ? SUM_OP : (op == MUL_OP || op == PRODUCT_OP) ? PRODUCT_OP : op;
+	};
+	std::vector<uint32_t> uses(graph.size(), 0);
+	std::vector<NodeOp> parentOp(graph.size(), CONST_OP);
+	for (const R &value : values) {
+		uses[key(value.getNode())] += 2;
+	}
+	for (size_t k = 0; k < graph.size(); ++k) {
+		const Node<S>* node = graph.getNode(k);
+		if(key(node) != k)
+			continue;
+		for (size_t i = 0; i < node->getNumChildren(); ++i) {
+			size_t child = key(node->getChild(i));
+			uses[child]++;
+			parentOp[child] = flatOp(node);
+		}
+	}
+	std::vector<bool> isMerged(graph.size(), false);
+	for (size_t k = 0; k < graph.size(); ++k) {
+		NodeOp op = flatOp(graph.getNode(k));
+		isMerged[k] = (op == SUM_OP || op == PRODUCT_OP) && uses[k] == 1 && parentOp[k] == op;
+	}
+
+	// the children of merged nodes, for their parent
+	std::vector<std::vector<R>> operands(graph.size());
+	return rewrite(values, [&](const Node<S>* node, size_t, const std::vector<R> &children) {
+		NodeOp op = flatOp(node);
+		if(op != SUM_OP && op != PRODUCT_OP) {
+			if(node->getNumChildren() == 0)
+				return R(*node);
+			return recordOp(op, children);
+		}
+
+		std::vector<R> flat;
+		for (size_t i = 0; i < node->getNumChildren(); ++i) {
+			size_t child = key(node->getChild(i));
+			if(isMerged[child])
+				flat.insert(flat.end(), operands[child].begin(), operands[child].end());
+			else
+				flat.push_back(children[i]);
+		}
+		if(isMerged[key(node)]) {
+			operands[key(node)] = std::move(flat);
+			return R();
+		}
+		return recordOp(op, flat);
+	});
+}
+
+// Replace n-ary sums and products by balanced trees of binary ones.
+template<class S>
+std::vector<RecType<S>> lower(const std::vector<RecType<S>> &values) {
+	typedef RecType<S> R;
+	return rewrite(values, [](const Node<S>* node, size_t, const std::vector<R> &children) {
+		NodeOp op = node->getOp();
+		if(node->getNumChildren() == 0)
+			return R(*node);
+		if(op == SUM_OP || op == PRODUCT_OP)
+			return recordBalanced(op, children, 0, children.size());
+		return recordOp(op, children);
+	});
+}
+
+} // namespace AutoGen
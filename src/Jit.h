@@ -0,0 +1,295 @@
+#pragma once
+
+/*
+ * Jit
+ * ===
+ *
+ * Translates the bytecode of an expression graph to x86-64 machine code in
+ * memory, so a recorded function can be called natively without running a
+ * compiler:
+ * ```
+ * Bytecode<double> bytecode = Bytecode<double>::compile(generator);
+ * JitFunction function;
+ * std::string error;
+ * if(jitCompile(bytecode, function, error)) {
+ *		compute_extern* fnc = function.get();
+ *		fnc(x, y); // use function!
+ * }
+ * ```
+ *
+ * The code only uses SSE2, which every x86-64 CPU has. Every bytecode register
+ * is a stack slot, pow, cos, sin and acos are calls into libm. The function is
+ * valid as long as its `JitFunction` lives.
+ *
+ * Currently this only works on x86-64 Linux (System V calling convention).
+ */
+
+#include "Bytecode.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) && defined(__linux__)
+#define AUTOGEN_JIT_X86_64
+#include <sys/mman.h>
+#endif
+
+namespace AutoGen {
+
+// general function for code generator, same as in AutoLoad.h
+//                            in     out
+typedef void compute_extern(double*,double*);
+
+// Owns the executable memory of a jit compiled function.
+class JitFunction
+{
+public:
+	JitFunction() {
+	}
+
+	JitFunction(JitFunction &&other)
+		: mMemory(other.mMemory), mSize(other.mSize), mEntry(other.mEntry) {
+		other.mMemory = nullptr;
+		other.mSize = 0;
+		other.mEntry = nullptr;
+	}
+
+	JitFunction &operator=(JitFunction &&other) {
+		std::swap(mMemory, other.mMemory);
+		std::swap(mSize, other.mSize);
+		std::swap(mEntry, other.mEntry);
+		return *this;
+	}
+
+	JitFunction(const JitFunction &) = delete;
+	JitFunction &operator=(const JitFunction &) = delete;
+
+	~JitFunction() {
+#ifdef AUTOGEN_JIT_X86_64
+		if(mMemory)
+			munmap(mMemory, mSize);
+#endif
+	}
+
+	compute_extern* get() const { return mEntry; }
+
+	void operator()(double *in, double *out) const { mEntry(in, out); }
+
+	explicit operator bool() const { return mEntry != nullptr; }
+
+	// size of the code and constants in bytes
+	size_t getSize() const { return mSize; }
+
+private:
+	friend bool jitCompile(const Bytecode<double> &bytecode, JitFunction &function, std::string &error);
+
+	void *mMemory = nullptr;
+	size_t mSize = 0;
+	compute_extern* mEntry = nullptr;
+};
+
+// Writes x86-64 instructions into a byte buffer. Registers of the bytecode
+// live on the stack at [rsp + 8*r], `in` is in rbx and `out` in rbp.
+class JitAssembler
+{
+public:
+	enum Xmm { XMM0 = 0, XMM1 = 1 };
+
+	// SSE2 scalar double ops, F2 0F <op>
+	enum SseOp : uint8_t { MOVSD_LOAD = 0x10, MOVSD_STORE = 0x11, SQRTSD = 0x51, ADDSD = 0x58, MULSD = 0x59, SUBSD = 0x5C, DIVSD = 0x5E };
+
+	// base registers for memory operands
+	enum Base : uint8_t { RBX = 3, RSP = 4, RBP = 5 };
+
+	// <op> xmm, [base + disp]
+	void sse(SseOp op, Xmm xmm, Base base, uint32_t disp) {
+		bytes({0xF2, 0x0F, op});
+		memory(xmm, base, disp);
+	}
+
+	// <op> xmm, [rip + disp], the displacement is patched by `patchRip`
+	size_t sseRip(SseOp op, Xmm xmm) {
+		bytes({0xF2, 0x0F, op, uint8_t(0x05 | (xmm << 3))});
+		size_t pos = mCode.size();
+		dword(0);
+		return pos;
+	}
+
+	// let the rip relative operand at `pos` point to offset `target`, where
+	// the code starts at offset `codeOffset`
+	void patchRip(size_t pos, size_t target, size_t codeOffset) {
+		int32_t disp = int32_t(int64_t(target) - int64_t(codeOffset + pos + 4));
+		std::memcpy(&mCode[pos], &disp, 4);
+	}
+
+	// rax = [rsp + disp]; flip sign bit; [rsp + dst] = rax
+	void negate(uint32_t dst, uint32_t src) {
+		bytes({0x48, 0x8B}); memory(0, RSP, src);
+		bytes({0x48, 0x0F, 0xBA, 0xF8, 63});
+		bytes({0x48, 0x89}); memory(0, RSP, dst);
+	}
+
+	// mov rax, function; call rax
+	void call(const void *function) {
+		bytes({0x48, 0xB8});
+		uint64_t address = reinterpret_cast<uintptr_t>(function);
+		for (int i = 0; i < 8; ++i)
+			mCode.push_back(uint8_t(address >> (8*i)));
+		bytes({0xFF, 0xD0});
+	}
+
+	void prologue(uint32_t frameSize) {
+		bytes({0x53, 0x55});				// push rbx; push rbp
+		bytes({0x48, 0x89, 0xFB});		// mov rbx, rdi
+		bytes({0x48, 0x89, 0xF5});		// mov rbp, rsi
+		// grow the stack a page at a time, so the guard page is hit in order
+		uint32_t remaining = frameSize;
+		while(remaining > pageSize) {
+			subRsp(pageSize);
+			bytes({0x48, 0x83, 0x0C, 0x24, 0x00});	// or qword [rsp], 0
+			remaining -= pageSize;
+		}
+		subRsp(remaining);
+	}
+
+	void epilogue(uint32_t frameSize) {
+		bytes({0x48, 0x81, 0xC4}); dword(frameSize);	// add rsp, frameSize
+		bytes({0x5D, 0x5B, 0xC3});				// pop rbp; pop rbx; ret
+	}
+
+	const std::vector<uint8_t> &getCode() const { return mCode; }
+
+	static const uint32_t pageSize = 4096;
+
+private:
+	void subRsp(uint32_t size) {
+		bytes({0x48, 0x81, 0xEC}); dword(size);
+	}
+
+	// ModRM (and SIB) for [base + disp32]
+	void memory(int reg, Base base, uint32_t disp) {
+		mCode.push_back(uint8_t(0x80 | (reg << 3) | base));
+		if(base == RSP)
+			mCode.push_back(0x24);
+		dword(disp);
+	}
+
+	void dword(uint32_t value) {
+		for (int i = 0; i < 4; ++i)
+			mCode.push_back(uint8_t(value >> (8*i)));
+	}
+
+	void bytes(std::initializer_list<uint8_t> values) {
+		mCode.insert(mCode.end(), values.begin(), values.end());
+	}
+
+	std::vector<uint8_t> mCode;
+};
+
+// Compile `bytecode` to machine code. Returns false and sets `error` if this
+// is not possible on this platform.
+inline bool jitCompile(const Bytecode<double> &bytecode, JitFunction &function, std::string &error) {
+#ifndef AUTOGEN_JIT_X86_64
+	error = "Jit compilation is only supported on x86-64 Linux.";
+	return false;
+#else
+	typedef Bytecode<double> B;
+	typedef JitAssembler A;
+
+	// registers, plus padding to keep the stack 16 byte aligned for calls
+	// (entry 8 mod 16, after two pushes again 8 mod 16)
+	uint32_t frameSize = uint32_t((8*bytecode.getNumRegisters() + 15) & ~size_t(15)) + 8;
+
+	// the constants are stored in front of the code
+	const std::vector<double> &constants = bytecode.getConstants();
+	size_t codeOffset = (8*constants.size() + 15) & ~size_t(15);
+
+	typedef double (*Unary)(double);
+	typedef double (*Binary)(double, double);
+	Binary powFunction = ::pow;
+	Unary cosFunction = ::cos, sinFunction = ::sin, acosFunction = ::acos;
+
+	A a;
+	std::vector<std::pair<size_t, size_t>> constantRefs; // position, constant
+	a.prologue(frameSize);
+	for (const B::Instruction &i : bytecode.getInstructions()) {
+		switch (i.op) {
+		case B::LOAD:
+			a.sse(A::MOVSD_LOAD, A::XMM0, A::RBX, 8*i.a);
+			a.sse(A::MOVSD_STORE, A::XMM0, A::RSP, 8*i.dst);
+			break;
+		case B::CONST:
+			constantRefs.push_back(std::make_pair(a.sseRip(A::MOVSD_LOAD, A::XMM0), size_t(i.a)));
+			a.sse(A::MOVSD_STORE, A::XMM0, A::RSP, 8*i.dst);
+			break;
+		case B::STORE:
+			a.sse(A::MOVSD_LOAD, A::XMM0, A::RSP, 8*i.a);
+			a.sse(A::MOVSD_STORE, A::XMM0, A::RBP, 8*i.dst);
+			break;
+		case B::NEG:
+			a.negate(8*i.dst, 8*i.a);
+			break;
+		case B::ADD: case B::SUB: case B::MUL: case B::DIV: {
+			A::SseOp op = (i.op == B::ADD) ? A::ADDSD : (i.op == B::SUB) ? A::SUBSD : (i.op == B::MUL) ? A::MULSD : A::DIVSD;
+			a.sse(A::MOVSD_LOAD, A::XMM0, A::RSP, 8*i.a);
+			a.sse(op, A::XMM0, A::RSP, 8*i.b);
+			a.sse(A::MOVSD_STORE, A::XMM0, A::RSP, 8*i.dst);
+			break;
+		}
+		case B::SQRT:
+			a.sse(A::SQRTSD, A::XMM0, A::RSP, 8*i.a);
+			a.sse(A::MOVSD_STORE, A::XMM0, A::RSP, 8*i.dst);
+			break;
+		case B::POW:
+			a.sse(A::MOVSD_LOAD, A::XMM0, A::RSP, 8*i.a);
+			a.sse(A::MOVSD_LOAD, A::XMM1, A::RSP, 8*i.b);
+			a.call(reinterpret_cast<const void*>(powFunction));
+			a.sse(A::MOVSD_STORE, A::XMM0, A::RSP, 8*i.dst);
+			break;
+		case B::COS: case B::SIN: case B::ACOS: {
+			Unary f = (i.op == B::COS) ? cosFunction : (i.op == B::SIN) ? sinFunction : acosFunction;
+			a.sse(A::MOVSD_LOAD, A::XMM0, A::RSP, 8*i.a);
+			a.call(reinterpret_cast<const void*>(f));
+			a.sse(A::MOVSD_STORE, A::XMM0, A::RSP, 8*i.dst);
+			break;
+		}
+		}
+	}
+	a.epilogue(frameSize);
+
+	// write constants and code to writable memory, then make it executable
+	size_t size = codeOffset + a.getCode().size();
+	void *memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(memory == MAP_FAILED) {
+		error = "Could not allocate memory for jit compiled code.";
+		return false;
+	}
+
+	for (const std::pair<size_t, size_t> &ref : constantRefs) {
+		a.patchRip(ref.first, 8*ref.second, codeOffset);
+	}
+	if(!constants.empty())
+		std::memcpy(memory, constants.data(), 8*constants.size());
+	std::memcpy(static_cast<char*>(memory) + codeOffset, a.getCode().data(), a.getCode().size());
+
+	if(mprotect(memory, size, PROT_READ | PROT_EXEC) != 0) {
+		munmap(memory, size);
+		error = "Could not make jit compiled code executable.";
+		return false;
+	}
+
+	JitFunction result;
+	result.mMemory = memory;
+	result.mSize = size;
+	result.mEntry = reinterpret_cast<compute_extern*>(static_cast<char*>(memory) + codeOffset);
+	function = std::move(result);
+	return true;
+#endif
+}
+
+} // namespace AutoGen
@@ -1,16 +1,21 @@
 #pragma once
 
-#include <memory>
+#include <cstdint>
+#include <ostream>
+#include <sstream>
+#include <string>
 #include <algorithm>
 
 namespace AutoGen {
 
-template <class T> using Sp = std::shared_ptr<T>;
-
 template<class S> class CodeGenerator;
+template<class S> class Tape;
 
 enum NodeType { REGULAR_NODE, INPUT_NODE, OUTPUT_NODE };
 
+// the operation a node performs, every node class has its own op
+enum NodeOp { CONST_OP, VAR_OP, RESULT_OP, NEG_OP, ADD_OP, SUB_OP, MUL_OP, DIV_OP, POW_OP, SQRT_OP, COS_OP, SIN_OP, ACOS_OP, SUM_OP, PRODUCT_OP };
+
 template<class S>
 class Node
 {
@@ -19,9 +24,12 @@ public:
 	Node() {
 	}
 
+	virtual ~Node() {
+	}
+
 	virtual size_t getNumChildren() const = 0;
 
-	virtual Sp<const Node<S>> getChild(size_t i) const = 0;
+	virtual const Node<S>* getChild(size_t i) const = 0;
 
 	// Return the evaluated value of this node
 	virtual S evaluate() const = 0;
@@ -41,16 +49,50 @@ public:
 
 	virtual uint64_t getHashId() const { return 0; }
 
+	// The tape that created this node and the position of the node in it,
+	// see Tape.h. Nodes not created by a tape have tape id 0.
+	uint32_t getTapeId() const { return mTapeId; }
+
+	uint32_t getId() const { return mId; }
+
 	virtual NodeType getNodeType() const {
 		return REGULAR_NODE;
 	}
 
-	virtual std::string generateCode(const CodeGenerator<S> &generator) const = 0;
+	virtual NodeOp getOp() const = 0;
+
+	// Hash and equality of the data a node holds besides its children
+	// (constant value, variable name, ...). `other` always has the same op.
+	virtual uint64_t getPayloadHash() const { return 0; }
+
+	virtual bool isPayloadEqual(const Node<S> &/* other */) const { return true; }
+
+	// can the children be reordered without changing the value?
+	virtual bool isCommutative() const { return false; }
+
+	// Write the code of this node to `os`
+	virtual void generateCode(std::ostream &os, const CodeGenerator<S> &generator) const = 0;
+
+	std::string generateCode(const CodeGenerator<S> &generator) const {
+		std::ostringstream os;
+		generateCode(os, generator);
+		return os.str();
+	}
 
 	static uint64_t rol(uint64_t x, int d) {
 		return (x << d) | (x >> (64-d));
 	}
 
+	// finalizer of MurmurHash3, spreads every input bit over the whole hash
+	static uint64_t mix(uint64_t x) {
+		x ^= x >> 33;
+		x *= 0xff51afd7ed558ccdULL;
+		x ^= x >> 33;
+		x *= 0xc4ceb9fe1a85ec53ULL;
+		x ^= x >> 33;
+		return x;
+	}
+
 protected:
 	uint64_t computeHashRand() const {
 		return rand();
@@ -66,5 +108,11 @@ protected:
 protected:
 	mutable bool mIsHashValid = false;
 	mutable uint64_t mCachedHash;
+
+private:
+	template<class> friend class Tape;
+
+	uint32_t mTapeId = 0;
+	uint32_t mId = 0;
 };
 }
@@ -3,9 +3,60 @@
 #include "Node.h"
 
 #include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <ostream>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace AutoGen {
 
+// Write a number such that it is read back exactly.
+template<class T>
+void writeNumber(std::ostream &os, const T &value) {
+    std::streamsize precision = os.precision(std::numeric_limits<T>::max_digits10);
+    os << value;
+    os.precision(precision);
+}
+
+// Write a double as C++ literal with the fewest digits that still round-trip,
+// e.g. `0.5` instead of `0.500000`.
+inline void writeNumber(std::ostream &os, const double &value) {
+    if(std::isnan(value)) {
+        os << "NAN";
+        return;
+    }
+    if(std::isinf(value)) {
+        os << (value < 0 ? "-INFINITY" : "INFINITY");
+        return;
+    }
+
+    char buffer[32];
+    int length = 0;
+    for (int precision = 1; precision <= 17; ++precision) {
+        length = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+        if(std::strtod(buffer, nullptr) == value)
+            break;
+    }
+
+    // make it a floating point literal, independent of the locale
+    bool isInteger = true;
+    for (int i = 0; i < length; ++i) {
+        if(buffer[i] == ',')
+            buffer[i] = '.';
+        if(buffer[i] == '.' || buffer[i] == 'e')
+            isInteger = false;
+    }
+    os.write(buffer, length);
+    if(isInteger)
+        os << ".0";
+}
+
 template<class S>
 class NodeConst : public Node<S>
 {
@@ -19,7 +70,7 @@ public:
         return 0;
     }
 
-    virtual Sp<const Node<S>> getChild(size_t i) const {
+    virtual const Node<S>* getChild(size_t i) const {
         throw std::logic_error("NodeConst does not have any children");
     }
 
@@ -33,8 +84,9 @@ public:
         return true;
     }
 
-    virtual std::string generateCode(const CodeGenerator<S> &generator) const {
-        return generator.getVarTypeName() + " " + generator.getVar(this).getVarName() + " = " + std::to_string(mValue);
+    virtual void generateCode(std::ostream &os, const CodeGenerator<S> &generator) const {
+        generator.writeDefinition(os, this);
+        writeNumber(os, mValue);
     }
 
     virtual uint64_t computeHash() const {
@@ -42,6 +94,20 @@ public:
         return hashS(mValue);
     }
 
+    virtual NodeOp getOp() const { return CONST_OP; }
+
+    virtual uint64_t getPayloadHash() const {
+        return this->getHash();
+    }
+
+    // compares the bit patterns, so -0 and 0 are different constants
+    virtual bool isPayloadEqual(const Node<S> &other) const {
+        S otherValue = static_cast<const NodeConst<S>&>(other).mValue;
+        return std::memcmp(&mValue, &otherValue, sizeof(S)) == 0;
+    }
+
+    const S &getValue() const { return mValue; }
+
 private:
     S mValue;
 
@@ -60,7 +126,7 @@ public:
         return 0;
     }
 
-    virtual Sp<const Node<S>> getChild(size_t i) const {
+    virtual const Node<S>* getChild(size_t i) const {
         throw std::logic_error("NodeVar does not have any children");
     }
 
@@ -74,8 +140,9 @@ public:
         return false;
     }
 
-    virtual std::string generateCode(const CodeGenerator<S> &generator) const {
-        return generator.getVarTypeName() + " " + generator.getVar(this).getVarName() + " = " + mVarName;
+    virtual void generateCode(std::ostream &os, const CodeGenerator<S> &generator) const {
+        generator.writeDefinition(os, this);
+        os << mVarName;
     }
 
     virtual NodeType getNodeType() const {
@@ -87,6 +154,18 @@ public:
         return hashS(mVarName);
     }
 
+    virtual NodeOp getOp() const { return VAR_OP; }
+
+    virtual uint64_t getPayloadHash() const {
+        return this->getHash();
+    }
+
+    virtual bool isPayloadEqual(const Node<S> &other) const {
+        return mVarName == static_cast<const NodeVar<S>&>(other).mVarName;
+    }
+
+    const std::string &getVarName() const { return mVarName; }
+
 private:
     std::string mVarName;
 
@@ -96,7 +175,7 @@ template<class S>
 class NodeResult : public Node<S>
 {
 public:
-    NodeResult (const std::string &varName, Sp<const Node<S>> node)
+    NodeResult (const std::string &varName, const Node<S>* node)
         : mResVarName(varName), mNode(node) {
         this->init();
     }
@@ -105,7 +184,7 @@ public:
         return 1;
     }
 
-    virtual Sp<const Node<S>> getChild(size_t i) const {
+    virtual const Node<S>* getChild(size_t i) const {
         assert(i == 0);
         return mNode;
     }
@@ -119,8 +198,8 @@ public:
         return false;
     }
 
-    virtual std::string generateCode(const CodeGenerator<S> &generator) const {
-        return mResVarName + " = " + generator.getVar(mNode.get()).getVarName();
+    virtual void generateCode(std::ostream &os, const CodeGenerator<S> &generator) const {
+        os << mResVarName << " = " << generator.getVar(mNode);
     }
 
     virtual NodeType getNodeType() const {
@@ -132,16 +211,29 @@ public:
         return hashS(mResVarName) +  this->rol(this->mNode->getHash(), 3); // TODO: is this a good hash function?
     }
 
+    virtual NodeOp getOp() const { return RESULT_OP; }
+
+    virtual uint64_t getPayloadHash() const {
+        std::hash<std::string> hashS;
+        return hashS(mResVarName);
+    }
+
+    virtual bool isPayloadEqual(const Node<S> &other) const {
+        return mResVarName == static_cast<const NodeResult<S>&>(other).mResVarName;
+    }
+
+    const std::string &getResVarName() const { return mResVarName; }
+
 private:
     std::string mResVarName;
-    Sp<const Node<S>> mNode;
+    const Node<S>* mNode;
 };
 
 template<class S>
 class NodeNeg : public Node<S>
 {
 public:
-    NodeNeg (Sp<const Node<S>> node)
+    NodeNeg (const Node<S>* node)
         : mNode(node) {
         this->init();
     }
@@ -150,7 +242,7 @@ public:
         return 1;
     }
 
-    virtual Sp<const Node<S>> getChild(size_t i) const {
+    virtual const Node<S>* getChild(size_t i) const {
         assert(i == 0);
         return mNode;
     }
@@ -169,8 +261,9 @@ public:
         return false;
     }
 
-    virtual std::string generateCode(const CodeGenerator<S> &generator) const {
-        return generator.getVarTypeName() + " " + generator.getVar(this).getVarName() + " = -" + generator.getVar(mNode.get()).getVarName();
+    virtual void generateCode(std::ostream &os, const CodeGenerator<S> &generator) const {
+        generator.writeDefinition(os, this);
+        os << "-" << generator.getVar(mNode);
     }
 
     virtual uint64_t computeHash() const {
@@ -179,8 +272,10 @@ public:
 
     virtual uint64_t getHashId() const { return 1; }
 
+    virtual NodeOp getOp() const { return NEG_OP; }
+
 private:
-    Sp<const Node<S>> mNode;
+    const Node<S>* mNode;
 
 };
 
@@ -188,14 +283,14 @@ template<class S>
 class NodeUnaryOperation : public Node<S>
 {
 public:
-    NodeUnaryOperation (Sp<const Node<S>> node)
+    NodeUnaryOperation (const Node<S>* node)
         : mNode(node) {}
 
     virtual size_t getNumChildren() const {
         return 1;
     }
 
-    virtual Sp<const Node<S>> getChild(size_t i) const {
+    virtual const Node<S>* getChild(size_t i) const {
         if(i == 0) return mNode;
 
         throw std::logic_error("NodeUnaryOperation has only two children");
@@ -208,21 +303,21 @@ public:
     virtual uint64_t getHashId() const = 0;
 
 protected:
-    Sp<const Node<S>> mNode;
+    const Node<S>* mNode;
 };
 
 template<class S>
 class NodeBinaryOperation : public Node<S>
 {
 public:
-    NodeBinaryOperation (Sp<const Node<S>> nodeA, Sp<const Node<S>> nodeB)
+    NodeBinaryOperation (const Node<S>* nodeA, const Node<S>* nodeB)
         : mNodeA(nodeA), mNodeB(nodeB){}
 
     virtual size_t getNumChildren() const {
         return 2;
     }
 
-    virtual Sp<const Node<S>> getChild(size_t i) const {
+    virtual const Node<S>* getChild(size_t i) const {
         if(i == 0) return mNodeA;
         if(i == 1) return mNodeB;
 
@@ -230,22 +325,23 @@ public:
     }
 
 protected:
-    Sp<const Node<S>> mNodeA;
-    Sp<const Node<S>> mNodeB;
+    const Node<S>* mNodeA;
+    const Node<S>* mNodeB;
 };
 
 template<class S>
 class NodeBinaryOperationBasic : public NodeBinaryOperation<S>
 {
 public:
-    NodeBinaryOperationBasic (Sp<const Node<S>> nodeA, Sp<const Node<S>> nodeB)
+    NodeBinaryOperationBasic (const Node<S>* nodeA, const Node<S>* nodeB)
         : NodeBinaryOperation<S>(nodeA, nodeB) {}
 
-    virtual std::string generateCode(const CodeGenerator<S> &generator) const {
-        return generator.getVarTypeName() + " " + generator.getVar(this).getVarName() + " = " + generator.getVar(this->mNodeA.get()).getVarName() + " " + getOpName() + " " + generator.getVar(this->mNodeB.get()).getVarName();
+    virtual void generateCode(std::ostream &os, const CodeGenerator<S> &generator) const {
+        generator.writeDefinition(os, this);
+        os << generator.getVar(this->mNodeA) << " " << getOpName() << " " << generator.getVar(this->mNodeB);
     }
 
-    virtual std::string getOpName() const = 0;
+    virtual const char *getOpName() const = 0;
 };
 
 template<class S>
@@ -253,7 +349,7 @@ class NodeAdd : public NodeBinaryOperationBasic<S>
 {
 public:
 
-    NodeAdd(Sp<const Node<S>> nodeA, Sp<const Node<S>> nodeB)
+    NodeAdd(const Node<S>* nodeA, const Node<S>* nodeB)
         : NodeBinaryOperationBasic<S>(nodeA, nodeB) {
         this->init();
     }
@@ -272,13 +368,17 @@ public:
         return false;
     }
 
-    virtual std::string getOpName() const { return "+"; }
+    virtual const char *getOpName() const { return "+"; }
 
     virtual uint64_t computeHash() const {
         return this->rol(this->mNodeA->getHash(), 3) + this->rol(this->mNodeB->getHash(), 3) + getHashId();
     }
 
     virtual uint64_t getHashId() const { return 2; }
+
+    virtual NodeOp getOp() const { return ADD_OP; }
+
+    virtual bool isCommutative() const { return true; }
 };
 
 template<class S>
@@ -286,7 +386,7 @@ class NodeSub : public NodeBinaryOperationBasic<S>
 {
 public:
 
-    NodeSub(Sp<const Node<S>> nodeA, Sp<const Node<S>> nodeB)
+    NodeSub(const Node<S>* nodeA, const Node<S>* nodeB)
         : NodeBinaryOperationBasic<S>(nodeA, nodeB) {
         this->init();
     }
@@ -305,7 +405,7 @@ public:
         return false;
     }
 
-    virtual std::string getOpName() const { return "-"; }
+    virtual const char *getOpName() const { return "-"; }
 
     // order of subtraction matters, thus different rolling shift (3, 5)
     virtual uint64_t computeHash() const {
@@ -313,13 +413,15 @@ public:
     }
 
     virtual uint64_t getHashId() const { return 3; }
+
+    virtual NodeOp getOp() const { return SUB_OP; }
 };
 
 template<class S>
 class NodeMul : public NodeBinaryOperationBasic<S>
 {
 public:
-    NodeMul(Sp<const Node<S>> nodeA, Sp<const Node<S>> nodeB)
+    NodeMul(const Node<S>* nodeA, const Node<S>* nodeB)
         : NodeBinaryOperationBasic<S>(nodeA, nodeB) {
         this->init();
     }
@@ -338,20 +440,148 @@ public:
         return false;
     }
 
-    virtual std::string getOpName() const { return "*"; }
+    virtual const char *getOpName() const { return "*"; }
 
     virtual uint64_t computeHash() const {
         return this->rol(this->mNodeA->getHash(), 3) + this->rol(this->mNodeB->getHash(), 3) + getHashId();
     }
 
     virtual uint64_t getHashId() const { return 4; }
+
+    virtual NodeOp getOp() const { return MUL_OP; }
+
+    virtual bool isCommutative() const { return true; }
+};
+
+// Sum or product of any number of children, see `flatten` (Flatten.h). The
+// children are sorted by hash, so sums of the same children are equal nodes.
+// The code adds or multiplies them as a balanced tree, e.g.
+// `(v1 + v2) + (v3 + v4)`.
+template<class S>
+class NodeNaryOperation : public Node<S>
+{
+public:
+    NodeNaryOperation(std::vector<const Node<S>*> children)
+        : mChildren(std::move(children)) {
+        std::sort(mChildren.begin(), mChildren.end(), [](const Node<S>* a, const Node<S>* b) {
+            if(a->getHash() != b->getHash())
+                return a->getHash() < b->getHash();
+            return std::less<const Node<S>*>()(a, b);
+        });
+    }
+
+    virtual size_t getNumChildren() const {
+        return mChildren.size();
+    }
+
+    virtual const Node<S>* getChild(size_t i) const {
+        if(i < mChildren.size()) return mChildren[i];
+
+        throw std::logic_error("NodeNaryOperation: no such child");
+    }
+
+    virtual S evaluate() const {
+        S value = mChildren[0]->evaluate();
+        for (size_t i = 1; i < mChildren.size(); ++i) {
+            value = apply(value, mChildren[i]->evaluate());
+        }
+        return value;
+    }
+
+    virtual bool evaluate(S &value) const {
+        if(!mChildren[0]->evaluate(value))
+            return false;
+        for (size_t i = 1; i < mChildren.size(); ++i) {
+            S valueChild;
+            if(!mChildren[i]->evaluate(valueChild))
+                return false;
+            value = apply(value, valueChild);
+        }
+        return true;
+    }
+
+    virtual void generateCode(std::ostream &os, const CodeGenerator<S> &generator) const {
+        generator.writeDefinition(os, this);
+        writeBalanced(os, generator, 0, mChildren.size());
+    }
+
+    virtual uint64_t computeHash() const {
+        uint64_t hash = getHashId();
+        for (const Node<S>* child : mChildren) {
+            hash += this->rol(child->getHash(), 3);
+        }
+        return hash;
+    }
+
+    virtual uint64_t getHashId() const = 0;
+
+    virtual bool isCommutative() const { return true; }
+
+    virtual S apply(const S &a, const S &b) const = 0;
+
+    virtual const char *getOpName() const = 0;
+
+private:
+    void writeBalanced(std::ostream &os, const CodeGenerator<S> &generator, size_t begin, size_t end) const {
+        if(end - begin == 1) {
+            os << generator.getVar(mChildren[begin]);
+            return;
+        }
+        size_t middle = (begin + end + 1) / 2;
+        if(middle - begin > 1) os << "(";
+        writeBalanced(os, generator, begin, middle);
+        if(middle - begin > 1) os << ")";
+        os << " " << getOpName() << " ";
+        if(end - middle > 1) os << "(";
+        writeBalanced(os, generator, middle, end);
+        if(end - middle > 1) os << ")";
+    }
+
+protected:
+    std::vector<const Node<S>*> mChildren;
+};
+
+template<class S>
+class NodeSum : public NodeNaryOperation<S>
+{
+public:
+    NodeSum(std::vector<const Node<S>*> children)
+        : NodeNaryOperation<S>(std::move(children)) {
+        this->init();
+    }
+
+    virtual S apply(const S &a, const S &b) const { return a + b; }
+
+    virtual const char *getOpName() const { return "+"; }
+
+    virtual uint64_t getHashId() const { return 11; }
+
+    virtual NodeOp getOp() const { return SUM_OP; }
+};
+
+template<class S>
+class NodeProduct : public NodeNaryOperation<S>
+{
+public:
+    NodeProduct(std::vector<const Node<S>*> children)
+        : NodeNaryOperation<S>(std::move(children)) {
+        this->init();
+    }
+
+    virtual S apply(const S &a, const S &b) const { return a * b; }
+
+    virtual const char *getOpName() const { return "*"; }
+
+    virtual uint64_t getHashId() const { return 12; }
+
+    virtual NodeOp getOp() const { return PRODUCT_OP; }
 };
 
 template<class S>
 class NodeDiv : public NodeBinaryOperationBasic<S>
 {
 public:
-    NodeDiv(Sp<const Node<S>> nodeA, Sp<const Node<S>> nodeB)
+    NodeDiv(const Node<S>* nodeA, const Node<S>* nodeB)
         : NodeBinaryOperationBasic<S>(nodeA, nodeB) {
         this->init();
     }
@@ -370,20 +600,22 @@ public:
         return false;
     }
 
-    virtual std::string getOpName() const { return "/"; }
+    virtual const char *getOpName() const { return "/"; }
 
     virtual uint64_t computeHash() const {
         return this->rol(this->mNodeA->getHash(), 3) + this->rol(this->mNodeB->getHash(), 5) + getHashId();
     }
 
     virtual uint64_t getHashId() const { return 5; }
+
+    virtual NodeOp getOp() const { return DIV_OP; }
 };
 
 template<class S>
 class NodePow : public NodeBinaryOperation<S>
 {
 public:
-    NodePow(Sp<const Node<S>> nodeA, Sp<const Node<S>> nodeB)
+    NodePow(const Node<S>* nodeA, const Node<S>* nodeB)
         : NodeBinaryOperation<S>(nodeA, nodeB) {
         this->init();
     }
@@ -402,24 +634,25 @@ public:
         return false;
     }
 
-    virtual std::string generateCode(const CodeGenerator<S> &generator) const {
-        return generator.getVarTypeName() + " " + generator.getVar(this).getVarName()
-                + " = pow(" + generator.getVar(this->mNodeA.get()).getVarName()
-                + ", " + generator.getVar(this->mNodeB.get()).getVarName() + ")";
+    virtual void generateCode(std::ostream &os, const CodeGenerator<S> &generator) const {
+        generator.writeDefinition(os, this);
+        os << "pow(" << generator.getVar(this->mNodeA) << ", " << generator.getVar(this->mNodeB) << ")";
     }
 
     virtual uint64_t computeHash() const {
         return this->rol(this->mNodeA->getHash(), 3) + this->rol(this->mNodeB->getHash(), 5) + getHashId();
     }
 
-    virtual uint64_t getHashId() const { return 5; }
+    virtual uint64_t getHashId() const { return 6; }
+
+    virtual NodeOp getOp() const { return POW_OP; }
 };
 
 template<class S>
 class NodeSqrt : public NodeUnaryOperation<S>
 {
 public:
-    NodeSqrt (Sp<const Node<S>> node)
+    NodeSqrt (const Node<S>* node)
         : NodeUnaryOperation<S>(node) {}
 
     virtual S evaluate() const {
@@ -436,18 +669,21 @@ public:
         return false;
     }
 
-    virtual std::string generateCode(const CodeGenerator<S> &generator) const {
-        return generator.getVarTypeName() + " " + generator.getVar(this).getVarName() + " = sqrt(" + generator.getVar(NodeUnaryOperation<S>::mNode.get()).getVarName() + ")";
+    virtual void generateCode(std::ostream &os, const CodeGenerator<S> &generator) const {
+        generator.writeDefinition(os, this);
+        os << "sqrt(" << generator.getVar(NodeUnaryOperation<S>::mNode) << ")";
     }
 
     virtual uint64_t getHashId() const { return 7; }
+
+    virtual NodeOp getOp() const { return SQRT_OP; }
 };
 
 template<class S>
 class NodeCos : public NodeUnaryOperation<S>
 {
 public:
-    NodeCos (Sp<const Node<S>> node)
+    NodeCos (const Node<S>* node)
         : NodeUnaryOperation<S>(node){}
 
     virtual S evaluate() const {
@@ -464,18 +700,21 @@ public:
         return false;
     }
 
-    virtual std::string generateCode(const CodeGenerator<S> &generator) const {
-        return generator.getVarTypeName() + " " + generator.getVar(this).getVarName() + " = cos(" + generator.getVar(NodeUnaryOperation<S>::mNode.get()).getVarName() + ")";
+    virtual void generateCode(std::ostream &os, const CodeGenerator<S> &generator) const {
+        generator.writeDefinition(os, this);
+        os << "cos(" << generator.getVar(NodeUnaryOperation<S>::mNode) << ")";
     }
 
     virtual uint64_t getHashId() const { return 8; }
+
+    virtual NodeOp getOp() const { return COS_OP; }
 };
 
 template<class S>
 class NodeSin : public NodeUnaryOperation<S>
 {
 public:
-    NodeSin (Sp<const Node<S>> node)
+    NodeSin (const Node<S>* node)
         : NodeUnaryOperation<S>(node){}
 
     virtual S evaluate() const {
@@ -492,18 +731,21 @@ public:
         return false;
     }
 
-    virtual std::string generateCode(const CodeGenerator<S> &generator) const {
-        return generator.getVarTypeName() + " " + generator.getVar(this).getVarName() + " = sin(" + generator.getVar(NodeUnaryOperation<S>::mNode.get()).getVarName() + ")";
+    virtual void generateCode(std::ostream &os, const CodeGenerator<S> &generator) const {
+        generator.writeDefinition(os, this);
+        os << "sin(" << generator.getVar(NodeUnaryOperation<S>::mNode) << ")";
     }
 
     virtual uint64_t getHashId() const { return 9; }
+
+    virtual NodeOp getOp() const { return SIN_OP; }
 };
 
 template<class S>
 class NodeAcos : public NodeUnaryOperation<S>
 {
 public:
-    NodeAcos (Sp<const Node<S>> node)
+    NodeAcos (const Node<S>* node)
         : NodeUnaryOperation<S>(node){}
 
     virtual S evaluate() const {
@@ -520,11 +762,14 @@ public:
         return false;
     }
 
-    virtual std::string generateCode(const CodeGenerator<S> &generator) const {
-        return generator.getVarTypeName() + " " + generator.getVar(this).getVarName() + " = acos(" + generator.getVar(NodeUnaryOperation<S>::mNode.get()).getVarName() + ")";
+    virtual void generateCode(std::ostream &os, const CodeGenerator<S> &generator) const {
+        generator.writeDefinition(os, this);
+        os << "acos(" << generator.getVar(NodeUnaryOperation<S>::mNode) << ")";
     }
 
-    virtual uint64_t getHashId() const { return 9; }
+    virtual uint64_t getHashId() const { return 10; }
+
+    virtual NodeOp getOp() const { return ACOS_OP; }
 };
 
 } // namespace AutoGen
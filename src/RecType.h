@@ -1,7 +1,9 @@
 #pragma once
 
 #include "NodeTypes.h"
+#include "Tape.h"
 
+#include <cmath>
 #include <string>
 
 namespace AutoGen {
@@ -12,43 +14,50 @@ class RecType
 public:
     RecType() {}
 
-    RecType(const S &value) {
-        mNode = Sp<Node<S>>(new NodeConst<S>(value));
+    RecType(const S &value)
+        : mNode(Tape<S>::active().template create<NodeConst<S>>(value)), mReference() {
     }
 
-    RecType(Sp<const Node<S>> node)
-        : mNode(node) {
+    explicit RecType(const Node<S> &node)
+        : mNode(&node), mReference() {
+    }
 
+    RecType(const std::string &varName)
+        : mNode(Tape<S>::active().template create<NodeVar<S>>(varName)), mReference() {
     }
 
-    RecType(const std::string &varName) {
-        mNode = Sp<Node<S> >(new NodeVar<S>(varName));
+    // record a new node of type N on the active tape
+    template<class N, class... Args>
+    static RecType<S> record(Args&&... args) {
+        return RecType<S>(*Tape<S>::active().template create<N>(std::forward<Args>(args)...));
     }
 
     RecType<S> operator-() const {
-        return RecType(Sp<Node<S>>(new NodeNeg<S>(mNode)));
+        S value;
+        if(mNode->evaluate(value))
+            return RecType<S>(-value);
+        return record<NodeNeg<S>>(mNode);
     }
 
     RecType<S> operator+(const RecType<S> &other) const {
-
-        Sp<const Node<S>> node(new NodeAdd<S>(mNode, other.mNode));
-
-        S value;
+        S valueA, valueB;
+        bool isConstA = mNode->evaluate(valueA);
+        bool isConstB = other.mNode->evaluate(valueB);
 
         // constant expression?
-        if(node->evaluate(value)){
-            return RecType<S>(Sp<const Node<S>>(new NodeConst<S>(value)));
+        if(isConstA && isConstB){
+            return RecType<S>(valueA + valueB);
         }
         // 0+x = x
-        if(mNode->evaluate(value) && (value == 0 || value == -0)){
+        if(isConstA && (valueA == 0 || valueA == -0)){
             return other;
         }
         // x+0 = x
-        if(other.mNode->evaluate(value) && (value == 0)){
-            return RecType<S>(this->mNode);
+        if(isConstB && (valueB == 0)){
+            return *this;
         }
 
-        return RecType<S>(node);
+        return record<NodeAdd<S>>(mNode, other.mNode);
     }
 
     RecType<S> &operator+=(const RecType<S> &other) {
@@ -57,27 +66,28 @@ public:
     }
 
     RecType<S> operator-(const RecType<S> &other) const {
-        Sp<const Node<S>> node(new NodeSub<S>(mNode, other.mNode));
+        S valueA, valueB;
+        bool isConstA = mNode->evaluate(valueA);
+        bool isConstB = other.mNode->evaluate(valueB);
 
-        S value;
         // constant expression?
-        if(node->evaluate(value)){
-            return RecType<S>(Sp<const Node<S>>(new NodeConst<S>(value)));
+        if(isConstA && isConstB){
+            return RecType<S>(valueA - valueB);
         }
-        // x-x = 0
-        if(mNode->getHash() == other.mNode->getHash()){
-            return RecType<S>(Sp<const Node<S>>(new NodeConst<S>(0)));
+        // x-x = 0, only for the same node, equal hashes do not mean equal values
+        if(mNode == other.mNode){
+            return RecType<S>(S(0));
         }
         // 0-x = -x
-        if(mNode->evaluate(value) && (value == 0 || value == -0)){
-            return RecType<S>(Sp<const Node<S>>(new NodeNeg<S>(other.mNode)));
+        if(isConstA && (valueA == 0 || valueA == -0)){
+            return record<NodeNeg<S>>(other.mNode);
         }
         // x-0 = x
-        if(other.mNode->evaluate(value) && (value == 0 || value == -0)){
-            return RecType<S>(mNode);
+        if(isConstB && (valueB == 0 || valueB == -0)){
+            return *this;
         }
 
-        return RecType<S>(node);
+        return record<NodeSub<S>>(mNode, other.mNode);
     }
 
     RecType<S> &operator-=(const RecType<S> &other) {
@@ -86,33 +96,34 @@ public:
     }
 
     RecType<S> operator*(const RecType<S> &other) const {
-        Sp<const Node<S>> node(new NodeMul<S>(mNode, other.mNode));
+        S valueA, valueB;
+        bool isConstA = mNode->evaluate(valueA);
+        bool isConstB = other.mNode->evaluate(valueB);
 
-        S value;
         // evaluatable?
-        if(node->evaluate(value)) {
-            return RecType<S>(Sp<const Node<S>>(new NodeConst<S>(value)));
+        if(isConstA && isConstB) {
+            return RecType<S>(valueA * valueB);
         }
         // 0*x or 0*x = 0
-        if((mNode->evaluate(value) && value == 0) || (other.mNode->evaluate(value) && value == 0)){
-            return RecType<S>(Sp<const Node<S>>(new NodeConst<S>(0)));
+        if((isConstA && valueA == 0) || (isConstB && valueB == 0)){
+            return RecType<S>(S(0));
         }
         // 1*x = x
-        if(mNode->evaluate(value) && value == 1){
-            return RecType<S>(other.mNode);
+        if(isConstA && valueA == 1){
+            return other;
         }
         // x*1 = x
-        if(other.mNode->evaluate(value) && value == 1){
-            return RecType<S>(mNode);
+        if(isConstB && valueB == 1){
+            return *this;
         }
         // -1*x = -x
-        if(mNode->evaluate(value) && value == -1)
-            return RecType<S>(Sp<const Node<S>>(new NodeNeg<S>(other.mNode)));
+        if(isConstA && valueA == -1)
+            return record<NodeNeg<S>>(other.mNode);
         // x*-1 = -x
-        if(other.mNode->evaluate(value) && value == -1)
-            return RecType<S>(Sp<const Node<S>>(new NodeNeg<S>(mNode)));
+        if(isConstB && valueB == -1)
+            return record<NodeNeg<S>>(mNode);
 
-        return RecType<S>(node);
+        return record<NodeMul<S>>(mNode, other.mNode);
     }
 
     RecType<S> &operator*=(const RecType<S> &other) {
@@ -121,24 +132,25 @@ public:
     }
 
     RecType<S> operator/(const RecType<S> &other) const {
-        Sp<const Node<S>> node(new NodeDiv<S>(mNode, other.mNode));
+        S valueA, valueB;
+        bool isConstA = mNode->evaluate(valueA);
+        bool isConstB = other.mNode->evaluate(valueB);
 
-        S value;
         // is constant expression?
-        if(node->evaluate(value)) {
-            return RecType<S>(Sp<const Node<S>>(new NodeConst<S>(value)));
+        if(isConstA && isConstB) {
+            return RecType<S>(valueA / valueB);
         }
         // 0/x = 0
-        if(mNode->evaluate(value) && value == 0){
-            return RecType<S>(Sp<const Node<S>>(new NodeConst<S>(0)));
+        if(isConstA && valueA == 0){
+            return RecType<S>(S(0));
         }
         // TODO: what to do when divided by 0?
         // x/1 = x
-        else if(other.mNode->evaluate(value) && value == 1){
-            return RecType<S>(mNode);
+        else if(isConstB && valueB == 1){
+            return *this;
         }
 
-        return RecType<S>(node);
+        return record<NodeDiv<S>>(mNode, other.mNode);
     }
 
     RecType<S> &operator/=(const RecType<S> &other) {
@@ -146,14 +158,14 @@ public:
         return *this;
     }
 
-    Sp<const Node<S>> getNode() const {
+    const Node<S>* getNode() const {
         assert(mNode != nullptr);
         return mNode;
     }
 
     std::string generateCode(std::string resVarName = "res") const {
         CodeGenerator<S> generator;
-        Node<S>* nodeRes = new NodeResult<S>(resVarName, mNode);
+        const Node<S>* nodeRes = Tape<S>::active().template create<NodeResult<S>>(resVarName, mNode);
 
         generator.collectNodes(nodeRes);
         generator.sortNodes();
@@ -162,13 +174,15 @@ public:
     }
 
     void addToGeneratorAsResult(CodeGenerator<S> &generator, const std::string &resVarName) {
-        Node<S>* nodeRes = new NodeResult<S>(resVarName, mNode);
+        const Node<S>* nodeRes = Tape<S>::active().template create<NodeResult<S>>(resVarName, mNode);
 
         generator.collectNodes(nodeRes);
     }
 
 private:
-    std::shared_ptr<const Node<S>> mNode;
+    const Node<S>* mNode = nullptr;
+    // keeps the default tape from being cleared, see Tape.h
+    typename Tape<S>::Reference mReference{nullptr};
 };
 
 template<class S>
@@ -193,28 +207,53 @@ RecType<S> operator/(S value, const RecType<S> &other) {
 
 template<class S>
 RecType<S> sqrt(const RecType<S> &other) {
-    return RecType<S>(Sp<const Node<S>>(new NodeSqrt<S>(other.getNode())));
+    S value;
+    if(other.getNode()->evaluate(value)) {
+        using std::sqrt;
+        return RecType<S>(sqrt(value));
+    }
+    return RecType<S>::template record<NodeSqrt<S>>(other.getNode());
 }
 
 template<class S>
 RecType<S> cos(const RecType<S> &other) {
-    return RecType<S>(Sp<const Node<S>>(new NodeCos<S>(other.getNode())));
+    S value;
+    if(other.getNode()->evaluate(value)) {
+        using std::cos;
+        return RecType<S>(cos(value));
+    }
+    return RecType<S>::template record<NodeCos<S>>(other.getNode());
 }
 
 template<class S>
 RecType<S> sin(const RecType<S> &other) {
-    return RecType<S>(Sp<const Node<S>>(new NodeSin<S>(other.getNode())));
+    S value;
+    if(other.getNode()->evaluate(value)) {
+        using std::sin;
+        return RecType<S>(sin(value));
+    }
+    return RecType<S>::template record<NodeSin<S>>(other.getNode());
 }
 
 template<class S>
 RecType<S> acos(const RecType<S> &other) {
-    return RecType<S>(Sp<const Node<S>>(new NodeAcos<S>(other.getNode())));
+    S value;
+    if(other.getNode()->evaluate(value)) {
+        using std::acos;
+        return RecType<S>(acos(value));
+    }
+    return RecType<S>::template record<NodeAcos<S>>(other.getNode());
 }
 
 
 template<class S>
 RecType<S> pow(const RecType<S> &a, const RecType<S> &b) {
-    return RecType<S>(Sp<const Node<S>>(new NodePow<S>(a.getNode(), b.getNode())));
+    S valueA, valueB;
+    if(a.getNode()->evaluate(valueA) && b.getNode()->evaluate(valueB)) {
+        using std::pow;
+        return RecType<S>(pow(valueA, valueB));
+    }
+    return RecType<S>::template record<NodePow<S>>(a.getNode(), b.getNode());
 }
 
 template<class S>
@@ -226,8 +265,7 @@ RecType<S> pow(const RecType<S> &a, S b) {
     if(b == 0)
         return 1;
 
-    Sp<const Node<S>> nodeB(new NodeConst<S>(b));
-    return RecType<S>(Sp<const Node<S>>(new NodePow<S>(a.getNode(), nodeB)));
+    return pow(a, RecType<S>(b));
 }
 
 } // namespace AutoGen
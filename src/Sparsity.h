@@ -0,0 +1,172 @@
+#pragma once
+
+#include "Adjoint.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace AutoGen {
+
+/*
+ * Sparsity
+ * ========
+ *
+ * Energies built from `VarListX` segments only couple a few variables, most
+ * entries of their Jacobians and Hessians are structurally zero. `sparsity`
+ * finds the nonzero entries from the dependencies in the recorded graph, and
+ * `jacobian` records only those:
+ * ```
+ * SparsityPattern pattern;
+ * std::vector<RecType<double>> values = jacobian(outputs, inputs, pattern);
+ * // values[k] is the entry (pattern.getRow(k), pattern.getCol(k))
+ * ```
+ *
+ * Columns that have no row in common get the same color and are seeded
+ * together in one direction of the forward sweep (Curtis, Powell, Reid), so
+ * the cost scales with the number of colors instead of the number of inputs.
+ * For a Hessian, pass the gradient as outputs and use `symmetricJacobian`,
+ * which records the upper triangle and mirrors it.
+ */
+
+// Nonzero entries of a matrix, sorted by row and then by column.
+class SparsityPattern
+{
+public:
+	SparsityPattern(size_t numRows = 0, size_t numCols = 0)
+		: mNumRows(numRows), mNumCols(numCols), mRowStart(1, 0) {
+	}
+
+	// add an entry, entries have to be added in order
+	void add(size_t row, size_t col) {
+		while(mRowStart.size() <= row + 1)
+			mRowStart.push_back(mEntries.size());
+		mEntries.push_back(std::make_pair(uint32_t(row), uint32_t(col)));
+		mRowStart.back() = mEntries.size();
+	}
+
+	size_t getNumRows() const { return mNumRows; }
+	size_t getNumCols() const { return mNumCols; }
+	size_t getNumNonZeros() const { return mEntries.size(); }
+
+	size_t getRow(size_t k) const { return mEntries[k].first; }
+	size_t getCol(size_t k) const { return mEntries[k].second; }
+
+	// position of entry (row, col), or -1 if it is zero
+	int64_t find(size_t row, size_t col) const {
+		if(row + 1 >= mRowStart.size())
+			return -1;
+		for (size_t k = mRowStart[row]; k < mRowStart[row+1]; ++k) {
+			if(mEntries[k].second == col)
+				return k;
+		}
+		return -1;
+	}
+
+	// Color the columns such that columns of the same color have no row in
+	// common, greedily in order. Returns the number of colors.
+	size_t colorColumns(std::vector<size_t> &colors) const {
+		std::vector<std::vector<uint32_t>> rowsOfCol(mNumCols);
+		for (const std::pair<uint32_t, uint32_t> &entry : mEntries) {
+			rowsOfCol[entry.second].push_back(entry.first);
+		}
+
+		const size_t none = size_t(-1);
+		colors.assign(mNumCols, none);
+		std::vector<size_t> forbiddenFor(mNumCols, none); // color -> column it is forbidden for
+		size_t numColors = 0;
+		for (size_t col = 0; col < mNumCols; ++col) {
+			for (uint32_t row : rowsOfCol[col]) {
+				for (size_t k = mRowStart[row]; k < mRowStart[row+1]; ++k) {
+					size_t color = colors[mEntries[k].second];
+					if(color != none)
+						forbiddenFor[color] = col;
+				}
+			}
+			size_t color = 0;
+			while(color < numColors && forbiddenFor[color] == col)
+				color++;
+			colors[col] = color;
+			numColors = std::max(numColors, color + 1);
+		}
+		return numColors;
+	}
+
+private:
+	size_t mNumRows, mNumCols;
+	std::vector<size_t> mRowStart;
+	std::vector<std::pair<uint32_t, uint32_t>> mEntries;
+};
+
+// The structural nonzeros of d outputs / d inputs, from the inputs every
+// output depends on.
+template<class S>
+SparsityPattern sparsity(const std::vector<RecType<S>> &outputs, const std::vector<RecType<S>> &inputs) {
+	SortedGraph<S> graph(outputs);
+	std::vector<int64_t> inputIndices = graph.findInputs(inputs);
+
+	// a bitset of inputs for every node
+	const size_t numWords = (inputs.size() + 63) / 64;
+	std::vector<uint64_t> dependencies(graph.size()*numWords, 0);
+	for (size_t k = 0; k < graph.size(); ++k) {
+		uint64_t *bits = &dependencies[k*numWords];
+		if(inputIndices[k] >= 0)
+			bits[inputIndices[k] / 64] |= uint64_t(1) << (inputIndices[k] % 64);
+		const Node<S>* node = graph.getNode(k);
+		for (size_t i = 0; i < node->getNumChildren(); ++i) {
+			const uint64_t *childBits = &dependencies[graph.findIndex(node->getChild(i))*numWords];
+			for (size_t w = 0; w < numWords; ++w) {
+				bits[w] |= childBits[w];
+			}
+		}
+	}
+
+	SparsityPattern pattern(outputs.size(), inputs.size());
+	for (size_t o = 0; o < outputs.size(); ++o) {
+		const uint64_t *bits = &dependencies[graph.findIndex(outputs[o].getNode())*numWords];
+		for (size_t i = 0; i < inputs.size(); ++i) {
+			if(bits[i / 64] & (uint64_t(1) << (i % 64)))
+				pattern.add(o, i);
+		}
+	}
+	return pattern;
+}
+
+// The nonzero entries of d outputs / d inputs, in the order of `pattern`.
+template<class S>
+std::vector<RecType<S>> jacobian(const std::vector<RecType<S>> &outputs, const std::vector<RecType<S>> &inputs, SparsityPattern &pattern) {
+	pattern = sparsity(outputs, inputs);
+
+	// one direction per color of columns
+	std::vector<size_t> colors;
+	size_t numColors = pattern.colorColumns(colors);
+	std::vector<std::vector<S>> seeds(numColors, std::vector<S>(inputs.size(), S(0)));
+	for (size_t i = 0; i < inputs.size(); ++i) {
+		seeds[colors[i]][i] = S(1);
+	}
+	std::vector<std::vector<RecType<S>>> compressed = tangents(outputs, inputs, seeds);
+
+	std::vector<RecType<S>> values;
+	values.reserve(pattern.getNumNonZeros());
+	for (size_t k = 0; k < pattern.getNumNonZeros(); ++k) {
+		values.push_back(compressed[colors[pattern.getCol(k)]][pattern.getRow(k)]);
+	}
+	return values;
+}
+
+// Like `jacobian`, for a symmetric matrix like a Hessian: an entry below the
+// diagonal is the same value as the one mirrored above.
+template<class S>
+std::vector<RecType<S>> symmetricJacobian(const std::vector<RecType<S>> &outputs, const std::vector<RecType<S>> &inputs, SparsityPattern &pattern) {
+	std::vector<RecType<S>> values = jacobian(outputs, inputs, pattern);
+	for (size_t k = 0; k < pattern.getNumNonZeros(); ++k) {
+		if(pattern.getCol(k) >= pattern.getRow(k))
+			continue;
+		int64_t mirrored = pattern.find(pattern.getCol(k), pattern.getRow(k));
+		if(mirrored >= 0)
+			values[k] = values[mirrored];
+	}
+	return values;
+}
+
+} // namespace AutoGen
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "RecType.h"
+#include "Adjoint.h"
+#include "CodeGenerator.h"
+#include "Flatten.h"
+
+#include <cmath>
+#include <vector>
+
+namespace AutoGen {
+
+/*
+ * Strength reduction
+ * ==================
+ *
+ * `reduceStrength` records values again with expensive operations replaced
+ * by cheaper ones:
+ * - `pow(x, n)` with an integer n is a chain of multiplications by repeated
+ *   squaring, `pow(x, 5)` is `x2 = x*x; x4 = x2*x2; x4*x`, a negative n the
+ *   reciprocal of it,
+ * - `pow(x, n + 0.5)` is `pow(x, n)*sqrt(x)`,
+ * - divisions by the same denominator multiply by one reciprocal,
+ *   `a/d + b/d` is `r = 1/d; a*r + b*r`.
+ * ```
+ * std::vector<RecType<double>> values = reduceStrength(ddREntries);
+ * ```
+ * Exponents above `maxExponent` stay `pow`. Multiplying by a reciprocal
+ * rounds twice, so results can differ from the divisions in the last bits.
+ */
+
+// x^n for n > 0 by repeated squaring.
+template<class S>
+RecType<S> recordPower(const RecType<S> &x, uint32_t n) {
+	RecType<S> result, square = x;
+	bool hasResult = false;
+	while(n > 0) {
+		if(n & 1) {
+			result = hasResult ? result*square : square;
+			hasResult = true;
+		}
+		n >>= 1;
+		if(n > 0)
+			square = square*square;
+	}
+	return result;
+}
+
+template<class S>
+std::vector<RecType<S>> reduceStrength(const std::vector<RecType<S>> &values, uint32_t maxExponent = 32) {
+	typedef RecType<S> R;
+	SortedGraph<S> graph(values);
+
+	// number of divisions by every denominator, nodes computing the same
+	// value are counted as one
+	CodeGenerator<S> generator;
+	for (const R &value : values) {
+		generator.collectNodes(value.getNode());
+	}
+	auto key = [&](const Node<S>* node) {
+		return size_t(graph.findIndex(generator.getHashedNode(node)));
+	};
+	std::vector<uint32_t> numDivisions(graph.size(), 0);
+	for (size_t k = 0; k < graph.size(); ++k) {
+		const Node<S>* node = graph.getNode(k);
+		if(node->getOp() == DIV_OP && key(node) == k)
+			numDivisions[key(node->getChild(1))]++;
+	}
+
+	std::vector<R> reciprocals(graph.size());
+	std::vector<bool> hasReciprocal(graph.size(), false);
+	return rewrite(values, [&](const Node<S>* node, size_t, const std::vector<R> &children) {
+		using std::floor; using std::fabs;
+		switch (node->getOp()) {
+		case POW_OP: {
+			S exponent;
+			if(!node->getChild(1)->evaluate(exponent))
+				break;
+			S magnitude = fabs(exponent);
+			S whole = floor(magnitude);
+			bool isHalf = (magnitude - whole == S(0.5));
+			if(!(magnitude - whole == S(0) || isHalf) || magnitude > S(maxExponent))
+				break;
+
+			R power(S(1));
+			if(whole > S(0))
+				power = recordPower(children[0], uint32_t(whole));
+			if(isHalf)
+				power = power*sqrt(children[0]);
+			return (exponent < S(0)) ? R(S(1))/power : power;
+		}
+		case DIV_OP: {
+			size_t denominator = key(node->getChild(1));
+			if(numDivisions[denominator] < 2)
+				break;
+			if(!hasReciprocal[denominator]) {
+				reciprocals[denominator] = R(S(1))/children[1];
+				hasReciprocal[denominator] = true;
+			}
+			return children[0]*reciprocals[denominator];
+		}
+		default:
+			break;
+		}
+
+		if(node->getNumChildren() == 0)
+			return R(*node);
+		return recordOp(node->getOp(), children);
+	});
+}
+
+} // namespace AutoGen
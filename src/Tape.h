@@ -0,0 +1,423 @@
+#pragma once
+
+#include "Node.h"
+#include "FlatHashTable.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace AutoGen {
+
+/*
+ * Tape
+ * ====
+ *
+ * A tape owns the nodes of recorded expression graphs. Nodes are placed into
+ * large contiguous blocks and are destroyed all at once when the tape is
+ * cleared or goes out of scope, instead of being allocated and reference
+ * counted one by one.
+ *
+ * `RecType` records into the active tape of the current thread. By default
+ * this is the thread's default tape. Every `RecType` and `CodeGenerator`
+ * holds a `Reference` to the default tape of the thread that created it, and
+ * once the last one is gone, the default tape is cleared. So a recording is
+ * freed once nothing refers to it anymore, as long as no raw node pointers
+ * are kept beyond it. Recording into a tape of its own frees a recording at
+ * a well defined point, and without waiting for unrelated `RecType`s:
+ * ```
+ * {
+ *		Tape<double> tape;
+ *		Tape<double>::Scope scope(tape);
+ *		RecType<double> x("x[0]");
+ *		std::string code = (x*x).generateCode("y[0]");
+ * } // all nodes are freed here
+ * ```
+ *
+ * A `RecType` must not be used anymore once its tape has been cleared.
+ *
+ * Hash-consing
+ * ------------
+ * With hash-consing enabled (`setHashConsing(true)` or a `HashConsing` scope),
+ * the tape keeps a unique table of its nodes keyed by (op, children, payload).
+ * Creating a node that already exists returns the existing node, so repeated
+ * recordings of the same subexpression share one node:
+ * ```
+ * Tape<double>::HashConsing hashConsing(Tape<double>::active());
+ * RecType<double> x("x[0]");
+ * assert((x*x).getNode() == (x*x).getNode());
+ * ```
+ */
+template<class S>
+class Tape
+{
+public:
+
+	// Makes a tape the active tape of the current thread while in scope.
+	class Scope
+	{
+	public:
+		Scope(Tape<S> &tape)
+			: mPrevious(current()) {
+			current() = &tape;
+		}
+
+		~Scope() {
+			current() = mPrevious;
+		}
+
+		Scope(const Scope &) = delete;
+		Scope &operator=(const Scope &) = delete;
+
+	private:
+		Tape<S> *mPrevious;
+	};
+
+	// Enables (or disables) hash-consing of a tape while in scope.
+	class HashConsing
+	{
+	public:
+		HashConsing(Tape<S> &tape, bool enable = true)
+			: mTape(tape), mPrevious(tape.isHashConsing()) {
+			mTape.setHashConsing(enable);
+		}
+
+		~HashConsing() {
+			mTape.setHashConsing(mPrevious);
+		}
+
+		HashConsing(const HashConsing &) = delete;
+		HashConsing &operator=(const HashConsing &) = delete;
+
+	private:
+		Tape<S> &mTape;
+		bool mPrevious;
+	};
+
+	// Keeps the default tape of the thread that created it from being
+	// cleared. An empty reference keeps nothing.
+	class Reference
+	{
+	public:
+		Reference()
+			: mTape(&defaultTape()) {
+			mTape->mNumReferences.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		Reference(std::nullptr_t)
+			: mTape(nullptr) {
+		}
+
+		Reference(const Reference &other)
+			: mTape(other.mTape) {
+			if(mTape)
+				mTape->mNumReferences.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		Reference(Reference &&other)
+			: mTape(other.mTape) {
+			other.mTape = nullptr;
+		}
+
+		Reference &operator=(const Reference &other) {
+			if(other.mTape)
+				other.mTape->mNumReferences.fetch_add(1, std::memory_order_relaxed);
+			release();
+			mTape = other.mTape;
+			return *this;
+		}
+
+		Reference &operator=(Reference &&other) {
+			if(this != &other) {
+				release();
+				mTape = other.mTape;
+				other.mTape = nullptr;
+			}
+			return *this;
+		}
+
+		~Reference() {
+			release();
+		}
+
+	private:
+		void release() {
+			if(mTape && mTape->mNumReferences.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				mTape->reclaim();
+			mTape = nullptr;
+		}
+
+		Tape<S> *mTape;
+	};
+
+	Tape(size_t firstBlockSize = 64*1024)
+		: mId(nextId()), mNextBlockSize(firstBlockSize) {
+	}
+
+	~Tape() {
+		clear();
+	}
+
+	Tape(const Tape &) = delete;
+	Tape &operator=(const Tape &) = delete;
+
+	// Construct a new node of type N in this tape. With hash-consing enabled,
+	// an existing node with the same op, children and payload is returned
+	// instead.
+	template<class N, class... Args>
+	const N* create(Args&&... args) {
+		Mark mark = getMark();
+		void *memory = allocate(sizeof(N), alignof(N));
+		N *node = new (memory) N(std::forward<Args>(args)...);
+
+		if(mHashConsing) {
+			uint64_t hash = shallowHash(node);
+			const Node<S>* const *same = mUniqueNodes.find(hash, [node](const Node<S> *other) {
+				return isShallowEqual(node, other);
+			});
+			if(same) {
+				// we already have this node, undo the allocation
+				node->~N();
+				rollback(mark);
+				// nodes with the same op are of the same class
+				return static_cast<const N*>(*same);
+			}
+			mUniqueNodes.insert(hash, node);
+		}
+
+		node->mTapeId = mId;
+		node->mId = uint32_t(mNodes.size());
+		mNodes.push_back(node);
+		return node;
+	}
+
+	void setHashConsing(bool enable) {
+		mHashConsing = enable;
+	}
+
+	bool isHashConsing() const { return mHashConsing; }
+
+	// Destroy all nodes and release all blocks.
+	void clear() {
+		mUniqueNodes.clear();
+		for (size_t i = mNodes.size(); i > 0; --i) {
+			mNodes[i-1]->~Node<S>();
+		}
+		mNodes.clear();
+
+		for (Block &block : mBlocks) {
+			std::free(block.data);
+		}
+		mBlocks.clear();
+		// nodes recorded from now on are not mistaken for the destroyed ones
+		mId = nextId();
+	}
+
+	// Identifies this tape until it is cleared, never 0.
+	uint32_t getId() const { return mId; }
+
+	size_t getNumNodes() const { return mNodes.size(); }
+
+	size_t getNumBlocks() const { return mBlocks.size(); }
+
+	size_t getNumBytes() const {
+		size_t bytes = 0;
+		for (const Block &block : mBlocks) {
+			bytes += block.size;
+		}
+		return bytes;
+	}
+
+	// The tape `RecType` currently records into.
+	static Tape<S> &active() {
+		if(current())
+			return *current();
+		return defaultTape();
+	}
+
+	size_t getNumReferences() const { return mNumReferences.load(std::memory_order_relaxed); }
+
+private:
+	// The default tape of this thread. It outlives the thread while
+	// references to it are left, the last one deletes it.
+	static Tape<S> &defaultTape() {
+		struct Owner
+		{
+			Tape<S> *tape = new Tape<S>();
+			~Owner() {
+				tape->mIsOrphaned.store(true, std::memory_order_release);
+				if(tape->mNumReferences.load(std::memory_order_acquire) == 0)
+					delete tape;
+			}
+		};
+		static thread_local Owner owner;
+		return *owner.tape;
+	}
+
+	static uint32_t nextId() {
+		static std::atomic<uint32_t> id{0};
+		uint32_t next = ++id;
+		return next ? next : ++id;
+	}
+
+	// called when the last reference is gone
+	void reclaim() {
+		if(mIsOrphaned.load(std::memory_order_acquire))
+			delete this;
+		else if(!mNodes.empty())
+			clear();
+	}
+
+	static Tape<S>* &current() {
+		static thread_local Tape<S> *tape = nullptr;
+		return tape;
+	}
+
+	struct Mark
+	{
+		size_t numBlocks;
+		size_t used;
+	};
+
+	Mark getMark() const {
+		Mark mark;
+		mark.numBlocks = mBlocks.size();
+		mark.used = mBlocks.empty() ? 0 : mBlocks.back().used;
+		return mark;
+	}
+
+	// release everything allocated since `mark`, but keep the blocks
+	void rollback(const Mark &mark) {
+		for (size_t i = mark.numBlocks; i < mBlocks.size(); ++i) {
+			mBlocks[i].used = 0;
+		}
+		if(mark.numBlocks > 0 && mark.numBlocks == mBlocks.size())
+			mBlocks.back().used = mark.used;
+	}
+
+	void *allocate(size_t size, size_t alignment) {
+		if(!mBlocks.empty()) {
+			Block &block = mBlocks.back();
+			size_t offset = (block.used + alignment - 1) & ~(alignment - 1);
+			if(offset + size <= block.size) {
+				block.used = offset + size;
+				return block.data + offset;
+			}
+		}
+
+		// current block is full, start a new one (blocks grow geometrically)
+		size_t blockSize = std::max(mNextBlockSize, size + alignment);
+		mNextBlockSize = std::min(2*mNextBlockSize, maxBlockSize);
+
+		Block block;
+		block.data = static_cast<char*>(std::malloc(blockSize));
+		if(!block.data)
+			throw std::bad_alloc();
+		block.size = blockSize;
+		block.used = size;
+		mBlocks.push_back(block);
+		return block.data;
+	}
+
+private:
+	struct Block
+	{
+		char *data;
+		size_t size;
+		size_t used;
+	};
+
+	// identifies a node by its op, children and payload
+	static uint64_t shallowHash(const Node<S> *node) {
+		uint64_t h = Node<S>::mix(node->getOp() ^ node->getPayloadHash());
+		for (size_t i = 0; i < node->getNumChildren(); ++i) {
+			h = Node<S>::mix(h ^ reinterpret_cast<uintptr_t>(node->getChild(i)));
+		}
+		return h;
+	}
+
+	static bool isShallowEqual(const Node<S> *a, const Node<S> *b) {
+		if(a->getOp() != b->getOp() || a->getNumChildren() != b->getNumChildren())
+			return false;
+		for (size_t i = 0; i < a->getNumChildren(); ++i) {
+			if(a->getChild(i) != b->getChild(i))
+				return false;
+		}
+		return a->isPayloadEqual(*b);
+	}
+
+	static const size_t maxBlockSize = 16*1024*1024;
+
+	uint32_t mId;
+	size_t mNextBlockSize;
+	std::vector<Block> mBlocks;
+	std::vector<Node<S>*> mNodes;
+
+	bool mHashConsing = false;
+	FlatHashTable<const Node<S>*> mUniqueNodes;
+
+	std::atomic<size_t> mNumReferences{0};
+	std::atomic<bool> mIsOrphaned{false};
+};
+
+template<class S>
+const size_t Tape<S>::maxBlockSize;
+
+// Maps nodes to indices, e.g. their position in a sorted graph. The nodes of
+// one tape, the tape of the first inserted node, are looked up by their id
+// in a plain array, so lookups stay fast for graphs of millions of nodes.
+// Nodes of other tapes are looked up by address in a hash table.
+template<class S>
+class NodeIndex
+{
+public:
+	static const uint32_t none = uint32_t(-1);
+
+	// index of `node`, or `none`
+	uint32_t find(const Node<S>* node) const {
+		if(isDense(node))
+			return node->getId() < mIndices.size() ? mIndices[node->getId()] : none;
+
+		const Indexed *indexed = mOther.find(hashPointer(node), [node](const Indexed &other) {
+			return other.first == node;
+		});
+		return indexed ? indexed->second : none;
+	}
+
+	void insert(const Node<S>* node, uint32_t index) {
+		if(mTapeId == 0)
+			mTapeId = node->getTapeId();
+		if(isDense(node)) {
+			if(node->getId() >= mIndices.size())
+				mIndices.resize(std::max<size_t>(node->getId() + 1, 2*mIndices.size()), none);
+			mIndices[node->getId()] = index;
+		}
+		else {
+			mOther.insert(hashPointer(node), Indexed(node, index));
+		}
+	}
+
+private:
+	typedef std::pair<const Node<S>*, uint32_t> Indexed;
+
+	bool isDense(const Node<S>* node) const {
+		return mTapeId != 0 && node->getTapeId() == mTapeId;
+	}
+
+	static uint64_t hashPointer(const Node<S>* node) {
+		return Node<S>::mix(reinterpret_cast<uintptr_t>(node));
+	}
+
+	uint32_t mTapeId = 0;
+	std::vector<uint32_t> mIndices;
+	FlatHashTable<Indexed> mOther;
+};
+
+template<class S>
+const uint32_t NodeIndex<S>::none;
+
+} // namespace AutoGen
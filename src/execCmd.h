@@ -4,6 +4,7 @@
 #include <stdexcept>
 #include <string>
 #include <array>
+#include <cstring>
 #include <string>
 
 int exec(const std::string &cmd, std::string &out) {
@@ -17,3 +18,119 @@ int exec(const std::string &cmd, std::string &out) {
 	int res = WEXITSTATUS(pclose(pipe));
 	return res;
 }
+
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+extern char **environ;
+
+// Run `args` (found in PATH) without a shell, write `input` to its stdin and
+// collect stdout and stderr in `out`. `passFd` (if not -1) is available to the
+// program as fd 3, `env` are additional "NAME=value" environment variables.
+// Returns the exit status, or -1 if the program could not be run.
+inline int execWithInput(const std::vector<std::string> &args, const std::string &input, std::string &out, int passFd = -1, const std::vector<std::string> &env = {}) {
+	// stdin is a socket, so writing to an exited program does not raise SIGPIPE
+	int inSockets[2], outPipe[2];
+	if(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, inSockets) != 0)
+		return -1;
+	if(pipe2(outPipe, O_CLOEXEC) != 0) {
+		close(inSockets[0]);
+		close(inSockets[1]);
+		return -1;
+	}
+	// a high fd, so it is not overwritten by the other dup2s
+	int childFd = (passFd >= 0) ? fcntl(passFd, F_DUPFD_CLOEXEC, 10) : -1;
+
+	posix_spawn_file_actions_t actions;
+	posix_spawn_file_actions_init(&actions);
+	posix_spawn_file_actions_adddup2(&actions, inSockets[0], 0);
+	posix_spawn_file_actions_adddup2(&actions, outPipe[1], 1);
+	posix_spawn_file_actions_adddup2(&actions, outPipe[1], 2);
+	if(childFd >= 0)
+		posix_spawn_file_actions_adddup2(&actions, childFd, 3);
+
+	std::vector<char*> argv;
+	for (const std::string &arg : args)
+		argv.push_back(const_cast<char*>(arg.c_str()));
+	argv.push_back(nullptr);
+
+	// environment with `env` replacing variables of the same name
+	std::vector<char*> envp;
+	for (char **var = environ; *var; ++var) {
+		bool replaced = false;
+		for (const std::string &e : env)
+			replaced = replaced || std::strncmp(*var, e.c_str(), e.find('=') + 1) == 0;
+		if(!replaced)
+			envp.push_back(*var);
+	}
+	for (const std::string &e : env)
+		envp.push_back(const_cast<char*>(e.c_str()));
+	envp.push_back(nullptr);
+
+	pid_t pid;
+	int spawned = posix_spawnp(&pid, argv[0], &actions, nullptr, argv.data(), envp.data());
+	posix_spawn_file_actions_destroy(&actions);
+	close(inSockets[0]);
+	close(outPipe[1]);
+	if(childFd >= 0)
+		close(childFd);
+	if(spawned != 0) {
+		close(inSockets[1]);
+		close(outPipe[0]);
+		return -1;
+	}
+
+	// write input and read output at the same time, so neither pipe fills up
+	int inFd = inSockets[1], outFd = outPipe[0];
+	size_t written = 0;
+	if(input.empty()) {
+		close(inFd);
+		inFd = -1;
+	}
+	while(outFd >= 0) {
+		pollfd fds[2] = {{outFd, POLLIN, 0}, {inFd, POLLOUT, 0}};
+		if(poll(fds, (inFd >= 0) ? 2 : 1, -1) < 0) {
+			if(errno == EINTR)
+				continue;
+			break;
+		}
+		if(inFd >= 0 && fds[1].revents) {
+			ssize_t n = send(inFd, input.data() + written, input.size() - written, MSG_NOSIGNAL | MSG_DONTWAIT);
+			if(n > 0)
+				written += n;
+			if((n < 0 && errno != EAGAIN && errno != EINTR) || written == input.size()) {
+				close(inFd);
+				inFd = -1;
+			}
+		}
+		if(fds[0].revents) {
+			char buffer[4096];
+			ssize_t n = read(outFd, buffer, sizeof(buffer));
+			if(n > 0)
+				out.append(buffer, n);
+			else if(n == 0 || errno != EINTR) {
+				close(outFd);
+				outFd = -1;
+			}
+		}
+	}
+	if(inFd >= 0)
+		close(inFd);
+	if(outFd >= 0)
+		close(outFd);
+
+	int status;
+	while(waitpid(pid, &status, 0) < 0) {
+		if(errno != EINTR)
+			return -1;
+	}
+	return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+#endif
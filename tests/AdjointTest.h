@@ -0,0 +1,141 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <RecType.h>
+#include <AutoDiff.h>
+#include <CodeGenerator.h>
+#include <Bytecode.h>
+#include <Adjoint.h>
+
+/*
+ * Testing: Adjoint
+ * The gradient from one reverse sweep matches forward mode AutoDiff.
+ */
+
+template<class T>
+static T adjointTestFunction(const T &x, const T &y, const T &z) {
+    using std::pow; using std::sqrt; using std::cos; using std::sin; using std::acos;
+    T a = x*y + z/y;
+    return pow(a, 3.0) - sqrt(a*a + 1.0)*cos(z) + sin(x - y) + acos(x*0.5) - (-z)*a;
+}
+
+TEST(Adjoint, MatchesForwardMode) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+    typedef AutoDiff<double, double> AD;
+
+    std::vector<R> inputs = {R("x[0]"), R("x[1]"), R("x[2]")};
+    std::vector<R> grad = gradient(adjointTestFunction(inputs[0], inputs[1], inputs[2]), inputs);
+    ASSERT_EQ(grad.size(), 3u);
+
+    CodeGenerator<double> generator;
+    for (int i = 0; i < 3; ++i) {
+        grad[i].addToGeneratorAsResult(generator, "grad[" + std::to_string(i) + "]");
+    }
+    generator.sortNodes();
+    Bytecode<double> bytecode = Bytecode<double>::compile(generator, {"x[0]", "x[1]", "x[2]"}, {"grad[0]", "grad[1]", "grad[2]"});
+
+    const double values[][3] = {{0.3, 1.2, -0.4}, {-1.1, 0.7, 2.0}};
+    for (const auto &in : values) {
+        double out[3];
+        bytecode.evaluate(in, out);
+        for (int i = 0; i < 3; ++i) {
+            AD x(in[0], i == 0), y(in[1], i == 1), z(in[2], i == 2);
+            EXPECT_NEAR(out[i], adjointTestFunction(x, y, z).deriv(), 1e-12);
+        }
+    }
+}
+
+TEST(Adjoint, CostIndependentOfNumVariables) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    // E = sum_i (x_i - x_i+1)^2 * x_i
+    const int n = 200;
+    std::vector<R> inputs;
+    for (int i = 0; i < n; ++i) {
+        inputs.push_back(R("x[" + std::to_string(i) + "]"));
+    }
+    R E = 0.0;
+    for (int i = 0; i + 1 < n; ++i) {
+        R d = inputs[i] - inputs[i+1];
+        E += d*d*inputs[i];
+    }
+
+    CodeGenerator<double> energy;
+    E.addToGeneratorAsResult(energy, "E");
+    energy.sortNodes();
+
+    CodeGenerator<double> generator;
+    std::vector<R> grad = gradient(E, inputs);
+    for (int i = 0; i < n; ++i) {
+        grad[i].addToGeneratorAsResult(generator, "grad[" + std::to_string(i) + "]");
+    }
+    generator.sortNodes();
+    EXPECT_LT(generator.getNumNodes(), 4*energy.getNumNodes());
+
+    std::vector<double> in(n), out(n);
+    for (int i = 0; i < n; ++i) {
+        in[i] = std::sin(0.1*i);
+    }
+    Bytecode<double>::compile(generator).evaluate(in.data(), out.data());
+    for (int i = 0; i < n; ++i) {
+        double expected = 0;
+        if(i + 1 < n)
+            expected += (in[i] - in[i+1])*(3*in[i] - in[i+1]);
+        if(i > 0)
+            expected -= 2*(in[i-1] - in[i])*in[i-1];
+        EXPECT_NEAR(out[i], expected, 1e-12);
+    }
+}
+
+TEST(Adjoint, Hessian) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+    typedef AutoDiff<double, double> AD;
+    typedef AutoDiff<AD, AD> ADD;
+
+    std::vector<R> inputs = {R("x[0]"), R("x[1]"), R("x[2]")};
+    std::vector<std::vector<R>> hess = hessian(adjointTestFunction(inputs[0], inputs[1], inputs[2]), inputs);
+
+    // the lower triangle is a copy of the upper one
+    CodeGenerator<double> generator;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            EXPECT_EQ(hess[i][j].getNode(), hess[j][i].getNode());
+            hess[i][j].addToGeneratorAsResult(generator, "hess(" + std::to_string(i) + ", " + std::to_string(j) + ")");
+        }
+    }
+    generator.sortNodes();
+    Bytecode<double> bytecode = Bytecode<double>::compile(generator, {"x[0]", "x[1]", "x[2]"},
+        {"hess(0, 0)", "hess(0, 1)", "hess(0, 2)", "hess(1, 0)", "hess(1, 1)", "hess(1, 2)", "hess(2, 0)", "hess(2, 1)", "hess(2, 2)"});
+
+    const double in[3] = {0.3, 1.2, -0.4};
+    double out[9];
+    bytecode.evaluate(in, out);
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            ADD x[3];
+            for (int k = 0; k < 3; ++k) {
+                x[k] = ADD(AD(in[k], k == j), AD(k == i, 0.0));
+            }
+            EXPECT_NEAR(out[3*i+j], adjointTestFunction(x[0], x[1], x[2]).deriv().deriv(), 1e-10);
+        }
+    }
+}
+
+TEST(Adjoint, UnsupportedInputs) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    R x("x"), y("y");
+    EXPECT_THROW(gradient(x*y, {x*y}), std::invalid_argument);
+    EXPECT_THROW(gradient(pow(x, y), {x, y}), std::invalid_argument);
+
+    // inputs the output does not depend on have a zero gradient
+    std::vector<R> grad = gradient(x*x, {x, y});
+    double value;
+    EXPECT_TRUE(grad[1].getNode()->evaluate(value));
+    EXPECT_EQ(value, 0.0);
+}
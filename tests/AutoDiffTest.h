@@ -0,0 +1,64 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <AutoDiff.h>
+#include <RecType.h>
+#include <CodeGenerator.h>
+#include <Bytecode.h>
+
+/*
+ * Testing: AutoDiff with vector derivatives
+ * One pass with a derivative vector gives the same derivatives as one pass
+ * per direction.
+ */
+
+template<class T>
+static T autoDiffTestFunction(const T &x, const T &y, const T &z) {
+    using std::pow; using std::sqrt; using std::cos; using std::sin; using std::acos;
+    T a = x*y + z/y;
+    return pow(a, 3.0) - sqrt(a*a + 1.0)*cos(z) + 2.0*sin(x - y) + acos(x*0.5) - (-z)*a;
+}
+
+TEST(AutoDiff, VectorDerivative) {
+    typedef AutoDiff<double, double> AD;
+    typedef AutoDiff<double, Eigen::Vector3d> AD3;
+
+    const double in[3] = {0.3, 1.2, -0.4};
+    AD3 x(in[0], Eigen::Vector3d::Unit(0)), y(in[1], Eigen::Vector3d::Unit(1)), z(in[2], Eigen::Vector3d::Unit(2));
+    AD3 f = autoDiffTestFunction(x, y, z);
+    EXPECT_EQ(AD3(1.0).deriv(), Eigen::Vector3d::Zero());
+
+    for (int i = 0; i < 3; ++i) {
+        AD f_i = autoDiffTestFunction(AD(in[0], i == 0), AD(in[1], i == 1), AD(in[2], i == 2));
+        EXPECT_DOUBLE_EQ(f.value(), f_i.value());
+        EXPECT_DOUBLE_EQ(f.deriv()[i], f_i.deriv());
+    }
+}
+
+TEST(AutoDiff, RecordedVectorDerivative) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+    typedef Eigen::Matrix<R, 3, 1> Vector3R;
+    typedef AutoDiff<R, Vector3R> ADR3;
+
+    ADR3 x(R("x[0]"), Vector3R::Unit(0)), y(R("x[1]"), Vector3R::Unit(1)), z(R("x[2]"), Vector3R::Unit(2));
+    ADR3 f = autoDiffTestFunction(x, y, z);
+
+    CodeGenerator<double> generator;
+    for (int i = 0; i < 3; ++i) {
+        f.deriv()[i].addToGeneratorAsResult(generator, "y[" + std::to_string(i) + "]");
+    }
+    generator.sortNodes();
+
+    const double in[3] = {-1.1, 0.7, 2.0};
+    double out[3];
+    Bytecode<double>::compile(generator).evaluate(in, out);
+    AutoDiff<double, Eigen::Vector3d> expected = autoDiffTestFunction(
+                AutoDiff<double, Eigen::Vector3d>(in[0], Eigen::Vector3d::Unit(0)),
+                AutoDiff<double, Eigen::Vector3d>(in[1], Eigen::Vector3d::Unit(1)),
+                AutoDiff<double, Eigen::Vector3d>(in[2], Eigen::Vector3d::Unit(2)));
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_NEAR(out[i], expected.deriv()[i], 1e-12);
+    }
+}
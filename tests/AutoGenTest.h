@@ -0,0 +1,70 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <AutoGen.h>
+#include <AutoLoad.h>
+
+/*
+ * Testing: generateEnergyGradientAndHessianCode
+ * One fused kernel computes energy, gradient and Hessian, sharing the
+ * intermediate values of all three.
+ */
+
+template<class T>
+static T autoGenTestEnergy(const AutoGen::VectorXn<T> &x) {
+    T a = x[0]*x[1] - 1.0;
+    return a*a + sin(x[2])*x[0];
+}
+
+TEST(AutoGen, FusedEnergyGradientAndHessian) {
+    using namespace AutoGen;
+
+    VectorXn<ADDR> x(3, "x");
+    VarListX<ADDR> variables(3);
+    variables.assignSegment(0, 3, x);
+    auto energy = [&x]() { return autoGenTestEnergy(x); };
+
+    // the generators record into tapes of their own
+    size_t numNodes = Tape<double>::active().getNumNodes();
+    std::string code = generateEnergyGradientAndHessianCode(variables, energy);
+
+    // the fused code is shorter than the separate ones together
+    auto countLines = [](const std::string &str) { return std::count(str.begin(), str.end(), '\n'); };
+    std::string separateCode = generateEnergyCodeADDR(energy) + generateGradientCode(variables, energy) + generateHessianCode(variables, energy);
+    EXPECT_LT(countLines(code), countLines(separateCode));
+    EXPECT_EQ(Tape<double>::active().getNumNodes(), numNodes);
+
+    std::string libCode = "#include <cmath>\n"
+                          "#define hess(i, j) y[4 + 3*(i) + (j)]\n"
+                          "extern \"C\" void compute_extern(double* x, double* y) {\n"
+                          "double &E = y[0];\n"
+                          "double *grad = y + 1;\n";
+    libCode += code;
+    libCode += "}\n";
+
+    TestCacheDirectory cacheDirectory;
+
+    std::string error;
+    compute_extern* compute;
+    ASSERT_TRUE(buildAndLoad(libCode, compute, "fused", error)) << error;
+
+    double in[3] = {0.5, 1.5, -0.3};
+    double out[13];
+    compute(in, out);
+
+    double a = in[0]*in[1] - 1.0;
+    double s = std::sin(in[2]), c = std::cos(in[2]);
+    EXPECT_NEAR(out[0], a*a + s*in[0], 1e-14);
+    EXPECT_NEAR(out[1], 2*a*in[1] + s, 1e-14);
+    EXPECT_NEAR(out[2], 2*a*in[0], 1e-14);
+    EXPECT_NEAR(out[3], c*in[0], 1e-14);
+    const double hess[3][3] = {{2*in[1]*in[1], 2*(a + in[0]*in[1]), c},
+                               {2*(a + in[0]*in[1]), 2*in[0]*in[0], 0},
+                               {c, 0, -s*in[0]}};
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            EXPECT_NEAR(out[4 + 3*i + j], hess[i][j], 1e-14);
+        }
+    }
+}
@@ -5,8 +5,51 @@
 #include <AutoLoad.h>
 #include <CodeGenerator.h>
 
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+
+#include <dirent.h>
+#include <unistd.h>
+
 template <class S> using Vector3 = Eigen::Matrix<S, 3, 1>;
 
+// Makes the kernel cache use a new directory under $TMPDIR, which is removed
+// with everything in it at the end of the test.
+class TestCacheDirectory
+{
+public:
+    TestCacheDirectory()
+        : mPrevious(AutoGen::KernelCache::instance().getDirectory()) {
+        const char *tmp = std::getenv("TMPDIR");
+        std::string path = std::string((tmp && *tmp) ? tmp : "/tmp") + "/autogen-cache-XXXXXX";
+        if(mkdtemp(&path[0]))
+            mPath = path;
+        else
+            ADD_FAILURE() << "Could not create a cache directory in '" << path << "'.";
+        AutoGen::KernelCache::instance().setDirectory(mPath);
+    }
+
+    ~TestCacheDirectory() {
+        AutoGen::KernelCache::instance().setDirectory(mPrevious);
+        if(DIR *dir = opendir(mPath.c_str())) {
+            while(struct dirent *file = readdir(dir)) {
+                std::string name = file->d_name;
+                if(name != "." && name != "..")
+                    unlink((mPath + "/" + name).c_str());
+            }
+            closedir(dir);
+            rmdir(mPath.c_str());
+        }
+    }
+
+    const std::string &getPath() const { return mPath; }
+
+private:
+    std::string mPrevious;
+    std::string mPath;
+};
+
 ////////////////////////////////////////////////////////////////////////// TEST 0
 
 /*
@@ -348,3 +391,405 @@ TEST(GenerateCodeAndLoadLib, GradientAndHessian) {
         EXPECT_NEAR(hess_CG.norm(), hess_FD.norm(), 1e-3);
     }
 }
+
+////////////////////////////////////////////////////////////////////////// TEST 5
+
+/*
+ * Testing: KernelCache
+ * Building the same code twice compiles it only once, and the least recently
+ * used libraries are evicted when the cache is too large.
+ */
+
+TEST(GenerateCodeAndLoadLib, KernelCache) {
+    using namespace AutoGen;
+
+    KernelCache &cache = KernelCache::instance();
+    size_t maxSize = cache.getMaxSize();
+    TestCacheDirectory cacheDirectory;
+
+    std::string libCode =
+            "extern \"C\" void compute_extern(double* x, double* y) {\n"
+            "y[0] = 3.0*x[0];\n"
+            "}\n";
+
+    std::string error;
+    compute_extern* compute;
+    size_t numBuilds = cache.getNumBuilds();
+    EXPECT_TRUE(buildAndLoad(libCode, compute, "cached", error)) << error;
+    EXPECT_TRUE(buildAndLoad(libCode, compute, "cached", error)) << error;
+    EXPECT_EQ(cache.getNumBuilds(), numBuilds + 1);
+
+    double x = 2.0, y = 0.0;
+    compute(&x, &y);
+    EXPECT_EQ(y, 6.0);
+
+    CompileProfile profile = CompileProfiles::instance().getDefault();
+    std::string key = KernelCache::getKey(libCode, profile.getCompiler(), profile.getFlags());
+    std::ifstream lib(cacheDirectory.getPath() + "/lib" + key + ".so");
+    EXPECT_TRUE(lib.good());
+    lib.close();
+
+    // a library built from another source with the same key is rebuilt
+    std::ofstream(cacheDirectory.getPath() + "/" + key + ".cpp") << "// another kernel with the same key\n";
+    EXPECT_TRUE(buildAndLoad(libCode, compute, "cached", error)) << error;
+    EXPECT_EQ(cache.getNumBuilds(), numBuilds + 2);
+
+    // only the most recent library fits
+    cache.setMaxSize(1);
+    std::string otherCode = libCode + "// another kernel\n";
+    EXPECT_TRUE(buildAndLoad(otherCode, compute, "cached", error)) << error;
+    EXPECT_EQ(cache.getNumBuilds(), numBuilds + 3);
+    lib.open(cacheDirectory.getPath() + "/lib" + key + ".so");
+    EXPECT_FALSE(lib.good());
+
+    // failures are reported with the compiler output
+    error.clear();
+    EXPECT_FALSE(buildAndLoad(std::string("this is not c++"), compute, "broken", error));
+    EXPECT_NE(error.find("this"), std::string::npos);
+
+    // paths are passed to the compiler as they are
+    std::string spacedDirectory = cacheDirectory.getPath() + "/with space";
+    cache.setDirectory(spacedDirectory);
+    EXPECT_TRUE(buildAndLoad(libCode, compute, "spaced", error)) << error;
+    cache.clear();
+    rmdir(spacedDirectory.c_str());
+
+    cache.setMaxSize(maxSize);
+}
+
+////////////////////////////////////////////////////////////////////////// TEST 6
+
+/*
+ * Testing: buildAndLoadAll
+ * Many kernels are built in parallel, a failing build only fails its own
+ * future.
+ */
+
+TEST(GenerateCodeAndLoadLib, BuildAll) {
+    using namespace AutoGen;
+
+    std::vector<std::string> codes;
+    for (int i = 0; i < 4; ++i) {
+        codes.push_back("extern \"C\" void compute_extern(double* x, double* y) {\n"
+                        "y[0] = x[0] + " + std::to_string(i) + ".0;\n"
+                        "}\n");
+    }
+    codes.push_back("not c++");
+
+    std::vector<std::future<compute_extern*>> fncs = buildAndLoadAll<compute_extern>(codes);
+    ASSERT_EQ(fncs.size(), codes.size());
+    for (int i = 0; i < 4; ++i) {
+        double x = 0.5, y = 0.0;
+        fncs[i].get()(&x, &y);
+        EXPECT_EQ(y, 0.5 + i);
+    }
+    EXPECT_THROW(fncs[4].get(), std::runtime_error);
+}
+
+////////////////////////////////////////////////////////////////////////// TEST 7
+
+/*
+ * Testing: autotune
+ * Profiles with wrong results are never chosen, and the choice is
+ * remembered.
+ */
+
+TEST(GenerateCodeAndLoadLib, Autotune) {
+    using namespace AutoGen;
+
+    KernelCache &cache = KernelCache::instance();
+    TestCacheDirectory cacheDirectory;
+
+    // this profile changes the result, so it must not be chosen
+    CompileProfiles::instance().add({"wrong", "", "-O2 -DSCALE=1.5"});
+
+    std::string libCode =
+            "#ifndef SCALE\n"
+            "#define SCALE 1.0\n"
+            "#endif\n"
+            "extern \"C\" void compute_extern(double* x, double* y) {\n"
+            "y[0] = SCALE*x[0]*x[1];\n"
+            "}\n";
+    std::vector<double> inputs = {1.0, 2.0, 3.0, 4.0};
+
+    std::string error, profile;
+    compute_extern* compute;
+    ASSERT_TRUE(autotune(libCode, inputs, 2, 1, compute, profile, error)) << error;
+    EXPECT_NE(profile, "wrong");
+    double y = 0.0;
+    compute(&inputs[2], &y);
+    EXPECT_EQ(y, 12.0);
+
+    // remembered, nothing is built again
+    size_t numBuilds = cache.getNumBuilds();
+    std::string profileAgain;
+    EXPECT_TRUE(autotune(libCode, inputs, 2, 1, compute, profileAgain, error));
+    EXPECT_EQ(profileAgain, profile);
+    EXPECT_TRUE(buildAndLoad(libCode, compute, error));
+    EXPECT_EQ(cache.getNumBuilds(), numBuilds);
+
+    CompileProfiles::instance().remove("wrong");
+}
+
+////////////////////////////////////////////////////////////////////////// TEST 8
+
+/*
+ * Testing: buildAndLoadInMemory
+ * Without a cache directory, kernels are built and loaded without files.
+ */
+
+TEST(GenerateCodeAndLoadLib, InMemory) {
+    using namespace AutoGen;
+
+    KernelCache &cache = KernelCache::instance();
+    std::string directory = cache.getDirectory();
+    cache.setDirectory("");
+
+    size_t numBuilds = cache.getNumBuilds();
+    std::string error;
+    compute_extern* compute[2];
+    for (int i = 0; i < 2; ++i) {
+        std::string libCode =
+                "#include <cmath>\n"
+                "extern \"C\" void compute_extern(double* x, double* y) {\n"
+                "y[0] = std::sqrt(x[0]) + " + std::to_string(i) + ".0;\n"
+                "}\n";
+        EXPECT_TRUE(buildAndLoad(libCode, compute[i], "in memory", error)) << error;
+    }
+    EXPECT_EQ(cache.getNumBuilds(), numBuilds);
+
+    // both kernels are loaded, although their memfds might share a path
+    double x = 4.0, y = 0.0;
+    compute[0](&x, &y);
+    EXPECT_EQ(y, 2.0);
+    compute[1](&x, &y);
+    EXPECT_EQ(y, 3.0);
+
+    EXPECT_FALSE(buildAndLoad(std::string("not c++"), compute[0], "broken", error));
+    EXPECT_NE(error.find("not"), std::string::npos);
+
+    cache.setDirectory(directory);
+}
+
+////////////////////////////////////////////////////////////////////////// TEST 9
+
+/*
+ * Testing: KernelHandle & KernelRegistry
+ * A kernel is unloaded once its last holder is gone, also when it is replaced
+ * in the registry while another thread calls it.
+ */
+
+TEST(GenerateCodeAndLoadLib, KernelRegistry) {
+    using namespace AutoGen;
+
+    KernelCache &cache = KernelCache::instance();
+    TestCacheDirectory cacheDirectory;
+
+    auto makeCode = [](int i) {
+        return "extern \"C\" void compute_extern(double* x, double* y) {\n"
+               "y[0] = x[0] + " + std::to_string(i) + ".0;\n"
+               "}\n";
+    };
+    CompileProfile profile = CompileProfiles::instance().getDefault();
+    auto isLoaded = [&](int i) {
+        std::string path = cache.getDirectory() + "/lib" + KernelCache::getKey(makeCode(i), profile.getCompiler(), profile.getFlags()) + ".so";
+        void *library = dlopen(path.c_str(), RTLD_LAZY | RTLD_NOLOAD);
+        if(library)
+            dlclose(library);
+        return library != nullptr;
+    };
+
+    KernelRegistry registry;
+    std::string error;
+    for (int i = 0; i < 2; ++i) {
+        KernelHandle kernel;
+        ASSERT_TRUE(buildAndLoad(makeCode(i), kernel, error)) << error;
+        EXPECT_TRUE(kernel);
+        registry.set("kernel" + std::to_string(i), std::move(kernel));
+    }
+    EXPECT_EQ(registry.size(), 2u);
+    EXPECT_TRUE(isLoaded(0));
+
+    // call kernel0 from another thread while it is swapped
+    std::atomic<bool> stop(false);
+    std::atomic<int> numCalls(0);
+    std::thread caller([&]() {
+        while(!stop) {
+            KernelRegistry::Kernel kernel = registry.find("kernel0");
+            double x = 1.0, y = 0.0;
+            kernel->get()(&x, &y);
+            EXPECT_TRUE(y == 1.0 || y == 3.0);
+            numCalls++;
+        }
+    });
+    while(numCalls < 100)
+        std::this_thread::yield();
+
+    KernelHandle kernel;
+    ASSERT_TRUE(buildAndLoad(makeCode(2), kernel, error)) << error;
+    KernelRegistry::Kernel previous = registry.set("kernel0", std::move(kernel));
+    int callsBefore = numCalls;
+    while(numCalls < callsBefore + 100)
+        std::this_thread::yield();
+    stop = true;
+    caller.join();
+
+    // the old kernel is still loaded while we hold it
+    EXPECT_TRUE(isLoaded(0));
+    previous.reset();
+    EXPECT_FALSE(isLoaded(0));
+
+    EXPECT_TRUE(registry.remove("kernel1") != nullptr);
+    EXPECT_FALSE(isLoaded(1));
+    EXPECT_TRUE(registry.find("kernel1") == nullptr);
+    EXPECT_TRUE(isLoaded(2));
+
+}
+
+////////////////////////////////////////////////////////////////////////// TEST 10
+
+/*
+ * Testing: wrapComputeCode
+ * The batched entry point evaluates many points with strided inputs and
+ * outputs, and matches the single point function.
+ */
+
+TEST(GenerateCodeAndLoadLib, Batch) {
+    using namespace AutoGen;
+
+    // record computation
+    RecType<double> y = computeScalar(RecType<double>("x[0]"));
+    std::string code = y.generateCode("y[0]");
+
+    std::string error;
+    KernelHandle kernel;
+    ASSERT_TRUE(buildAndLoad(wrapComputeCode(code), kernel, "compute_batch", error)) << error;
+    compute_batch_extern* batch = reinterpret_cast<compute_batch_extern*>(kernel.getSymbol("compute_batch_extern"));
+    ASSERT_TRUE(batch != nullptr);
+
+    // every point has 2 inputs (the second is unused) and 3 outputs
+    const size_t n = 5;
+    std::vector<double> in(2*n), out(3*n, -1.0);
+    for (size_t k = 0; k < n; ++k) {
+        in[2*k] = 0.1 + 0.2*k;
+        in[2*k+1] = 100.0;
+    }
+    batch(n, in.data(), 2, out.data(), 3);
+
+    for (size_t k = 0; k < n; ++k) {
+        double x = in[2*k], yk;
+        kernel.get()(&x, &yk);
+        EXPECT_EQ(out[3*k], yk);
+        EXPECT_EQ(out[3*k], computeScalar(x));
+        EXPECT_EQ(out[3*k+1], -1.0);
+        EXPECT_EQ(out[3*k+2], -1.0);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////// TEST 11
+
+/*
+ * Testing: CodeGenerator::generateSplitCode
+ * A kernel split into parts, each compiled as its own translation unit,
+ * computes the same as the kernel in one piece.
+ */
+
+TEST(GenerateCodeAndLoadLib, SplitKernel) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+    typedef AutoDiff<R, R> AD;
+
+    KernelCache &cache = KernelCache::instance();
+    TestCacheDirectory cacheDirectory;
+
+    // record computation
+    Vector3<AD> a, b;
+    for (int i = 0; i < 3; ++i) {
+        a[i] = R("x[" + std::to_string(i) + "]");
+        b[i] = R("x[" + std::to_string(3+i) + "]");
+    }
+
+    CodeGenerator<double> generator;
+    for (int i = 0; i < 3; ++i) {
+        a(i).deriv() = 1.0;
+        R grad = computeDotAndCrossNorm(a, b).deriv();
+        grad.addToGeneratorAsResult(generator, "y[" + std::to_string(i) + "]");
+        a(i).deriv() = 0.0;
+    }
+    generator.sortNodes();
+
+    SplitCode code = generator.generateSplitCode("extern \"C\" void compute_extern(double* x, double* y)", 8);
+    EXPECT_EQ(code.parts.size(), (generator.getNumNodes() + 7) / 8);
+    EXPECT_NE(code.header.find("struct compute_extern_State"), std::string::npos);
+
+    std::string error;
+    KernelHandle split, whole;
+    size_t numBuilds = cache.getNumBuilds();
+    ASSERT_TRUE(buildAndLoad(code.getUnits(), split, "split", error)) << error;
+    ASSERT_TRUE(buildAndLoad(code.getUnits(), split, "split", error)) << error;
+    EXPECT_EQ(cache.getNumBuilds(), numBuilds + 1);
+    ASSERT_TRUE(buildAndLoad(code.getCode(), whole, "whole", error)) << error;
+
+    const double x[6] = {1.2, 3.4, 5.5, 4.2, -0.1, 1.8};
+    double ySplit[3], yWhole[3];
+    split.get()(const_cast<double*>(x), ySplit);
+    whole.get()(const_cast<double*>(x), yWhole);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(ySplit[i], yWhole[i]);
+    }
+
+    // failures name the translation unit
+    std::vector<std::string> units = code.getUnits();
+    units[1] += "this is not c++\n";
+    error.clear();
+    EXPECT_FALSE(buildAndLoad(units, split, "broken", error));
+    EXPECT_NE(error.find("translation unit 1"), std::string::npos);
+
+}
+
+////////////////////////////////////////////////////////////////////////// TEST 12
+
+/*
+ * Testing: CodeGenerator with MIN_LIVE_ORDER and reused variables
+ * The reordered code with reused variables computes the same.
+ */
+
+TEST(GenerateCodeAndLoadLib, ReusedVariables) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+    typedef AutoDiff<R, R> AD;
+
+    // record computation
+    Vector3<AD> a, b;
+    for (int i = 0; i < 3; ++i) {
+        a[i] = R("x[" + std::to_string(i) + "]");
+        b[i] = R("x[" + std::to_string(3+i) + "]");
+    }
+
+    CodeGenerator<double> generator;
+    for (int i = 0; i < 3; ++i) {
+        a(i).deriv() = 1.0;
+        R grad = computeDotAndCrossNorm(a, b).deriv();
+        grad.addToGeneratorAsResult(generator, "y[" + std::to_string(i) + "]");
+        a(i).deriv() = 0.0;
+    }
+
+    std::string error;
+    compute_extern* compute[2];
+    for (int order = 0; order < 2; ++order) {
+        generator.sortNodes(order ? MIN_LIVE_ORDER : DEPTH_FIRST_ORDER);
+        generator.setReuseVariables(order == 1);
+        std::string libCode = "#include <cmath>\nextern \"C\" void compute_extern(double* x, double* y) {\n";
+        libCode += generator.generateCode();
+        libCode += "}\n";
+        ASSERT_TRUE(buildAndLoad(libCode, compute[order], "reused variables", error)) << error;
+    }
+
+    double x[6] = {1.2, 3.4, 5.5, 4.2, -0.1, 1.8};
+    double y[2][3];
+    compute[0](x, y[0]);
+    compute[1](x, y[1]);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(y[0][i], y[1][i]);
+    }
+}
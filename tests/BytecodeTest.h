@@ -0,0 +1,201 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <RecType.h>
+#include <CodeGenerator.h>
+#include <Bytecode.h>
+#include <Jit.h>
+
+/*
+ * Testing: Bytecode
+ * The interpreted graph computes the same values as the plain C++ function.
+ */
+
+template<class T>
+static T bytecodeTestFunction(const T &x, const T &y) {
+    using std::pow; using std::sqrt; using std::cos; using std::sin; using std::acos;
+    T a = x*y + 2.0;
+    return pow(a, x) * sqrt(a) - cos(y)/sin(x) + acos(x*0.5) - (-y)*a;
+}
+
+TEST(Bytecode, EvaluateMatchesCpp) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    R x("x[1]"), y("x[0]");
+
+    CodeGenerator<double> generator;
+    bytecodeTestFunction(x, y).addToGeneratorAsResult(generator, "y[1]");
+    (x*y).addToGeneratorAsResult(generator, "y[0]");
+    generator.sortNodes();
+
+    Bytecode<double> bytecode = Bytecode<double>::compile(generator);
+    EXPECT_EQ(bytecode.getNumInputs(), 2u);
+    EXPECT_EQ(bytecode.getNumOutputs(), 2u);
+
+    const double values[][2] = {{1.2, 0.3}, {2.5, -0.7}, {-0.1, 0.9}};
+    for (const auto &in : values) {
+        double out[2];
+        bytecode.evaluate(in, out);
+        EXPECT_DOUBLE_EQ(out[0], in[1]*in[0]);
+        EXPECT_DOUBLE_EQ(out[1], bytecodeTestFunction(in[1], in[0]));
+    }
+}
+
+TEST(Bytecode, ExplicitSlots) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    R a("a"), b("b");
+
+    CodeGenerator<double> generator;
+    (a - b).addToGeneratorAsResult(generator, "hess(0, 1)");
+    (a / b).addToGeneratorAsResult(generator, "hess(1, 0)");
+    generator.sortNodes();
+
+    Bytecode<double> bytecode = Bytecode<double>::compile(generator, {"b", "a"}, {"hess(1, 0)", "hess(0, 1)"});
+    double in[2] = {4.0, 3.0}, out[2];
+    bytecode.evaluate(in, out);
+    EXPECT_EQ(out[0], 0.75);
+    EXPECT_EQ(out[1], -1.0);
+
+    EXPECT_THROW(Bytecode<double>::compile(generator, {"a"}, {"hess(1, 0)", "hess(0, 1)"}), std::invalid_argument);
+}
+
+/*
+ * Registers of values that are not used anymore are reused.
+ */
+
+TEST(Bytecode, ReusesRegisters) {
+    using namespace AutoGen;
+
+    Tape<double> tape;
+    const Node<double>* x = tape.create<NodeVar<double>>("x[0]");
+    const Node<double>* node = x;
+    for (int i = 0; i < 10000; ++i) {
+        node = tape.create<NodeMul<double>>(tape.create<NodeSin<double>>(node), x);
+    }
+
+    CodeGenerator<double> generator;
+    generator.collectNodes(tape.create<NodeResult<double>>("y[0]", node));
+    generator.sortNodes();
+
+    Bytecode<double> bytecode = Bytecode<double>::compile(generator);
+    EXPECT_EQ(bytecode.getInstructions().size(), 20002u);
+    EXPECT_LE(bytecode.getNumRegisters(), 3u);
+
+    double in = 0.5, out = 0.0, expected = in;
+    for (int i = 0; i < 10000; ++i) {
+        expected = std::sin(expected) * in;
+    }
+    bytecode.evaluate(&in, &out);
+    EXPECT_EQ(out, expected);
+}
+
+/*
+ * A batch gives the same values as evaluating every point on its own, with
+ * every supported instruction set.
+ */
+
+TEST(Bytecode, EvaluateBatch) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    R x("x[0]"), y("x[1]");
+
+    CodeGenerator<double> generator;
+    bytecodeTestFunction(x, y).addToGeneratorAsResult(generator, "y[0]");
+    (x*y - x/y).addToGeneratorAsResult(generator, "y[1]");
+    generator.sortNodes();
+    Bytecode<double> bytecode = Bytecode<double>::compile(generator);
+
+    const size_t n = 3*Bytecode<double>::batchLanes + 5;
+    std::vector<double> in(2*n), expected(2*n);
+    for (size_t k = 0; k < n; ++k) {
+        in[k] = -0.9 + 1.8*k/n;
+        in[n + k] = 0.1 + 0.01*k;
+        double point[2] = {in[k], in[n + k]}, result[2];
+        bytecode.evaluate(point, result);
+        expected[k] = result[0];
+        expected[n + k] = result[1];
+    }
+
+    EXPECT_TRUE(Bytecode<double>::isSupported(SIMD_SCALAR));
+    for (SimdLevel simd : {SIMD_AUTO, SIMD_SCALAR, SIMD_AVX2, SIMD_AVX512}) {
+        if(!Bytecode<double>::isSupported(simd))
+            continue;
+        std::vector<double> out(2*n, 0.0);
+        bytecode.evaluateBatch(n, in.data(), out.data(), simd);
+        EXPECT_EQ(out, expected) << "simd level " << simd;
+    }
+}
+
+/*
+ * Testing: Jit
+ * The jit compiled function gives the same values as the bytecode.
+ */
+
+TEST(Jit, MatchesBytecode) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    R x("x[0]"), y("x[1]");
+
+    CodeGenerator<double> generator;
+    bytecodeTestFunction(x, y).addToGeneratorAsResult(generator, "y[0]");
+    (-(x*y) - x/y + 0.25).addToGeneratorAsResult(generator, "y[1]");
+    generator.sortNodes();
+    Bytecode<double> bytecode = Bytecode<double>::compile(generator);
+
+    JitFunction function;
+    std::string error;
+    ASSERT_TRUE(jitCompile(bytecode, function, error)) << error;
+
+    const double values[][2] = {{0.3, 1.2}, {-0.7, 2.5}, {0.9, -0.1}};
+    for (const auto &point : values) {
+        double in[2] = {point[0], point[1]}, expected[2], out[2];
+        bytecode.evaluate(in, expected);
+        function.get()(in, out);
+        EXPECT_EQ(out[0], expected[0]);
+        EXPECT_EQ(out[1], expected[1]);
+    }
+}
+
+/*
+ * Graphs that need more than a page of stack.
+ */
+
+TEST(Jit, LargeFrame) {
+    using namespace AutoGen;
+
+    Tape<double> tape;
+    std::vector<const Node<double>*> inputs;
+    for (int i = 0; i < 2000; ++i) {
+        inputs.push_back(tape.create<NodeVar<double>>("x[" + std::to_string(i) + "]"));
+    }
+    // all inputs are alive until the end
+    const Node<double>* sum = inputs.back();
+    for (int i = 0; i < 2000; ++i) {
+        sum = tape.create<NodeAdd<double>>(sum, tape.create<NodeMul<double>>(inputs[i], inputs[1999 - i]));
+    }
+
+    CodeGenerator<double> generator;
+    generator.collectNodes(tape.create<NodeResult<double>>("y[0]", sum));
+    generator.sortNodes();
+    Bytecode<double> bytecode = Bytecode<double>::compile(generator);
+    EXPECT_GT(8*bytecode.getNumRegisters(), 2*JitAssembler::pageSize);
+
+    JitFunction function;
+    std::string error;
+    ASSERT_TRUE(jitCompile(bytecode, function, error)) << error;
+
+    std::vector<double> in(2000);
+    for (int i = 0; i < 2000; ++i) {
+        in[i] = 0.001*i;
+    }
+    double expected, out;
+    bytecode.evaluate(in.data(), &expected);
+    function(in.data(), &out);
+    EXPECT_EQ(out, expected);
+}
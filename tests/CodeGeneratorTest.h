@@ -0,0 +1,181 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <RecType.h>
+#include <CodeGenerator.h>
+
+/*
+ * Testing: CodeGenerator
+ * Common subexpression elimination merges structurally equal nodes only.
+ */
+
+static int countOccurrences(const std::string &code, const std::string &pattern) {
+    int count = 0;
+    for (size_t pos = code.find(pattern); pos != std::string::npos; pos = code.find(pattern, pos + 1))
+        count++;
+    return count;
+}
+
+TEST(CodeGenerator, DistinctOpsAreNotMerged) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    R x("x[0]"), y("x[1]");
+
+    CodeGenerator<double> generator;
+    sin(x).addToGeneratorAsResult(generator, "y[0]");
+    acos(x).addToGeneratorAsResult(generator, "y[1]");
+    (x/y).addToGeneratorAsResult(generator, "y[2]");
+    pow(x, y).addToGeneratorAsResult(generator, "y[3]");
+    generator.sortNodes();
+    std::string code = generator.generateCode();
+
+    EXPECT_EQ(countOccurrences(code, "sin("), 1);
+    EXPECT_EQ(countOccurrences(code, "acos("), 1);
+    EXPECT_EQ(countOccurrences(code, " / "), 1);
+    EXPECT_EQ(countOccurrences(code, "pow("), 1);
+}
+
+TEST(CodeGenerator, EqualSubexpressionsAreMerged) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    // recorded twice without hash-consing, so these are different nodes
+    R a = sin(R("x[0]")*R("x[1]"));
+    R b = sin(R("x[0]")*R("x[1]"));
+    EXPECT_NE(a.getNode(), b.getNode());
+
+    CodeGenerator<double> generator;
+    a.addToGeneratorAsResult(generator, "y[0]");
+    b.addToGeneratorAsResult(generator, "y[1]");
+    generator.sortNodes();
+    std::string code = generator.generateCode();
+
+    EXPECT_EQ(countOccurrences(code, " = x[0]"), 1);
+    EXPECT_EQ(countOccurrences(code, " * "), 1);
+    EXPECT_EQ(countOccurrences(code, "sin("), 1);
+    EXPECT_EQ(countOccurrences(code, "y[0] = "), 1);
+    EXPECT_EQ(countOccurrences(code, "y[1] = "), 1);
+    EXPECT_EQ(generator.getHashedNode(b.getNode()), a.getNode());
+}
+
+TEST(CodeGenerator, CommutedOperandsAreMerged) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    R x("x[0]"), y("x[1]");
+
+    CodeGenerator<double> generator;
+    (x*y).addToGeneratorAsResult(generator, "y[0]");
+    (y*x).addToGeneratorAsResult(generator, "y[1]");
+    (x-y).addToGeneratorAsResult(generator, "y[2]");
+    (y-x).addToGeneratorAsResult(generator, "y[3]");
+    generator.sortNodes();
+    std::string code = generator.generateCode();
+
+    EXPECT_EQ(countOccurrences(code, " * "), 1);
+    EXPECT_EQ(countOccurrences(code, " - "), 2);
+}
+
+TEST(CodeGenerator, CollidingHashesAreNotFolded) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    // different values with the same hash
+    R x("x[0]"), y("x[1]");
+    R a = (x + x) + (x*y), b = (x*x) + (x + y);
+    EXPECT_EQ(a.getNode()->getHash(), b.getNode()->getHash());
+
+    R difference = a - b;
+    EXPECT_EQ(difference.getNode()->getOp(), SUB_OP);
+    EXPECT_EQ((a - a).getNode()->getOp(), CONST_OP);
+
+    CodeGenerator<double> generator;
+    difference.addToGeneratorAsResult(generator, "y[0]");
+    generator.sortNodes();
+    std::string code = generator.generateCode();
+    EXPECT_EQ(countOccurrences(code, " - "), 1);
+}
+
+/*
+ * Collecting and sorting does not recurse, so very deep graphs do not
+ * overflow the stack.
+ */
+
+TEST(CodeGenerator, DeepGraph) {
+    using namespace AutoGen;
+
+    Tape<double> tape;
+    const Node<double>* x = tape.create<NodeVar<double>>("x[0]");
+    const Node<double>* node = x;
+    for (int i = 0; i < 500000; ++i) {
+        node = tape.create<NodeAdd<double>>(node, x);
+    }
+
+    CodeGenerator<double> generator;
+    generator.collectNodes(tape.create<NodeResult<double>>("y[0]", node));
+    generator.sortNodes();
+    EXPECT_EQ(generator.getNumNodes(), 500002u);
+}
+
+/*
+ * MIN_LIVE_ORDER keeps fewer values live than the depth first order, and with
+ * reused variables the code declares only that many variables.
+ */
+
+TEST(CodeGenerator, MinLiveOrder) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    // a chain of terms, neighbours share an input
+    const int n = 20;
+    std::vector<R> x, terms;
+    for (int i = 0; i < n; ++i) {
+        x.push_back(R("x[" + std::to_string(i) + "]"));
+    }
+    for (int i = 0; i + 1 < n; ++i) {
+        R d = x[i] - x[i+1];
+        terms.push_back(sqrt(d*d + 1.0) * cos(x[i]));
+    }
+
+    size_t maxLive[2];
+    for (int order = 0; order < 2; ++order) {
+        CodeGenerator<double> generator;
+        for (int i = 0; i + 1 < n; ++i) {
+            terms[i].addToGeneratorAsResult(generator, "y[" + std::to_string(i) + "]");
+        }
+        generator.sortNodes(order ? MIN_LIVE_ORDER : DEPTH_FIRST_ORDER);
+        maxLive[order] = generator.getMaxLive();
+
+        generator.setReuseVariables(true);
+        std::string code = generator.generateCode();
+        EXPECT_EQ(countOccurrences(code, "double "), int(maxLive[order]));
+        EXPECT_EQ(countOccurrences(code, "= sqrt("), n - 1);
+    }
+    EXPECT_LT(2*maxLive[1], maxLive[0]);
+}
+
+/*
+ * Constants are written with the fewest digits that read back exactly.
+ */
+
+static std::string formatNumber(double value) {
+    std::ostringstream os;
+    AutoGen::writeNumber(os, value);
+    return os.str();
+}
+
+TEST(CodeGenerator, NumberFormat) {
+    EXPECT_EQ(formatNumber(0.5), "0.5");
+    EXPECT_EQ(formatNumber(2.0), "2.0");
+    EXPECT_EQ(formatNumber(-3.0), "-3.0");
+    EXPECT_EQ(formatNumber(0.1), "0.1");
+    EXPECT_EQ(formatNumber(1e-300), "1e-300");
+    EXPECT_EQ(formatNumber(1.0/3.0), "0.3333333333333333");
+
+    const double values[] = {M_PI, 1.0/3.0, 1e-7, 123456789.123456789, -2.5e100, 5e-324};
+    for (double v : values) {
+        EXPECT_EQ(std::strtod(formatNumber(v).c_str(), nullptr), v);
+    }
+}
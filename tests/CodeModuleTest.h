@@ -0,0 +1,61 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <RecType.h>
+#include <CodeModule.h>
+#include <AutoLoad.h>
+
+/*
+ * Testing: CodeModule
+ * Two functions sharing a subexpression are written as separate entry points
+ * and as one entry point computing the shared value once.
+ */
+
+TEST(CodeModule, SharedEntryPoints) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    Tape<double>::HashConsing hashConsing(Tape<double>::active());
+
+    R x("x[0]"), y("x[1]");
+    R shared = sqrt(x*x + y*y);
+
+    CodeModule<double> module;
+    module.addFunction("norm", "const double *x, double *n");
+    module.addFunction("normalized", "const double *x, double *v");
+    module.addOutput("norm", "n[0]", shared);
+    module.addOutput("normalized", "v[0]", x/shared);
+    module.addOutput("normalized", "v[1]", y/shared);
+    EXPECT_THROW(module.addOutput("unknown", "u[0]", x), std::invalid_argument);
+    EXPECT_EQ(module.getAllArguments(), "const double *x, double *n, double *v");
+
+    std::string norm = module.generateCode("norm");
+    EXPECT_EQ(norm.find("v[0]"), std::string::npos);
+    EXPECT_EQ(std::count(norm.begin(), norm.end(), '\n'), 7);
+
+    // the all outputs entry point computes the norm once
+    std::string all = module.generateCode();
+    std::string normalized = module.generateCode("normalized");
+    EXPECT_EQ(std::count(all.begin(), all.end(), '\n'), std::count(normalized.begin(), normalized.end(), '\n') + 1);
+
+    std::ostringstream code;
+    code << "#include <cmath>\nextern \"C\" {\n";
+    module.writeModule(code, "all");
+    code << "void compute_extern(double* x, double* y) {\n"
+            "all(x, y, y + 1);\n"
+            "}\n";
+    code << "}\n";
+
+    std::string error;
+    KernelHandle kernel;
+    ASSERT_TRUE(buildAndLoad(code.str(), kernel, "module", error)) << error;
+    EXPECT_TRUE(kernel.getSymbol("norm") != nullptr);
+    EXPECT_TRUE(kernel.getSymbol("normalized") != nullptr);
+
+    double in[2] = {3.0, 4.0}, out[3];
+    kernel.get()(in, out);
+    EXPECT_EQ(out[0], 5.0);
+    EXPECT_EQ(out[1], 0.6);
+    EXPECT_EQ(out[2], 0.8);
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <RecType.h>
+#include <CodeGenerator.h>
+#include <Bytecode.h>
+#include <EGraph.h>
+
+/*
+ * Testing: EGraph
+ * The rewrite rules find cheaper equivalent expressions, and simplified
+ * values compute the same.
+ */
+
+TEST(EGraph, Rules) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    R x("x"), y("y"), z("z");
+    std::vector<R> values = {-(-x), x*y + x*z, sin(x)*sin(x) + cos(x)*cos(x), x + (-y), (-x)*(-y), (x*y - x*z) - x*(y - z)};
+    std::vector<R> simplified = simplify(values);
+    ASSERT_EQ(simplified.size(), values.size());
+
+    // --x = x
+    EXPECT_EQ(simplified[0].getNode(), x.getNode());
+    // x*y + x*z = x*(y+z)
+    EXPECT_EQ(simplified[1].getNode()->getOp(), MUL_OP);
+    // sin^2 + cos^2 = 1
+    double value;
+    EXPECT_TRUE(simplified[2].getNode()->evaluate(value));
+    EXPECT_EQ(value, 1.0);
+    // x + -y = x - y
+    EXPECT_EQ(simplified[3].getNode()->getOp(), SUB_OP);
+    // -x * -y = x*y
+    EXPECT_EQ(simplified[4].getNode()->getOp(), MUL_OP);
+    EXPECT_EQ(simplified[4].getNode()->getChild(0)->getOp(), VAR_OP);
+    // x*(y-z) - x*(y-z) = 0
+    EXPECT_TRUE(simplified[5].getNode()->evaluate(value));
+    EXPECT_EQ(value, 0.0);
+
+    EXPECT_LT(EGraph<double>::getCost(simplified), EGraph<double>::getCost(values));
+}
+
+template<class T>
+static T egraphTestFunction(const T &x, const T &y) {
+    using std::sin; using std::cos; using std::sqrt;
+    T a = -(-(x*y)) + x*sin(y);
+    T b = a*a - a*cos(x) + (-y)*(-a);
+    return b/sqrt(x*x + 1.0) - (-(b - a));
+}
+
+TEST(EGraph, PreservesValues) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    R x("x[0]"), y("x[1]");
+    std::vector<R> values = {egraphTestFunction(x, y), egraphTestFunction(y, x)};
+    std::vector<R> simplified = simplify(values);
+    EXPECT_LT(EGraph<double>::getCost(simplified), EGraph<double>::getCost(values));
+
+    CodeGenerator<double> generator;
+    for (size_t i = 0; i < simplified.size(); ++i) {
+        simplified[i].addToGeneratorAsResult(generator, "y[" + std::to_string(i) + "]");
+    }
+    generator.sortNodes();
+    Bytecode<double> bytecode = Bytecode<double>::compile(generator, {"x[0]", "x[1]"}, {"y[0]", "y[1]"});
+
+    const double points[][2] = {{0.3, 1.2}, {-1.1, 0.7}, {2.0, -0.4}};
+    for (const auto &in : points) {
+        double out[2];
+        bytecode.evaluate(in, out);
+        EXPECT_NEAR(out[0], egraphTestFunction(in[0], in[1]), 1e-12);
+        EXPECT_NEAR(out[1], egraphTestFunction(in[1], in[0]), 1e-12);
+    }
+}
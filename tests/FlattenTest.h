@@ -0,0 +1,118 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <RecType.h>
+#include <CodeGenerator.h>
+#include <Bytecode.h>
+#include <Adjoint.h>
+#include <Flatten.h>
+
+/*
+ * Testing: Flatten
+ * Sums and products are equal in any grouping after flattening, and
+ * flattened values compute the same in bytecode and their derivatives.
+ */
+
+TEST(Flatten, Canonical) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    R a("a"), b("b"), c("c"), d("d");
+    std::vector<R> values = {(a + b) + c, a + (b + c), c + (b + a), (a*b)*(c*d), d*((c*b)*a), (a + 1.0) + (b + 2.0)};
+    std::vector<R> flat = flatten(values);
+    ASSERT_EQ(flat.size(), values.size());
+
+    EXPECT_EQ(flat[0].getNode()->getOp(), SUM_OP);
+    EXPECT_EQ(flat[0].getNode()->getNumChildren(), 3u);
+    EXPECT_EQ(flat[3].getNode()->getOp(), PRODUCT_OP);
+    EXPECT_EQ(flat[3].getNode()->getNumChildren(), 4u);
+    // constants are folded, a + b + 3
+    EXPECT_EQ(flat[5].getNode()->getNumChildren(), 3u);
+
+    // all groupings are one node
+    CodeGenerator<double> before, after;
+    for (size_t i = 0; i < 5; ++i) {
+        before.collectNodes(values[i].getNode());
+        after.collectNodes(flat[i].getNode());
+    }
+    EXPECT_EQ(after.getNumNodes(), 4u + 2u);
+    EXPECT_LT(after.getNumNodes(), before.getNumNodes());
+
+    // lowering gives balanced binary nodes
+    std::vector<R> lowered = lower(flat);
+    EXPECT_EQ(lowered[3].getNode()->getOp(), MUL_OP);
+    EXPECT_EQ(lowered[3].getNode()->getChild(0)->getOp(), MUL_OP);
+    EXPECT_EQ(lowered[3].getNode()->getChild(1)->getOp(), MUL_OP);
+}
+
+template<class T>
+static T flattenTestFunction(const T &x, const T &y, const T &z) {
+    using std::sin; using std::cos;
+    return (x*y*z + x*x*y + z)*sin(x + y + z) + (y + z + x)*cos(x*y*z);
+}
+
+TEST(Flatten, Derivatives) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    std::vector<R> x = {R("x[0]"), R("x[1]"), R("x[2]")};
+    R f = flattenTestFunction(x[0], x[1], x[2]);
+    std::vector<R> grad = gradient(f, x);
+    std::vector<std::vector<R>> hess = hessian(grad, x);
+    std::vector<R> values = {f};
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = i; j < 3; ++j) {
+            values.push_back(hess[i][j]);
+        }
+    }
+
+    // the hessian of the flattened function, with reverse and forward mode
+    std::vector<R> flat = flatten(values);
+    std::vector<R> flatGrad = gradient(flat[0], x);
+    std::vector<std::vector<R>> flatHess = hessian(flatGrad, x);
+    std::vector<std::vector<R>> flatTangents = tangents(flatGrad, x, {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}});
+    std::vector<R> derivatives;
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = i; j < 3; ++j) {
+            derivatives.push_back(flatHess[i][j]);
+            derivatives.push_back(flatTangents[j][i]);
+        }
+    }
+
+    CodeGenerator<double> before, after;
+    for (const R &value : values) {
+        before.collectNodes(value.getNode());
+    }
+    for (const R &value : flat) {
+        after.collectNodes(value.getNode());
+    }
+    EXPECT_LT(after.getNumNodes(), before.getNumNodes());
+
+    // every value and derivative of the flattened values is the original one
+    std::vector<std::string> outputs;
+    CodeGenerator<double> generator;
+    auto addPair = [&](R value, R expected) {
+        outputs.push_back("y[" + std::to_string(outputs.size()) + "]");
+        value.addToGeneratorAsResult(generator, outputs.back());
+        outputs.push_back("y[" + std::to_string(outputs.size()) + "]");
+        expected.addToGeneratorAsResult(generator, outputs.back());
+    };
+    for (size_t i = 0; i < values.size(); ++i) {
+        addPair(flat[i], values[i]);
+    }
+    for (size_t i = 0; i < derivatives.size(); ++i) {
+        addPair(derivatives[i], values[1 + i/2]);
+    }
+    generator.sortNodes();
+    Bytecode<double> bytecode = Bytecode<double>::compile(generator, {"x[0]", "x[1]", "x[2]"}, outputs);
+
+    const double points[][3] = {{0.3, 1.2, -0.5}, {-1.1, 0.7, 2.0}};
+    for (const auto &in : points) {
+        std::vector<double> out(outputs.size());
+        bytecode.evaluate(in, out.data());
+        for (size_t i = 0; i < outputs.size(); i += 2) {
+            EXPECT_NEAR(out[i], out[i + 1], 1e-10);
+        }
+    }
+}
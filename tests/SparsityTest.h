@@ -0,0 +1,91 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <RecType.h>
+#include <CodeGenerator.h>
+#include <Bytecode.h>
+#include <Sparsity.h>
+
+/*
+ * Testing: Sparsity
+ * The Hessian of a chain energy is banded. Its pattern is found from the
+ * graph, few colors suffice and the compressed values match the dense ones.
+ */
+
+TEST(Sparsity, ChainHessian) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    // E = sum_i sin(x_i) * (x_i - x_i+1)^2
+    const int n = 40;
+    std::vector<R> inputs;
+    for (int i = 0; i < n; ++i) {
+        inputs.push_back(R("x[" + std::to_string(i) + "]"));
+    }
+    R E = 0.0;
+    for (int i = 0; i + 1 < n; ++i) {
+        R d = inputs[i] - inputs[i+1];
+        E += sin(inputs[i])*d*d;
+    }
+    std::vector<R> grad = gradient(E, inputs);
+
+    SparsityPattern pattern;
+    std::vector<R> values = symmetricJacobian(grad, inputs, pattern);
+    EXPECT_EQ(pattern.getNumNonZeros(), size_t(3*n - 2));
+    EXPECT_EQ(values.size(), pattern.getNumNonZeros());
+    EXPECT_EQ(pattern.find(0, 2), -1);
+    EXPECT_GE(pattern.find(5, 4), 0);
+
+    std::vector<size_t> colors;
+    EXPECT_EQ(pattern.colorColumns(colors), 3u);
+
+    // compare to the dense Hessian
+    std::vector<std::vector<R>> hess = hessian(grad, inputs);
+    CodeGenerator<double> generator;
+    std::vector<std::string> outputs;
+    for (size_t k = 0; k < values.size(); ++k) {
+        size_t i = pattern.getRow(k), j = pattern.getCol(k);
+        if(j < i) {
+            EXPECT_EQ(values[k].getNode(), values[pattern.find(j, i)].getNode());
+        }
+        outputs.push_back("sparse[" + std::to_string(k) + "]");
+        values[k].addToGeneratorAsResult(generator, outputs.back());
+        outputs.push_back("dense[" + std::to_string(k) + "]");
+        hess[i][j].addToGeneratorAsResult(generator, outputs.back());
+    }
+    generator.sortNodes();
+    std::vector<std::string> names;
+    for (int i = 0; i < n; ++i) {
+        names.push_back("x[" + std::to_string(i) + "]");
+    }
+    Bytecode<double> bytecode = Bytecode<double>::compile(generator, names, outputs);
+
+    std::vector<double> in(n), out(outputs.size());
+    for (int i = 0; i < n; ++i) {
+        in[i] = std::cos(0.3*i);
+    }
+    bytecode.evaluate(in.data(), out.data());
+    for (size_t k = 0; k < values.size(); ++k) {
+        EXPECT_NEAR(out[2*k], out[2*k+1], 1e-12);
+    }
+}
+
+TEST(Sparsity, Jacobian) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    R x("x"), y("y"), z("z");
+    std::vector<R> outputs = {x*y, R(2.0), sqrt(z) + x};
+
+    SparsityPattern pattern;
+    std::vector<R> values = jacobian(outputs, {x, y, z}, pattern);
+    ASSERT_EQ(pattern.getNumNonZeros(), 4u);
+    EXPECT_EQ(pattern.find(1, 0), -1);
+
+    // d(x*y)/dx = y
+    EXPECT_EQ(values[pattern.find(0, 0)].getNode(), y.getNode());
+    double value;
+    EXPECT_TRUE(values[pattern.find(2, 0)].getNode()->evaluate(value));
+    EXPECT_EQ(value, 1.0);
+}
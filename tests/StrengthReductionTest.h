@@ -0,0 +1,85 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <RecType.h>
+#include <CodeGenerator.h>
+#include <Bytecode.h>
+#include <StrengthReduction.h>
+
+/*
+ * Testing: StrengthReduction
+ * Integer and half-integer powers become multiplications and sqrt, divisions
+ * by one denominator share its reciprocal, and the values stay the same.
+ */
+
+static size_t countOps(const std::vector<AutoGen::RecType<double>> &values, AutoGen::NodeOp op) {
+    AutoGen::CodeGenerator<double> generator;
+    for (const AutoGen::RecType<double> &value : values) {
+        generator.collectNodes(value.getNode());
+    }
+    size_t count = 0;
+    for (size_t i = 0; i < generator.getNumNodes(); ++i) {
+        if(generator.getNode(i)->getOp() == op)
+            count++;
+    }
+    return count;
+}
+
+TEST(StrengthReduction, PowAndDivision) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    R x("x[0]"), y("x[1]"), d = x*x + 1.0;
+    std::vector<R> values = {pow(x, 2.0), pow(x, 5.0), pow(y, -3.0), pow(y, 1.5), pow(y, -0.5), pow(y, 0.3),
+                             x/d, y/d, (x - y)/d, x/y};
+    std::vector<R> reduced = reduceStrength(values);
+    ASSERT_EQ(reduced.size(), values.size());
+
+    // only the non-integer power is left
+    EXPECT_EQ(countOps(reduced, POW_OP), 1u);
+    EXPECT_EQ(reduced[0].getNode()->getOp(), MUL_OP);
+    EXPECT_EQ(reduced[3].getNode()->getChild(1)->getOp(), SQRT_OP);
+    // the divisions by d multiply by one reciprocal, a single division stays
+    for (size_t i = 6; i < 9; ++i) {
+        ASSERT_EQ(reduced[i].getNode()->getOp(), MUL_OP);
+        EXPECT_EQ(reduced[i].getNode()->getChild(1), reduced[6].getNode()->getChild(1));
+    }
+    EXPECT_EQ(reduced[6].getNode()->getChild(1)->getOp(), DIV_OP);
+    EXPECT_EQ(reduced[9].getNode()->getOp(), DIV_OP);
+
+    CodeGenerator<double> generator;
+    std::vector<std::string> outputs;
+    for (size_t i = 0; i < values.size(); ++i) {
+        outputs.push_back("y[" + std::to_string(2*i) + "]");
+        reduced[i].addToGeneratorAsResult(generator, outputs.back());
+        outputs.push_back("y[" + std::to_string(2*i + 1) + "]");
+        values[i].addToGeneratorAsResult(generator, outputs.back());
+    }
+    generator.sortNodes();
+    Bytecode<double> bytecode = Bytecode<double>::compile(generator, {"x[0]", "x[1]"}, outputs);
+
+    const double points[][2] = {{0.3, 1.2}, {-1.1, 0.7}, {2.0, 3.5}};
+    for (const auto &in : points) {
+        std::vector<double> out(outputs.size());
+        bytecode.evaluate(in, out.data());
+        for (size_t i = 0; i < outputs.size(); i += 2) {
+            EXPECT_NEAR(out[i], out[i + 1], 1e-12*std::max(1.0, std::abs(out[i + 1])));
+        }
+    }
+}
+
+TEST(StrengthReduction, UnaryConstantFolding) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    R two(2.0), half(0.5);
+    std::vector<R> values = {sqrt(two), cos(two), sin(two), acos(half), -two, pow(two, half)};
+    const double expected[] = {std::sqrt(2.0), std::cos(2.0), std::sin(2.0), std::acos(0.5), -2.0, std::pow(2.0, 0.5)};
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(values[i].getNode()->getOp(), CONST_OP);
+        double value;
+        EXPECT_TRUE(values[i].getNode()->evaluate(value));
+        EXPECT_EQ(value, expected[i]);
+    }
+}
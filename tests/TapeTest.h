@@ -0,0 +1,148 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <RecType.h>
+#include <CodeGenerator.h>
+#include <ExpCoords.h>
+
+#include <thread>
+
+/*
+ * Testing: Tape
+ * Recording into a scoped tape places all nodes into a few large blocks.
+ */
+
+TEST(Tape, RecordsIntoFewBlocks) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    Tape<double> &defaultTape = Tape<double>::active();
+
+    Tape<double> tape;
+    {
+        Tape<double>::Scope scope(tape);
+        EXPECT_EQ(&Tape<double>::active(), &tape);
+
+        Vector3<R> v;
+        for (int i = 0; i < 3; ++i) {
+            v[i] = R("v[" + std::to_string(i) + "]");
+        }
+        Tensor4<R,3,3,3,3> ddR = ExpCoords::ddR(v);
+
+        CodeGenerator<double> generator;
+        ddR[0][0](0,0).addToGeneratorAsResult(generator, "y[0]");
+        generator.sortNodes();
+        EXPECT_FALSE(generator.generateCode().empty());
+    }
+    EXPECT_EQ(&Tape<double>::active(), &defaultTape);
+
+    EXPECT_GT(tape.getNumNodes(), 1000u);
+    EXPECT_LT(tape.getNumBlocks(), 8u);
+
+    tape.clear();
+    EXPECT_EQ(tape.getNumNodes(), 0u);
+    EXPECT_EQ(tape.getNumBlocks(), 0u);
+}
+
+/*
+ * Testing: Tape node ids
+ * Nodes are numbered in the order they are recorded, and a code generator
+ * finds nodes of several tapes.
+ */
+
+TEST(Tape, NodeIds) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    Tape<double> first, second;
+    R x, y;
+    {
+        Tape<double>::Scope scope(first);
+        x = R("x[0]");
+        y = sin(x);
+    }
+    EXPECT_EQ(x.getNode()->getTapeId(), first.getId());
+    EXPECT_EQ(x.getNode()->getId(), 0u);
+    EXPECT_EQ(y.getNode()->getId(), 1u);
+
+    Tape<double>::Scope scope(second);
+    R z = y*x + R("x[1]");
+    EXPECT_EQ(z.getNode()->getTapeId(), second.getId());
+    EXPECT_NE(first.getId(), second.getId());
+
+    CodeGenerator<double> generator;
+    generator.collectNodes(z.getNode());
+    EXPECT_EQ(generator.getNumNodes(), 5u);
+    EXPECT_EQ(generator.getHashedNode(y.getNode()), y.getNode());
+
+    // a cleared tape numbers its nodes anew
+    uint32_t id = second.getId();
+    second.clear();
+    EXPECT_NE(second.getId(), id);
+}
+
+/*
+ * Testing: Tape hash-consing
+ * With hash-consing, recording the same expression twice returns the same
+ * nodes and does not grow the tape.
+ */
+
+template<class T>
+T computeHashConsing(const T &x, const T &y) {
+    return sin(x*y) + x*y/(x+y);
+}
+
+TEST(Tape, HashConsing) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    Tape<double> tape;
+    Tape<double>::Scope scope(tape);
+
+    R x, y;
+    {
+        Tape<double>::HashConsing hashConsing(tape);
+        EXPECT_TRUE(tape.isHashConsing());
+
+        x = R("x[0]");
+        y = R("x[1]");
+
+        R a = computeHashConsing(x, y);
+        size_t numNodes = tape.getNumNodes();
+        R b = computeHashConsing(R("x[0]"), R("x[1]"));
+
+        EXPECT_EQ(a.getNode(), b.getNode());
+        EXPECT_EQ(tape.getNumNodes(), numNodes);
+        EXPECT_EQ((x+y).getNode(), (x+y).getNode());
+        EXPECT_NE((x+y).getNode(), (y+x).getNode());
+        EXPECT_NE(R(0.0).getNode(), R(-0.0).getNode());
+    }
+    EXPECT_FALSE(tape.isHashConsing());
+    EXPECT_NE((x+y).getNode(), (x+y).getNode());
+}
+
+/*
+ * Testing: Tape default tape
+ * Without a scope, values are recorded into the default tape of the thread,
+ * which is cleared once no value refers to it anymore.
+ */
+
+TEST(Tape, DefaultTapeIsReclaimed) {
+    using namespace AutoGen;
+    typedef RecType<double> R;
+
+    // a thread of its own, so no other test's values refer to its default tape
+    std::thread thread([]() {
+        Tape<double> &tape = Tape<double>::active();
+        {
+            R x("x[0]"), y("x[1]");
+            R a = computeHashConsing(x, y);
+            EXPECT_GT(tape.getNumNodes(), 0u);
+            EXPECT_GT(tape.getNumReferences(), 0u);
+        }
+        EXPECT_EQ(tape.getNumReferences(), 0u);
+        EXPECT_EQ(tape.getNumNodes(), 0u);
+    });
+    thread.join();
+}
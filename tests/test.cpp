@@ -3,6 +3,17 @@
 #include "AutoLoadTest.h"
 #include "ExpCoordsTest.h"
 #include "RigidBodyTest.h"
+#include "TapeTest.h"
+#include "CodeGeneratorTest.h"
+#include "BytecodeTest.h"
+#include "AdjointTest.h"
+#include "AutoDiffTest.h"
+#include "SparsityTest.h"
+#include "CodeModuleTest.h"
+#include "FlattenTest.h"
+#include "StrengthReductionTest.h"
+#include "EGraphTest.h"
+#include "AutoGenTest.h"
 
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);